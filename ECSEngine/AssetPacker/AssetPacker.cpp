@@ -0,0 +1,185 @@
+#include "Core/AssetArchive.h"
+#include "Core/AssetId.h"
+#include "Core/Lz4.h"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+// Offline packer that bundles asset directories into one .epak archive.
+//
+//   AssetPacker [--no-compress] <output.epak> <directory>...
+//
+// Files are stored under their path as given on the command line ("res" packs
+// res/shaders/basic.vert as "res/shaders/basic.vert"), so run it from the
+// directory the engine runs in. Each file is LZ4 compressed unless that saves
+// less than an eighth of its size; already compressed images stay as they are.
+
+struct PackOptions {
+    bool compress = true;
+};
+
+struct PackedFile {
+    AssetId id = 0;
+    std::string name;
+    std::vector<unsigned char> stored;
+    uint64_t size = 0;
+    AssetArchiveCompression compression = AssetArchiveCompression::None;
+};
+
+static bool readFile(const std::filesystem::path& path, std::vector<unsigned char>& outData) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return false;
+    }
+    outData.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    return true;
+}
+
+static bool packFile(const std::filesystem::path& path, const PackOptions& options, PackedFile& outFile) {
+    std::vector<unsigned char> data;
+    if (!readFile(path, data)) {
+        std::cerr << "ERROR: Could not read " << path.string() << std::endl;
+        return false;
+    }
+
+    outFile.name = path.lexically_normal().generic_string();
+    outFile.id = hashAssetName(outFile.name);
+    outFile.size = data.size();
+
+    if (options.compress && !data.empty()) {
+        std::vector<unsigned char> compressed(lz4CompressBound(data.size()));
+        size_t compressedSize = lz4Compress(data.data(), data.size(), compressed.data(), compressed.size());
+        if (compressedSize > 0 && compressedSize <= data.size() - data.size() / 8) {
+            compressed.resize(compressedSize);
+            outFile.stored = std::move(compressed);
+            outFile.compression = AssetArchiveCompression::LZ4;
+            return true;
+        }
+    }
+    outFile.stored = std::move(data);
+    return true;
+}
+
+static uint64_t alignOffset(uint64_t offset) {
+    return (offset + kAssetArchiveAlignment - 1) / kAssetArchiveAlignment * kAssetArchiveAlignment;
+}
+
+static bool writeArchive(const std::string& outputPath, std::vector<PackedFile>& files) {
+    std::sort(files.begin(), files.end(), [](const PackedFile& a, const PackedFile& b) { return a.id < b.id; });
+    for (size_t i = 1; i < files.size(); ++i) {
+        if (files[i].id == files[i - 1].id) {
+            std::cerr << "ERROR: Path hash collision between " << files[i - 1].name << " and " << files[i].name << std::endl;
+            return false;
+        }
+    }
+
+    std::vector<AssetArchiveEntry> table(files.size());
+    std::string names;
+    for (size_t i = 0; i < files.size(); ++i) {
+        table[i] = {};
+        table[i].id = files[i].id;
+        table[i].nameOffset = static_cast<uint32_t>(names.size());
+        table[i].nameLength = static_cast<uint32_t>(files[i].name.size());
+        table[i].storedSize = files[i].stored.size();
+        table[i].size = files[i].size;
+        table[i].compression = static_cast<uint32_t>(files[i].compression);
+        names += files[i].name;
+    }
+
+    AssetArchiveHeader header = {};
+    std::memcpy(header.magic, kAssetArchiveMagic, sizeof(kAssetArchiveMagic));
+    header.version = kAssetArchiveVersion;
+    header.entryCount = static_cast<uint32_t>(files.size());
+    header.namesOffset = sizeof(AssetArchiveHeader) + sizeof(AssetArchiveEntry) * table.size();
+    header.namesSize = names.size();
+
+    uint64_t offset = header.namesOffset + header.namesSize;
+    for (AssetArchiveEntry& entry : table) {
+        offset = alignOffset(offset);
+        entry.offset = offset;
+        offset += entry.storedSize;
+    }
+
+    std::ofstream file(outputPath, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        std::cerr << "ERROR: Could not open " << outputPath << " for writing." << std::endl;
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(table.data()), sizeof(AssetArchiveEntry) * table.size());
+    file.write(names.data(), static_cast<std::streamsize>(names.size()));
+    const char padding[kAssetArchiveAlignment] = {};
+    for (size_t i = 0; i < files.size(); ++i) {
+        uint64_t position = static_cast<uint64_t>(file.tellp());
+        file.write(padding, static_cast<std::streamsize>(table[i].offset - position));
+        file.write(reinterpret_cast<const char*>(files[i].stored.data()), static_cast<std::streamsize>(files[i].stored.size()));
+    }
+    return static_cast<bool>(file);
+}
+
+static void printUsage() {
+    std::cout << "Usage: AssetPacker [--no-compress] <output.epak> <directory>..." << std::endl;
+}
+
+int main(int argc, char** argv) {
+    PackOptions options;
+    std::vector<std::string> paths;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string argument = argv[i];
+        if (argument == "--no-compress") {
+            options.compress = false;
+        }
+        else if (argument == "--help" || argument == "-h") {
+            printUsage();
+            return 0;
+        }
+        else {
+            paths.push_back(argument);
+        }
+    }
+
+    if (paths.size() < 2) {
+        printUsage();
+        return 1;
+    }
+
+    const std::filesystem::path outputPath(paths[0]);
+    std::vector<PackedFile> files;
+    uint64_t totalSize = 0;
+    uint64_t totalStored = 0;
+
+    for (size_t i = 1; i < paths.size(); ++i) {
+        std::error_code error;
+        for (std::filesystem::recursive_directory_iterator it(paths[i], error), end; !error && it != end; it.increment(error)) {
+            std::error_code ignored;
+            if (!it->is_regular_file(ignored) || std::filesystem::equivalent(it->path(), outputPath, ignored)) {
+                continue;
+            }
+            PackedFile packed;
+            if (!packFile(it->path(), options, packed)) {
+                return 1;
+            }
+            totalSize += packed.size;
+            totalStored += packed.stored.size();
+            files.push_back(std::move(packed));
+        }
+        if (error) {
+            std::cerr << "ERROR: Could not read directory " << paths[i] << ": " << error.message() << std::endl;
+            return 1;
+        }
+    }
+
+    if (!writeArchive(outputPath.string(), files)) {
+        return 1;
+    }
+    std::cout << "Packed " << files.size() << " files (" << totalSize << " bytes, " << totalStored << " stored) into " << outputPath.string() << std::endl;
+    return 0;
+}
\ No newline at end of file
@@ -0,0 +1,712 @@
+#include <GL/glew.h>
+#include <GLFW/glfw3.h>
+
+#include "Core/AssetManager.h"
+#include "Core/FontRenderer.h"
+#include "Core/FrameArena.h"
+#include "Core/MemoryTracker.h"
+#include "Core/GameObject.h"
+#include "Core/Mesh.h"
+#include "Core/MicrowaveSystem.h"
+#include "Core/PickingManager.h"
+#include "Core/Renderer.h"
+#include "Core/RenderSnapshot.h"
+#include "Core/Scene.h"
+#include "Core/SceneSerializer.h"
+#include "Core/Shader.h"
+#include "Core/SpriteBatch.h"
+#include "Components/Camera2DComponent.h"
+#include "Components/Camera3DComponent.h"
+#include "Components/ClickableComponent.h"
+#include "Components/MeshComponent.h"
+#include "Components/RenderComponent.h"
+#include "Components/TransformComponent.h"
+#include "Input/InputManager.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Synthetic stress scenes with per-phase frame timings.
+//
+//   Benchmark [--scene hierarchy|quads|clickables|text|microwaves|sceneload|all] [--count N]
+//             [--depth D] [--frames F] [--warmup W] [--output results.json]
+//             [--submit-snapshot] [--max-frame-allocations N]
+//
+// Run it from ECSEngine/ECSEngine so res/ resolves. It needs a GL 3.3 context
+// but never shows its window; on a machine without a display use xvfb-run.
+// Each frame is split into update, transform, picking, snapshot (building the
+// render snapshot the pipelined renderer consumes) and render (the immediate
+// draw path, finished with glFinish). Warmup frames are dropped, then every
+// phase reports mean, min, max and p50/p90/p99 in milliseconds as JSON.
+// Heap allocations made between the start of update and the end of render
+// are counted through MemoryTracker too; a steady-state frame should make none.
+// --submit-snapshot renders through Renderer::Submit instead, and
+// --max-frame-allocations fails the run when any measured frame allocates more.
+
+static constexpr int kWindowWidth = 1280;
+static constexpr int kWindowHeight = 720;
+static constexpr AssetRef kBasicVertexShader = "res/shaders/basic.vert";
+static constexpr AssetRef kBasicFragmentShader = "res/shaders/basic.frag";
+static constexpr AssetRef kBenchmarkCubeMesh = "BenchmarkCube";
+static constexpr AssetRef kBenchmarkQuadMesh = "BenchmarkQuad";
+
+struct BenchmarkOptions {
+    std::vector<std::string> scenes;
+    int count = 10000;
+    int depth = 16;
+    int frames = 300;
+    int warmup = 60;
+    int maxFrameAllocations = -1;
+    bool submitSnapshot = false;
+    std::string outputPath;
+};
+
+enum BenchmarkPhase {
+    PHASE_UPDATE,
+    PHASE_TRANSFORM,
+    PHASE_PICKING,
+    PHASE_SNAPSHOT,
+    PHASE_RENDER,
+    PHASE_FRAME,
+    PHASE_COUNT
+};
+
+static const char* kPhaseNames[PHASE_COUNT] = { "update", "transform", "picking", "snapshot", "render", "frame" };
+
+struct PhaseStats {
+    double mean = 0.0;
+    double min = 0.0;
+    double max = 0.0;
+    double p50 = 0.0;
+    double p90 = 0.0;
+    double p99 = 0.0;
+};
+
+struct BenchmarkResult {
+    std::string scene;
+    size_t objectCount = 0;
+    PhaseStats phases[PHASE_COUNT];
+    double heapAllocationsPerFrame = 0.0;
+    uint64_t maxHeapAllocationsPerFrame = 0;
+};
+
+// Base for the stress scenes. Update only animates and updates the objects;
+// picking is timed separately instead of inside Scene::Update.
+class BenchmarkScene : public Scene {
+public:
+    explicit BenchmarkScene(const std::string& name) : Scene(name), m_time(0.0f) {}
+
+    virtual void build(const BenchmarkOptions& options) = 0;
+
+    void Update(float deltaTime) override {
+        m_time += deltaTime;
+        animate(deltaTime);
+        for (const auto& gameObject : m_gameObjects) {
+            gameObject->Update(deltaTime);
+        }
+    }
+
+    void updateWorldMatrices() {
+        for (const auto& gameObject : m_gameObjects) {
+            updateWorldMatrices(gameObject.get());
+        }
+    }
+
+    virtual size_t countObjects() const {
+        size_t count = 0;
+        std::vector<const GameObject*> stack;
+        for (const auto& gameObject : m_gameObjects) {
+            stack.push_back(gameObject.get());
+        }
+        while (!stack.empty()) {
+            const GameObject* object = stack.back();
+            stack.pop_back();
+            ++count;
+            for (const auto& child : object->getChildren()) {
+                stack.push_back(child.get());
+            }
+        }
+        return count;
+    }
+
+    // A failed scene's timings measure the failure, so runScene drops them.
+    virtual bool hasFailed() const { return false; }
+
+protected:
+    float m_time;
+
+    virtual void animate(float deltaTime) = 0;
+
+    static void updateWorldMatrices(GameObject* object) {
+        object->getTransform()->getWorldMatrix();
+        for (const auto& child : object->getChildren()) {
+            updateWorldMatrices(child.get());
+        }
+    }
+
+    void addCamera2D() {
+        auto camera = std::make_unique<GameObject>("BenchmarkCamera");
+        CameraBaseComponent* cameraComponent = camera->addComponent<Camera2DComponent>(static_cast<float>(kWindowWidth), static_cast<float>(kWindowHeight), -1.0f, 1.0f);
+        AddGameObject(std::move(camera));
+        setActiveCamera(cameraComponent);
+    }
+
+    GameObject* addQuad(const std::string& name, const glm::vec2& position, float size, const glm::vec4& color) {
+        std::shared_ptr<Mesh> quad = AssetManager::getInstance().getMesh(kBenchmarkQuadMesh, []() {
+            auto mesh = std::make_shared<Mesh>("BenchmarkQuad");
+            mesh->generateQuad2D();
+            return mesh;
+        });
+        auto object = std::make_unique<GameObject>(name);
+        object->getTransform()->setLocalPosition(glm::vec3(position, 0.0f));
+        object->getTransform()->setLocalScale(glm::vec3(size, size, 1.0f));
+        object->addComponent<MeshComponent>(quad);
+        RenderComponent* render = object->addComponent<RenderComponent>(AssetManager::getInstance().getShader(kBasicVertexShader, kBasicFragmentShader));
+        render->setMesh(quad);
+        render->setObjectColor(color);
+        return AddGameObject(std::move(object));
+    }
+};
+
+// Chains of cubes, depth objects deep; every root turns each frame so the
+// whole hierarchy has to be recomputed.
+class HierarchyBenchmarkScene : public BenchmarkScene {
+public:
+    HierarchyBenchmarkScene() : BenchmarkScene("hierarchy") {}
+
+    void build(const BenchmarkOptions& options) override {
+        auto camera = std::make_unique<GameObject>("BenchmarkCamera");
+        camera->getTransform()->setLocalPosition(glm::vec3(0.0f, 40.0f, 120.0f));
+        Camera3DComponent* cameraComponent = camera->addComponent<Camera3DComponent>(45.0f, static_cast<float>(kWindowWidth) / kWindowHeight, 0.1f, 500.0f);
+        cameraComponent->setLookAtTarget(glm::vec3(0.0f));
+        AddGameObject(std::move(camera));
+        setActiveCamera(cameraComponent);
+
+        std::shared_ptr<Mesh> cube = AssetManager::getInstance().getMesh(kBenchmarkCubeMesh, []() { return std::make_shared<Mesh>("BenchmarkCube"); });
+        std::shared_ptr<Shader> shader = AssetManager::getInstance().getShader(kBasicVertexShader, kBasicFragmentShader);
+
+        const int depth = std::max(1, options.depth);
+        const int chains = std::max(1, options.count / depth);
+        const int gridSide = static_cast<int>(std::ceil(std::sqrt(static_cast<double>(chains))));
+        reserveGameObjects(chains + 1);
+        for (int chain = 0; chain < chains; ++chain) {
+            auto root = std::make_unique<GameObject>("Chain" + std::to_string(chain));
+            float x = (chain % gridSide - gridSide * 0.5f) * 2.0f;
+            float z = (chain / gridSide - gridSide * 0.5f) * 2.0f;
+            root->getTransform()->setLocalPosition(glm::vec3(x, 0.0f, z));
+
+            GameObject* parent = root.get();
+            for (int level = 0; level < depth; ++level) {
+                auto link = std::make_unique<GameObject>("Link");
+                link->getTransform()->setLocalPosition(glm::vec3(0.0f, level == 0 ? 0.0f : 1.0f, 0.0f));
+                link->getTransform()->setLocalScale(glm::vec3(0.95f));
+                link->getTransform()->setLocalEulerRotation(glm::vec3(0.0f, 10.0f, 0.0f));
+                link->addComponent<MeshComponent>(cube);
+                RenderComponent* render = link->addComponent<RenderComponent>(shader);
+                render->setMesh(cube);
+                render->setObjectColor(glm::vec4(0.3f + 0.7f * level / depth, 0.5f, 0.8f, 1.0f));
+                parent = parent->addChild(std::move(link));
+            }
+            m_roots.push_back(AddGameObject(std::move(root)));
+        }
+    }
+
+protected:
+    void animate(float deltaTime) override {
+        for (GameObject* root : m_roots) {
+            root->getTransform()->rotate(glm::vec3(0.0f, deltaTime, 0.0f));
+        }
+    }
+
+private:
+    std::vector<GameObject*> m_roots;
+};
+
+// Flat 2D quads that all move every frame.
+class QuadsBenchmarkScene : public BenchmarkScene {
+public:
+    QuadsBenchmarkScene() : BenchmarkScene("quads") {}
+
+    void build(const BenchmarkOptions& options) override {
+        addCamera2D();
+        reserveGameObjects(options.count + 1);
+        for (int i = 0; i < options.count; ++i) {
+            glm::vec2 position(static_cast<float>(std::rand() % kWindowWidth), static_cast<float>(std::rand() % kWindowHeight));
+            m_quads.push_back(addQuad("Quad", position, 8.0f, glm::vec4(0.2f, 0.6f, 1.0f, 1.0f)));
+        }
+    }
+
+protected:
+    void animate(float deltaTime) override {
+        float offset = std::sin(m_time * 2.0f) * 20.0f * deltaTime;
+        for (GameObject* quad : m_quads) {
+            quad->getTransform()->translate(glm::vec3(offset, 0.0f, 0.0f));
+        }
+    }
+
+private:
+    std::vector<GameObject*> m_quads;
+};
+
+// Static clickable quads on a grid; the mouse sweeps over them so hover has
+// to be re-picked every frame.
+class ClickablesBenchmarkScene : public BenchmarkScene {
+public:
+    ClickablesBenchmarkScene() : BenchmarkScene("clickables") {}
+
+    void build(const BenchmarkOptions& options) override {
+        addCamera2D();
+        reserveGameObjects(options.count + 1);
+        const int columns = std::max(1, static_cast<int>(std::sqrt(options.count * static_cast<double>(kWindowWidth) / kWindowHeight)));
+        const float spacing = static_cast<float>(kWindowWidth) / columns;
+        for (int i = 0; i < options.count; ++i) {
+            glm::vec2 position((i % columns + 0.5f) * spacing, (i / columns + 0.5f) * spacing);
+            GameObject* quad = addQuad("Clickable", position, spacing * 0.8f, glm::vec4(1.0f, 0.6f, 0.2f, 1.0f));
+            quad->addComponent<ClickableComponent>(PickingMethod::Method2D);
+        }
+    }
+
+protected:
+    void animate(float) override {
+    }
+};
+
+// Text drawn every frame through FontRenderer::renderText.
+class TextBenchmarkScene : public BenchmarkScene {
+public:
+    TextBenchmarkScene() : BenchmarkScene("text") {}
+
+    void build(const BenchmarkOptions& options) override {
+        addCamera2D();
+        m_labels.reserve(options.count);
+        for (int i = 0; i < options.count; ++i) {
+            glm::vec2 position(static_cast<float>(std::rand() % kWindowWidth), static_cast<float>(std::rand() % kWindowHeight));
+            m_labels.push_back({ "Label " + std::to_string(i), position });
+        }
+    }
+
+    size_t countObjects() const override {
+        return m_labels.size();
+    }
+
+    void Render() override {
+        Scene::Render();
+        if (!m_fontRenderer) {
+            return;
+        }
+        for (const Label& label : m_labels) {
+            m_fontRenderer->renderText(label.text, label.position.x, label.position.y, 0.25f, glm::vec3(1.0f));
+        }
+    }
+
+protected:
+    void animate(float) override {
+    }
+
+private:
+    struct Label {
+        std::string text;
+        glm::vec2 position;
+    };
+    std::vector<Label> m_labels;
+};
+
+// Appliances driven through MicrowaveSystem with random inputs and one tick
+// per frame. Equivalence with Microwave is covered by tests/MicrowaveSystemTests.
+class MicrowavesBenchmarkScene : public BenchmarkScene {
+public:
+    MicrowavesBenchmarkScene() : BenchmarkScene("microwaves"), m_random(12345u) {}
+
+    void build(const BenchmarkOptions& options) override {
+        m_system.reserve(options.count);
+        for (int i = 0; i < options.count; ++i) {
+            m_system.add();
+        }
+    }
+
+    size_t countObjects() const override {
+        return m_system.size();
+    }
+
+protected:
+    void animate(float) override {
+        static const MicrowaveSystem::Input kInputs[] = {
+            MicrowaveSystem::Input::Digit, MicrowaveSystem::Input::Digit, MicrowaveSystem::Input::Digit,
+            MicrowaveSystem::Input::Digit, MicrowaveSystem::Input::Start, MicrowaveSystem::Input::Start,
+            MicrowaveSystem::Input::Stop, MicrowaveSystem::Input::Clear, MicrowaveSystem::Input::OpenDoor,
+            MicrowaveSystem::Input::CloseDoor, MicrowaveSystem::Input::CloseDoor, MicrowaveSystem::Input::Repair,
+            MicrowaveSystem::Input::Break
+        };
+        const size_t inputCount = std::max<size_t>(1, m_system.size() / 100);
+        for (size_t i = 0; i < inputCount; ++i) {
+            size_t index = nextRandom() % m_system.size();
+            MicrowaveSystem::Input input = kInputs[nextRandom() % (sizeof(kInputs) / sizeof(kInputs[0]))];
+            // Keep breakdowns rare so most appliances get to cook.
+            if (input == MicrowaveSystem::Input::Break && nextRandom() % 8 != 0) {
+                input = MicrowaveSystem::Input::CloseDoor;
+            }
+            int digit = static_cast<int>(nextRandom() % 10);
+            m_system.queueInput(index, input, digit);
+        }
+        m_system.applyInputs();
+        m_system.tick();
+    }
+
+private:
+    MicrowaveSystem m_system;
+    uint32_t m_random;
+
+    uint32_t nextRandom() {
+        m_random = m_random * 1664525u + 1013904223u;
+        return m_random >> 8;
+    }
+};
+
+// Loads a saved copy of the hierarchy scene (count objects, depth deep) with
+// SceneSerializer every frame. The update phase is the load time, including
+// releasing the copy loaded on the previous frame:
+//
+//   Benchmark --scene sceneload --count 100000 --frames 20 --warmup 2
+class SceneLoadBenchmarkScene : public BenchmarkScene {
+public:
+    SceneLoadBenchmarkScene() : BenchmarkScene("sceneload"), m_objectCount(0), m_failedLoads(0) {}
+
+    void build(const BenchmarkOptions& options) override {
+        HierarchyBenchmarkScene source;
+        source.build(options);
+        m_objectCount = source.countObjects();
+        if (!SceneSerializer::save(source, kScenePath)) {
+            ++m_failedLoads;
+        }
+        source.Shutdown();
+    }
+
+    size_t countObjects() const override {
+        return m_objectCount;
+    }
+
+    bool hasFailed() const override {
+        return m_failedLoads > 0;
+    }
+
+    void Shutdown() override {
+        m_loaded.reset();
+        std::remove(kScenePath);
+        if (m_failedLoads > 0) {
+            std::cerr << "ERROR: " << m_failedLoads << " scene save or load(s) failed." << std::endl;
+        }
+        BenchmarkScene::Shutdown();
+    }
+
+protected:
+    void animate(float) override {
+        m_loaded.reset();
+        m_loaded = std::make_unique<Scene>("LoadedScene");
+        if (!SceneSerializer::load(*m_loaded, kScenePath)) {
+            ++m_failedLoads;
+        }
+    }
+
+private:
+    static constexpr const char* kScenePath = "benchmark_sceneload.escn";
+
+    std::unique_ptr<Scene> m_loaded;
+    size_t m_objectCount;
+    size_t m_failedLoads;
+};
+
+static std::unique_ptr<BenchmarkScene> createScene(const std::string& name) {
+    if (name == "hierarchy") return std::make_unique<HierarchyBenchmarkScene>();
+    if (name == "quads") return std::make_unique<QuadsBenchmarkScene>();
+    if (name == "clickables") return std::make_unique<ClickablesBenchmarkScene>();
+    if (name == "text") return std::make_unique<TextBenchmarkScene>();
+    if (name == "microwaves") return std::make_unique<MicrowavesBenchmarkScene>();
+    if (name == "sceneload") return std::make_unique<SceneLoadBenchmarkScene>();
+    return nullptr;
+}
+
+// Nearest-rank percentile over sorted samples.
+static double percentile(const std::vector<double>& sorted, double fraction) {
+    if (sorted.empty()) {
+        return 0.0;
+    }
+    size_t rank = static_cast<size_t>(std::ceil(fraction * sorted.size()));
+    return sorted[std::min(sorted.size(), std::max<size_t>(rank, 1)) - 1];
+}
+
+static PhaseStats computeStats(std::vector<double> samples) {
+    PhaseStats stats;
+    if (samples.empty()) {
+        return stats;
+    }
+    std::sort(samples.begin(), samples.end());
+    double sum = 0.0;
+    for (double sample : samples) {
+        sum += sample;
+    }
+    stats.mean = sum / samples.size();
+    stats.min = samples.front();
+    stats.max = samples.back();
+    stats.p50 = percentile(samples, 0.50);
+    stats.p90 = percentile(samples, 0.90);
+    stats.p99 = percentile(samples, 0.99);
+    return stats;
+}
+
+static bool runScene(const std::string& name, const BenchmarkOptions& options, GLFWwindow* window, BenchmarkResult& outResult) {
+    std::unique_ptr<BenchmarkScene> scene = createScene(name);
+    if (!scene) {
+        std::cerr << "ERROR: Unknown benchmark scene '" << name << "'." << std::endl;
+        return false;
+    }
+    scene->setWindowDimensions(kWindowWidth, kWindowHeight);
+    scene->Init();
+    scene->build(options);
+    if (scene->hasFailed()) {
+        std::cerr << "ERROR: '" << name << "' failed to build." << std::endl;
+        scene->Shutdown();
+        return false;
+    }
+
+    using Clock = std::chrono::steady_clock;
+    auto elapsedMs = [](Clock::time_point from, Clock::time_point to) {
+        return std::chrono::duration<double, std::milli>(to - from).count();
+    };
+
+    const float deltaTime = 1.0f / 60.0f;
+    InputManager& input = InputManager::getInstance();
+    PickingManager& picking = PickingManager::getInstance();
+    MemoryTracker& memory = MemoryTracker::getInstance();
+    RenderSnapshot snapshot;
+    Renderer renderer;
+    std::vector<double> samples[PHASE_COUNT];
+    for (std::vector<double>& phase : samples) {
+        phase.reserve(options.frames);
+    }
+    uint64_t totalHeapAllocations = 0;
+    uint64_t maxHeapAllocations = 0;
+
+    for (int frame = 0; frame < options.warmup + options.frames; ++frame) {
+        glfwPollEvents();
+        float angle = frame * 0.05f;
+        double mouseX = kWindowWidth * (0.5 + 0.4 * std::cos(angle));
+        double mouseY = kWindowHeight * (0.5 + 0.4 * std::sin(angle));
+
+        uint64_t allocationsBefore = memory.getTotals(MemoryDomain::Cpu).totalAllocations;
+        Clock::time_point start = Clock::now();
+        scene->Update(deltaTime);
+        Clock::time_point updated = Clock::now();
+        scene->updateWorldMatrices();
+        Clock::time_point transformed = Clock::now();
+        input.injectEvent({ glfwGetTime(), InputEventType::MouseMove, 0, 0, mouseX, mouseY });
+        input.update(deltaTime);
+        picking.Update(deltaTime, scene.get());
+        Clock::time_point picked = Clock::now();
+        snapshot.clear();
+        scene->BuildRenderSnapshot(snapshot);
+        Clock::time_point snapshotted = Clock::now();
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        if (options.submitSnapshot) {
+            renderer.Submit(snapshot);
+            if (FontRenderer* fontRenderer = scene->getFontRenderer()) {
+                Renderer::SubmitText(snapshot, *fontRenderer);
+            }
+        }
+        else {
+            scene->Render();
+        }
+        glFinish();
+        Clock::time_point rendered = Clock::now();
+        uint64_t frameAllocations = memory.getTotals(MemoryDomain::Cpu).totalAllocations - allocationsBefore;
+        glfwSwapBuffers(window);
+        FrameArena::getThreadInstance().reset();
+
+        if (frame < options.warmup) {
+            continue;
+        }
+        totalHeapAllocations += frameAllocations;
+        maxHeapAllocations = std::max(maxHeapAllocations, frameAllocations);
+        samples[PHASE_UPDATE].push_back(elapsedMs(start, updated));
+        samples[PHASE_TRANSFORM].push_back(elapsedMs(updated, transformed));
+        samples[PHASE_PICKING].push_back(elapsedMs(transformed, picked));
+        samples[PHASE_SNAPSHOT].push_back(elapsedMs(picked, snapshotted));
+        samples[PHASE_RENDER].push_back(elapsedMs(snapshotted, rendered));
+        samples[PHASE_FRAME].push_back(elapsedMs(start, rendered));
+    }
+
+    if (scene->hasFailed()) {
+        std::cerr << "ERROR: '" << name << "' failed; its results are not written." << std::endl;
+        scene->Shutdown();
+        return false;
+    }
+
+    outResult.scene = name;
+    outResult.objectCount = scene->countObjects();
+    for (int phase = 0; phase < PHASE_COUNT; ++phase) {
+        outResult.phases[phase] = computeStats(std::move(samples[phase]));
+    }
+    outResult.heapAllocationsPerFrame = options.frames > 0 ? static_cast<double>(totalHeapAllocations) / options.frames : 0.0;
+    outResult.maxHeapAllocationsPerFrame = maxHeapAllocations;
+    scene->Shutdown();
+    if (options.maxFrameAllocations >= 0 && maxHeapAllocations > static_cast<uint64_t>(options.maxFrameAllocations)) {
+        std::cerr << "ERROR: '" << name << "' made " << maxHeapAllocations << " heap allocations in one frame (limit " << options.maxFrameAllocations << ")." << std::endl;
+        return false;
+    }
+    return true;
+}
+
+static void writeJson(std::ostream& out, const BenchmarkOptions& options, const std::vector<BenchmarkResult>& results) {
+    out << "{\n  \"frames\": " << options.frames << ",\n  \"warmup\": " << options.warmup << ",\n  \"results\": [";
+    for (size_t i = 0; i < results.size(); ++i) {
+        const BenchmarkResult& result = results[i];
+        out << (i > 0 ? "," : "") << "\n    {\n      \"scene\": \"" << result.scene << "\",\n      \"objects\": " << result.objectCount << ",\n      \"phases\": {";
+        for (int phase = 0; phase < PHASE_COUNT; ++phase) {
+            const PhaseStats& stats = result.phases[phase];
+            out << (phase > 0 ? "," : "") << "\n        \"" << kPhaseNames[phase] << "\": { \"mean\": " << stats.mean
+                << ", \"min\": " << stats.min << ", \"max\": " << stats.max
+                << ", \"p50\": " << stats.p50 << ", \"p90\": " << stats.p90 << ", \"p99\": " << stats.p99 << " }";
+        }
+        out << "\n      },\n      \"heapAllocations\": { \"perFrame\": " << result.heapAllocationsPerFrame
+            << ", \"max\": " << result.maxHeapAllocationsPerFrame << " }\n    }";
+    }
+    out << "\n  ]\n}\n";
+}
+
+static void printUsage() {
+    std::cout << "Usage: Benchmark [--scene hierarchy|quads|clickables|text|microwaves|sceneload|all] [--count N] [--depth D] [--frames F] [--warmup W] [--output results.json] [--submit-snapshot] [--max-frame-allocations N]" << std::endl;
+}
+
+static bool parseOptions(int argc, char** argv, BenchmarkOptions& options) {
+    for (int i = 1; i < argc; ++i) {
+        std::string argument = argv[i];
+        bool hasValue = i + 1 < argc;
+        if (argument == "--scene" && hasValue) {
+            std::string scene = argv[++i];
+            if (scene == "all") {
+                options.scenes = { "hierarchy", "quads", "clickables", "text", "microwaves", "sceneload" };
+            }
+            else {
+                options.scenes.push_back(scene);
+            }
+        }
+        else if (argument == "--count" && hasValue) {
+            options.count = std::atoi(argv[++i]);
+        }
+        else if (argument == "--depth" && hasValue) {
+            options.depth = std::atoi(argv[++i]);
+        }
+        else if (argument == "--frames" && hasValue) {
+            options.frames = std::atoi(argv[++i]);
+        }
+        else if (argument == "--warmup" && hasValue) {
+            options.warmup = std::atoi(argv[++i]);
+        }
+        else if (argument == "--output" && hasValue) {
+            options.outputPath = argv[++i];
+        }
+        else if (argument == "--submit-snapshot") {
+            options.submitSnapshot = true;
+        }
+        else if (argument == "--max-frame-allocations" && hasValue) {
+            options.maxFrameAllocations = std::atoi(argv[++i]);
+        }
+        else {
+            return false;
+        }
+    }
+    if (options.scenes.empty()) {
+        options.scenes = { "hierarchy", "quads", "clickables", "text", "microwaves" };
+    }
+    return options.count > 0 && options.frames > 0 && options.warmup >= 0;
+}
+
+int main(int argc, char** argv) {
+    BenchmarkOptions options;
+    if (!parseOptions(argc, argv, options)) {
+        printUsage();
+        return 1;
+    }
+
+    if (!glfwInit()) {
+        std::cerr << "Failed to initialize GLFW!" << std::endl;
+        return 1;
+    }
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MAJOR, 3);
+    glfwWindowHint(GLFW_CONTEXT_VERSION_MINOR, 3);
+    glfwWindowHint(GLFW_OPENGL_PROFILE, GLFW_OPENGL_CORE_PROFILE);
+    glfwWindowHint(GLFW_VISIBLE, GLFW_FALSE);
+    GLFWwindow* window = glfwCreateWindow(kWindowWidth, kWindowHeight, "ECSEngine Benchmark", nullptr, nullptr);
+    if (!window) {
+        std::cerr << "Failed to create GLFW window!" << std::endl;
+        glfwTerminate();
+        return 1;
+    }
+    glfwMakeContextCurrent(window);
+    glfwSwapInterval(0);
+    glewExperimental = GL_TRUE;
+    if (glewInit() != GLEW_OK) {
+        std::cerr << "Failed to initialize GLEW!" << std::endl;
+        glfwTerminate();
+        return 1;
+    }
+
+    glEnable(GL_DEPTH_TEST);
+    glEnable(GL_BLEND);
+    glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+    glViewport(0, 0, kWindowWidth, kWindowHeight);
+
+    InputManager::getInstance().initialize(window);
+    PickingManager::getInstance().Init(kWindowWidth, kWindowHeight);
+    AssetManager::getInstance().Init();
+
+    // Scene setup logs a lot; keep stdout for the results.
+    std::stringstream setupLog;
+    std::streambuf* stdoutBuffer = std::cout.rdbuf(setupLog.rdbuf());
+
+    std::vector<BenchmarkResult> results;
+    bool succeeded = true;
+    for (const std::string& scene : options.scenes) {
+        std::cerr << "Running '" << scene << "' (" << options.count << " objects, " << options.warmup << " + " << options.frames << " frames)..." << std::endl;
+        BenchmarkResult result;
+        if (!runScene(scene, options, window, result)) {
+            succeeded = false;
+            break;
+        }
+        results.push_back(result);
+        setupLog.str(std::string());
+    }
+
+    std::cout.rdbuf(stdoutBuffer);
+    if (options.outputPath.empty()) {
+        writeJson(std::cout, options, results);
+    }
+    else {
+        std::ofstream file(options.outputPath, std::ios::trunc);
+        if (!file) {
+            std::cerr << "ERROR: Could not open " << options.outputPath << " for writing." << std::endl;
+            succeeded = false;
+        }
+        else {
+            writeJson(file, options, results);
+            std::cerr << "Wrote " << options.outputPath << std::endl;
+        }
+    }
+
+    SpriteBatch::getInstance().Shutdown();
+    PickingManager::getInstance().Shutdown();
+    AssetManager::getInstance().Shutdown();
+    glfwDestroyWindow(window);
+    glfwTerminate();
+    return succeeded ? 0 : 1;
+}
\ No newline at end of file
@@ -3,7 +3,16 @@
 #include <Core/TowerGameScene.h>
 #include <Core/MicrowaveGameScene.h>
 #include "Input/InputManager.h"
+#include "Core/AssetManager.h"
+#include "Core/VirtualFileSystem.h"
+#include "Core/FrameArena.h"
+#include "Core/MemoryTracker.h"
+#include "Core/FrameStats.h"
+#include "Core/FontRenderer.h"
+#include "Core/SpriteBatch.h"
 #include <glm/ext/matrix_clip_space.hpp>
+#include <cmath>
+#include <filesystem>
 
 
 void glfwErrorCallback(int error, const char* description) {
@@ -19,16 +28,46 @@ Application::Application()
     m_windowTitle(""),
     m_deltaTime(0.0f),
     m_lastFrame(0.0f),
+    m_fixedDeltaTime(1.0f / 60.0f),
+    m_accumulator(0.0f),
+    m_maxFrameTime(0.25f),
+    m_maxFixedStepsPerFrame(8),
+    m_timeScale(1.0f),
+    m_vsyncEnabled(true),
+    m_startupScene(0),
+    m_runStartTime(0.0),
+    m_quitAction(kInvalidInputAction),
+    m_memoryOverlayAction(kInvalidInputAction),
+    m_perfHudAction(kInvalidInputAction),
+    m_pickingMode(PickingMode::CPU),
+    m_pipelinedRendering(false),
+    m_simulationRequested(false),
+    m_simulationDone(true),
+    m_stopSimulation(false),
     m_gameScene(nullptr)
 {
 }
 
 Application::~Application() {
+}
+
+// Tears the engine down while the other singletons are still alive. The
+// destructor runs from atexit, after function-local statics are gone.
+void Application::shutdown() {
+    InputManager::getInstance().stopRecording();
     if (m_gameScene) {
         m_gameScene->Shutdown();
+        m_gameScene.reset();
     }
+    m_perfHud.shutdown();
+    m_debugDraw.shutdown();
+    SpriteBatch::getInstance().Shutdown();
+    PickingManager::getInstance().Shutdown();
+    AssetManager::getInstance().Shutdown();
+    VirtualFileSystem::getInstance().unmountAll();
     if (m_window) {
         glfwDestroyWindow(m_window);
+        m_window = nullptr;
     }
     glfwTerminate();
     glfwSetErrorCallback(nullptr);
@@ -62,7 +101,7 @@ bool Application::createWindow(unsigned int width, unsigned int height, const st
         return false;
     }
     glfwMakeContextCurrent(m_window);
-    glfwSwapInterval(1);
+    glfwSwapInterval(m_vsyncEnabled ? 1 : 0);
     return true;
 }
 
@@ -87,8 +126,8 @@ bool Application::init(unsigned int windowWidth, unsigned int windowHeight, cons
     this->m_windowHeight = windowHeight;
     this->m_windowTitle = title;
 
-    int choice = 0;
-    bool validChoice = false;
+    int choice = m_startupScene;
+    bool validChoice = choice == 1 || choice == 2;
     while (!validChoice) {
         std::cout << "\n--- Select a Scene ---" << std::endl;
         std::cout << "1. Tower Game Scene" << std::endl;
@@ -104,9 +143,9 @@ bool Application::init(unsigned int windowWidth, unsigned int windowHeight, cons
         }
         else {
             validChoice = true;
+            std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
         }
     }
-    std::cin.ignore(std::numeric_limits<std::streamsize>::max(), '\n');
 
     switch (choice) {
     case 1:
@@ -145,7 +184,32 @@ bool Application::init(unsigned int windowWidth, unsigned int windowHeight, cons
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
 
     InputManager::getInstance().initialize(m_window);
+    InputManager::getInstance().loadBindings("config/settings.json");
+    m_quitAction = InputManager::getInstance().getActionId("app.quit");
+    m_memoryOverlayAction = InputManager::getInstance().getActionId("debug.memoryOverlay");
+    m_perfHudAction = InputManager::getInstance().getActionId("debug.perfHud");
+    if (!m_inputReplayPath.empty()) {
+        if (!InputManager::getInstance().startReplay(m_inputReplayPath)) {
+            return false;
+        }
+    }
+    else if (!m_inputRecordingPath.empty()) {
+        InputManager::getInstance().startRecording(m_inputRecordingPath);
+    }
     PickingManager::getInstance().Init(m_windowWidth, m_windowHeight);
+    int framebufferWidth, framebufferHeight;
+    glfwGetFramebufferSize(m_window, &framebufferWidth, &framebufferHeight);
+    PickingManager::getInstance().setFramebufferSize(framebufferWidth, framebufferHeight);
+    PickingManager::getInstance().setPickingMode(m_pickingMode);
+    // Packed assets shadow the loose files under res/, so remove res.epak
+    // while editing assets with hot reload.
+    if (std::filesystem::exists("res.epak")) {
+        VirtualFileSystem::getInstance().mountArchive("res.epak");
+    }
+    AssetManager::getInstance().Init();
+#ifndef NDEBUG
+    AssetManager::getInstance().enableHotReload(true);
+#endif
 
     glfwSetWindowUserPointer(m_window, this);
     glfwSetFramebufferSizeCallback(m_window, framebuffer_size_callback);
@@ -155,36 +219,235 @@ bool Application::init(unsigned int windowWidth, unsigned int windowHeight, cons
 
     
 
+    m_debugDraw.init("res/fonts/Roboto-Regular.ttf", 14);
+    m_perfHud.init();
+
     m_gameScene->setWindowDimensions(m_windowWidth, m_windowHeight);
-    m_gameScene->Init();
+    {
+        MemoryTagScope memoryScope(MemoryTag::Scene);
+        m_gameScene->Init();
+    }
 
     std::cout << "Application initialized successfully. GameObjects and transforms are ready." << std::endl;
     return true;
 }
 
 void Application::run() {
+    if (m_pipelinedRendering) {
+        if (m_gameScene && m_gameScene->supportsPipelinedSimulation()) {
+            runPipelined();
+            return;
+        }
+        std::cout << "Scene does not support pipelined simulation, running sequentially." << std::endl;
+    }
+
+    m_lastFrame = static_cast<float>(glfwGetTime());
+    m_runStartTime = glfwGetTime();
+    m_accumulator = 0.0f;
+
     while (!glfwWindowShouldClose(m_window)) {
-        float currentFrame = static_cast<float>(glfwGetTime());
-        m_deltaTime = currentFrame - m_lastFrame;
-        m_lastFrame = currentFrame;
+        m_perfHud.beginFrame();
+        float frameTime = advanceFrameTime();
 
-        InputManager::getInstance().update();
-        PickingManager::getInstance().Update(m_deltaTime, m_gameScene.get());
         glfwPollEvents();
+        InputManager::getInstance().update(frameTime);
+        handleWindowInput();
 
-        if (InputManager::getInstance().isKeyJustPressed(GLFW_KEY_ESCAPE)) {
-            std::cout << "ESCAPE key was pressed. Closing window." << std::endl;
-            glfwSetWindowShouldClose(m_window, true);
-        }
-
+        AssetManager::getInstance().processTextureUploads();
         glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
 
         if (m_gameScene) {
-            m_gameScene->Update(m_deltaTime);
+            simulateFrame();
             m_gameScene->Render();
+            PickingManager::getInstance().RenderIdBuffer(m_gameScene.get());
+        }
+        renderDebugOverlays();
+
+        glfwSwapBuffers(m_window);
+        FrameStats::getInstance().endFrame();
+        FrameArena::getThreadInstance().reset();
+        MemoryTracker::getInstance().endFrame();
+    }
+}
+
+// Queues the HUD and memory table, draws both in one batch and closes the
+// frame's timing. Runs after the scene and before the swap.
+void Application::renderDebugOverlays() {
+    float y = m_perfHud.render(m_debugDraw, 10.0f, 10.0f);
+    m_memoryOverlay.render(m_debugDraw, 10.0f, y + 4.0f);
+    m_debugDraw.flush(m_windowWidth, m_windowHeight);
+    m_perfHud.endFrame();
+}
+
+// Returns the unscaled frame time. A replay substitutes the recorded one so
+// the fixed-step accumulator sees the same sequence as the capture.
+float Application::advanceFrameTime() {
+    float currentFrame = static_cast<float>(glfwGetTime());
+    float frameTime = currentFrame - m_lastFrame;
+    m_lastFrame = currentFrame;
+    if (InputManager::getInstance().isReplaying()) {
+        frameTime = InputManager::getInstance().getReplayFrameTime();
+    }
+
+    if (frameTime > m_maxFrameTime) {
+        frameTime = m_maxFrameTime;
+    }
+    m_deltaTime = frameTime * m_timeScale;
+    m_accumulator += m_deltaTime;
+    return frameTime;
+}
+
+void Application::handleWindowInput() {
+    InputManager& input = InputManager::getInstance();
+    if (input.isReplaying() && input.isReplayFinished() && !glfwWindowShouldClose(m_window)) {
+        double elapsed = glfwGetTime() - m_runStartTime;
+        size_t frames = input.getReplayFrameCount();
+        std::cout << "Input replay finished: " << frames << " frames in " << elapsed << " s ("
+            << (frames > 0 ? elapsed * 1000.0 / frames : 0.0) << " ms/frame)." << std::endl;
+        glfwSetWindowShouldClose(m_window, true);
+        return;
+    }
+    if (input.isActionJustPressed(m_memoryOverlayAction)) {
+        m_memoryOverlay.toggle();
+    }
+    if (input.isActionJustPressed(m_perfHudAction)) {
+        m_perfHud.toggle();
+    }
+    if (input.isActionJustPressed(m_quitAction)) {
+        std::cout << "Quit was pressed. Closing window." << std::endl;
+        glfwSetWindowShouldClose(m_window, true);
+    }
+}
+
+void Application::simulateFrame() {
+    int steps = 0;
+    while (m_accumulator >= m_fixedDeltaTime && steps < m_maxFixedStepsPerFrame) {
+        m_gameScene->FixedUpdate(m_fixedDeltaTime);
+        m_accumulator -= m_fixedDeltaTime;
+        ++steps;
+    }
+    if (m_accumulator >= m_fixedDeltaTime) {
+        // Simulation can't keep up; drop the backlog instead of spiraling.
+        m_accumulator = std::fmod(m_accumulator, m_fixedDeltaTime);
+    }
+
+    m_gameScene->Update(m_deltaTime);
+    m_gameScene->setInterpolationAlpha(m_accumulator / m_fixedDeltaTime);
+}
+
+// Frame N is drawn from its snapshot while the simulation thread produces
+// frame N+1. Events are only polled while the simulation thread is idle, so
+// scene code sees stable input for the whole frame.
+void Application::runPipelined() {
+    std::cout << "Running scene '" << m_gameScene->getName() << "' with pipelined simulation." << std::endl;
+
+    m_lastFrame = static_cast<float>(glfwGetTime());
+    m_runStartTime = glfwGetTime();
+    m_accumulator = 0.0f;
+    m_simulationRequested = false;
+    m_simulationDone = true;
+    m_stopSimulation = false;
+    m_simulationThread = std::thread(&Application::simulationThreadMain, this);
+
+    while (!glfwWindowShouldClose(m_window)) {
+        m_perfHud.beginFrame();
+        waitForSimulation();
+
+        float frameTime = advanceFrameTime();
+        glfwPollEvents();
+        InputManager::getInstance().update(frameTime);
+        handleWindowInput();
+
+        requestSimulation();
+
+        AssetManager::getInstance().processTextureUploads();
+        glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+        if (const RenderSnapshot* snapshot = m_snapshots.acquireLatest()) {
+            m_renderer.Submit(*snapshot);
+            if (FontRenderer* fontRenderer = m_gameScene->getFontRenderer()) {
+                Renderer::SubmitText(*snapshot, *fontRenderer);
+            }
         }
+        renderDebugOverlays();
 
         glfwSwapBuffers(m_window);
+        FrameStats::getInstance().endFrame();
+        FrameArena::getThreadInstance().reset();
+        MemoryTracker::getInstance().endFrame();
+    }
+
+    waitForSimulation();
+    {
+        std::lock_guard<std::mutex> lock(m_simulationMutex);
+        m_stopSimulation = true;
+    }
+    m_simulationCondition.notify_all();
+    m_simulationThread.join();
+}
+
+void Application::simulationThreadMain() {
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_simulationMutex);
+            m_simulationCondition.wait(lock, [this]() { return m_simulationRequested || m_stopSimulation; });
+            if (m_stopSimulation) {
+                return;
+            }
+            m_simulationRequested = false;
+        }
+
+        simulateFrame();
+        m_gameScene->BuildRenderSnapshot(m_snapshots.beginWrite());
+        m_snapshots.publish();
+        // The simulation thread has its own arena.
+        FrameArena::getThreadInstance().reset();
+
+        {
+            std::lock_guard<std::mutex> lock(m_simulationMutex);
+            m_simulationDone = true;
+        }
+        m_simulationCondition.notify_all();
+    }
+}
+
+void Application::requestSimulation() {
+    {
+        std::lock_guard<std::mutex> lock(m_simulationMutex);
+        m_simulationDone = false;
+        m_simulationRequested = true;
+    }
+    m_simulationCondition.notify_all();
+}
+
+void Application::waitForSimulation() {
+    std::unique_lock<std::mutex> lock(m_simulationMutex);
+    m_simulationCondition.wait(lock, [this]() { return m_simulationDone; });
+}
+
+void Application::setFixedUpdateRate(float hz) {
+    if (hz <= 0.0f) {
+        std::cerr << "WARNING: Application::setFixedUpdateRate - rate must be positive, got " << hz << "." << std::endl;
+        return;
+    }
+    m_fixedDeltaTime = 1.0f / hz;
+}
+
+void Application::setMaxFrameTime(float seconds) {
+    m_maxFrameTime = seconds > 0.0f ? seconds : m_maxFrameTime;
+}
+
+void Application::setMaxFixedStepsPerFrame(int steps) {
+    m_maxFixedStepsPerFrame = steps > 0 ? steps : 1;
+}
+
+void Application::setTimeScale(float scale) {
+    m_timeScale = scale > 0.0f ? scale : 0.0f;
+}
+
+void Application::setVSyncEnabled(bool enabled) {
+    m_vsyncEnabled = enabled;
+    if (m_window) {
+        glfwSwapInterval(m_vsyncEnabled ? 1 : 0);
     }
 }
 
@@ -197,5 +460,9 @@ void Application::onFramebufferSize(int width, int height) {
     m_windowWidth = width;
     m_windowHeight = height;
     glViewport(0, 0, m_windowWidth, m_windowHeight);
+    int windowWidth, windowHeight;
+    glfwGetWindowSize(m_window, &windowWidth, &windowHeight);
+    PickingManager::getInstance().setWindowSize(windowWidth, windowHeight);
+    PickingManager::getInstance().setFramebufferSize(width, height);
     std::cout << "Framebuffer Resized to: " << width << "x" << height << std::endl;
 }
\ No newline at end of file
@@ -4,7 +4,17 @@
 #include <GLFW/glfw3.h>
 #include <string>
 #include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 #include "Core/Scene.h"
+#include "Core/RenderSnapshot.h"
+#include "Core/Renderer.h"
+#include "Core/DebugDraw2D.h"
+#include "Core/MemoryOverlay.h"
+#include "Core/PerfHud.h"
+#include "Core/PickingManager.h"
+#include "Input/InputManager.h"
 
 class Application {
 public:
@@ -14,6 +24,21 @@ public:
 
     bool init(unsigned int windowWidth, unsigned int windowHeight, const std::string& title);
     void run();
+    // Call once after run() returns.
+    void shutdown();
+
+    void setFixedUpdateRate(float hz);
+    void setMaxFrameTime(float seconds);
+    void setMaxFixedStepsPerFrame(int steps);
+    void setTimeScale(float scale);
+    void setVSyncEnabled(bool enabled);
+    void setPipelinedRendering(bool enabled) { m_pipelinedRendering = enabled; }
+    void setPickingMode(PickingMode mode) { m_pickingMode = mode; }
+    // 1 = tower, 2 = microwave; 0 asks on stdin.
+    void setStartupScene(int scene) { m_startupScene = scene; }
+    void setInputRecordingPath(const std::string& path) { m_inputRecordingPath = path; }
+    // Drives the run from a recording and closes the window when it ends.
+    void setInputReplayPath(const std::string& path) { m_inputReplayPath = path; }
 
 private:
     Application();
@@ -23,6 +48,15 @@ private:
     bool createWindow(unsigned int width, unsigned int height, const std::string& title);
     bool initializeGLEW();
 
+    float advanceFrameTime();
+    void handleWindowInput();
+    void simulateFrame();
+    void runPipelined();
+    void renderDebugOverlays();
+    void simulationThreadMain();
+    void requestSimulation();
+    void waitForSimulation();
+
     GLFWwindow* m_window;
     unsigned int m_windowWidth, m_windowHeight;
     std::string m_windowTitle;
@@ -30,6 +64,35 @@ private:
     float m_deltaTime;
     float m_lastFrame;
 
+    float m_fixedDeltaTime;
+    float m_accumulator;
+    float m_maxFrameTime;
+    int m_maxFixedStepsPerFrame;
+    float m_timeScale;
+    bool m_vsyncEnabled;
+
+    int m_startupScene;
+    std::string m_inputRecordingPath;
+    std::string m_inputReplayPath;
+    double m_runStartTime;
+    InputActionId m_quitAction;
+    InputActionId m_memoryOverlayAction;
+    InputActionId m_perfHudAction;
+    DebugDraw2D m_debugDraw;
+    MemoryOverlay m_memoryOverlay;
+    PerfHud m_perfHud;
+
+    PickingMode m_pickingMode;
+    bool m_pipelinedRendering;
+    std::thread m_simulationThread;
+    std::mutex m_simulationMutex;
+    std::condition_variable m_simulationCondition;
+    bool m_simulationRequested;
+    bool m_simulationDone;
+    bool m_stopSimulation;
+    RenderSnapshotBuffer m_snapshots;
+    Renderer m_renderer;
+
     std::unique_ptr<Scene> m_gameScene;
 
     static Application* s_instance;
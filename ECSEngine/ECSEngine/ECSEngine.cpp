@@ -1,15 +1,56 @@
 #include "Application.h"
+#include <cstdlib>
+#include <cstring>
 #include <iostream>
 
-int main() {
+// ECSEngine [--scene 1|2] [--record <file>] [--replay <file>] [--no-vsync] [--pipelined] [--picking cpu|idbuffer]
+int main(int argc, char** argv) {
     Application& app = Application::getInstance();
 
+    for (int i = 1; i < argc; ++i) {
+        bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--scene") == 0 && hasValue) {
+            app.setStartupScene(std::atoi(argv[++i]));
+        }
+        else if (std::strcmp(argv[i], "--record") == 0 && hasValue) {
+            app.setInputRecordingPath(argv[++i]);
+        }
+        else if (std::strcmp(argv[i], "--replay") == 0 && hasValue) {
+            app.setInputReplayPath(argv[++i]);
+        }
+        else if (std::strcmp(argv[i], "--no-vsync") == 0) {
+            app.setVSyncEnabled(false);
+        }
+        else if (std::strcmp(argv[i], "--pipelined") == 0) {
+            app.setPipelinedRendering(true);
+        }
+        else if (std::strcmp(argv[i], "--picking") == 0 && hasValue) {
+            ++i;
+            if (std::strcmp(argv[i], "cpu") == 0) {
+                app.setPickingMode(PickingMode::CPU);
+            }
+            else if (std::strcmp(argv[i], "idbuffer") == 0) {
+                app.setPickingMode(PickingMode::IDBuffer);
+            }
+            else {
+                std::cerr << "Unknown picking mode: " << argv[i] << std::endl;
+                return -1;
+            }
+        }
+        else {
+            std::cerr << "Unknown argument: " << argv[i] << std::endl;
+            std::cerr << "Usage: ECSEngine [--scene 1|2] [--record <file>] [--replay <file>] [--no-vsync] [--pipelined] [--picking cpu|idbuffer]" << std::endl;
+            return -1;
+        }
+    }
+
     if (!app.init(800, 600, "GameObject & Transform Test")) {
         std::cerr << "Failed to initialize Application." << std::endl;
         return -1;
     }
 
     app.run();
+    app.shutdown();
 
     return 0;
 }
\ No newline at end of file
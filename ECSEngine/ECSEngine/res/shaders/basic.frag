@@ -3,22 +3,9 @@ out vec4 FragColor;
 
 in vec2 TexCoords;
 
-uniform sampler2D texture_diffuse1;
-uniform vec4 objectColor;
-uniform int hasTexture;
-
+#include "include/material.glsl"
 
 void main()
 {
-    vec4 finalColor;
-
-    if (hasTexture == 1) {
-        vec4 texColor = texture(texture_diffuse1, TexCoords);
-        finalColor = texColor * objectColor;
-    } else {
-        finalColor = objectColor;
-    }
-
-    
-    FragColor = finalColor; 
+    FragColor = shadeMaterial(TexCoords);
 }
\ No newline at end of file
@@ -2,14 +2,32 @@
 layout (location = 0) in vec3 aPos;
 layout (location = 1) in vec3 aNormal;
 layout (location = 2) in vec2 aTexCoords;
+#ifdef INSTANCED
+// Per-instance model matrix, one column per attribute slot, then the
+// instance's uvRect and colour (see SpriteBatch).
+layout (location = 3) in mat4 aModel;
+layout (location = 7) in vec4 aUVRect;
+layout (location = 8) in vec4 aColor;
+out vec4 InstanceColor;
+#endif
 
 out vec2 TexCoords;
-uniform mat4 model;
 uniform mat4 view;
 uniform mat4 projection;
+#ifndef INSTANCED
+uniform mat4 model;
+// Sub-rectangle of the bound texture, (offset.xy, scale.zw). Identity unless
+// the texture is an atlas.
+uniform vec4 uvRect;
+#endif
 
 void main()
 {
-    TexCoords = aTexCoords;
+#ifdef INSTANCED
+    mat4 model = aModel;
+    vec4 uvRect = aUVRect;
+    InstanceColor = aColor;
+#endif
+    TexCoords = uvRect.xy + aTexCoords * uvRect.zw;
     gl_Position = projection * view * model * vec4(aPos, 1.0);
 }
\ No newline at end of file
@@ -0,0 +1,31 @@
+// Shared surface colour for the basic shaders. HAS_TEXTURE and ALPHA_TEST
+// are injected by the Shader preprocessor.
+#ifdef INSTANCED
+in vec4 InstanceColor;
+#else
+uniform vec4 objectColor;
+#endif
+#ifdef HAS_TEXTURE
+uniform sampler2D texture_diffuse1;
+#endif
+#ifdef ALPHA_TEST
+uniform float alphaCutoff;
+#endif
+
+vec4 shadeMaterial(vec2 uv)
+{
+#ifdef INSTANCED
+    vec4 objectColor = InstanceColor;
+#endif
+#ifdef HAS_TEXTURE
+    vec4 color = texture(texture_diffuse1, uv) * objectColor;
+#else
+    vec4 color = objectColor;
+#endif
+#ifdef ALPHA_TEST
+    if (color.a < alphaCutoff) {
+        discard;
+    }
+#endif
+    return color;
+}
\ No newline at end of file
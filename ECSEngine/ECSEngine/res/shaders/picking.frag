@@ -0,0 +1,9 @@
+#version 330 core
+out uint FragId;
+
+uniform uint objectId;
+
+void main()
+{
+    FragId = objectId;
+}
\ No newline at end of file
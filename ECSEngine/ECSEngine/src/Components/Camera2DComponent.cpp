@@ -18,6 +18,7 @@ void Camera2DComponent::recalculateProjection() {
     m_projectionMatrix = glm::ortho(0.0f, m_screenWidth / m_zoom,
         0.0f, m_screenHeight / m_zoom,
         m_nearPlane, m_farPlane);
+    ++m_version;
 }
 
 glm::mat4 Camera2DComponent::getViewMatrix() const {
@@ -30,12 +31,19 @@ glm::mat4 Camera2DComponent::getViewMatrix() const {
 }
 
 void Camera2DComponent::setScreenDimensions(float width, float height) {
+    if (width == m_screenWidth && height == m_screenHeight) {
+        return;
+    }
     m_screenWidth = width;
     m_screenHeight = height;
     recalculateProjection();
 }
 
 void Camera2DComponent::setZoom(float zoom) {
-    m_zoom = glm::max(0.1f, zoom);
+    zoom = glm::max(0.1f, zoom);
+    if (zoom == m_zoom) {
+        return;
+    }
+    m_zoom = zoom;
     recalculateProjection();
 }
\ No newline at end of file
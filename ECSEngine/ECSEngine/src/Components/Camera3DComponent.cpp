@@ -16,6 +16,7 @@ Camera3DComponent::Camera3DComponent(GameObject* owner, float fovDegrees, float
 
 void Camera3DComponent::recalculateProjection() {
     m_projectionMatrix = glm::perspective(glm::radians(m_fov), m_aspectRatio, m_nearPlane, m_farPlane);
+    ++m_version;
 }
 
 glm::mat4 Camera3DComponent::getViewMatrix() const {
@@ -28,28 +29,39 @@ glm::mat4 Camera3DComponent::getViewMatrix() const {
     return glm::mat4(1.0f);
 }
 
+// The setters leave the version alone when nothing changes, so scenes can
+// set the camera every frame without invalidating the picking cache.
 void Camera3DComponent::setFov(float fovDegrees) {
+    if (fovDegrees == m_fov) {
+        return;
+    }
     m_fov = fovDegrees;
     recalculateProjection();
 }
 
 void Camera3DComponent::setAspectRatio(float aspectRatio) {
+    if (aspectRatio == m_aspectRatio) {
+        return;
+    }
     m_aspectRatio = aspectRatio;
     recalculateProjection();
 }
 
 void Camera3DComponent::setLookAtTarget(const glm::vec3& target) {
+    if (target == m_lookAtTarget) {
+        return;
+    }
     m_lookAtTarget = target;
+    ++m_version;
 }
 
 void Camera3DComponent::applyFovZoom(float scrollDeltaY) {
+    if (scrollDeltaY == 0.0f) {
+        return;
+    }
     float zoomSpeed = 5.0f;
 
-    m_fov -= scrollDeltaY * zoomSpeed;
-
     float minFov = 10.0f;
     float maxFov = 90.0f;
-    m_fov = glm::clamp(m_fov, minFov, maxFov);
-
-    recalculateProjection();
+    setFov(glm::clamp(m_fov - scrollDeltaY * zoomSpeed, minFov, maxFov));
 }
\ No newline at end of file
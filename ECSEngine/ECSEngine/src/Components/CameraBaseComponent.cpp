@@ -4,17 +4,24 @@
 CameraBaseComponent::CameraBaseComponent(GameObject* owner, float nearPlane, float farPlane)
     : Component(owner),
     m_nearPlane(nearPlane), m_farPlane(farPlane),
-    m_projectionMatrix(1.0f)
+    m_projectionMatrix(1.0f),
+    m_version(0)
 {
 
 }
 
 void CameraBaseComponent::setNearPlane(float near) {
+    if (near == m_nearPlane) {
+        return;
+    }
     m_nearPlane = near;
     recalculateProjection();
 }
 
 void CameraBaseComponent::setFarPlane(float far) {
+    if (far == m_farPlane) {
+        return;
+    }
     m_farPlane = far;
     recalculateProjection();
 }
\ No newline at end of file
@@ -16,6 +16,11 @@ public:
 
     const glm::mat4& getProjectionMatrix() const { return m_projectionMatrix; }
 
+    // Bumped whenever the projection or any non-transform view parameter
+    // changes; setting a parameter to its current value does not count.
+    // Transform changes are tracked by TransformComponent::getVersion.
+    unsigned int getVersion() const { return m_version; }
+
 
     void setNearPlane(float near);
     void setFarPlane(float far);
@@ -26,4 +31,5 @@ protected:
     float m_nearPlane;
     float m_farPlane;
     glm::mat4 m_projectionMatrix;
+    unsigned int m_version;
 };
\ No newline at end of file
@@ -1,5 +1,6 @@
 #include "Components/MeshComponent.h"
 #include "Core/GameObject.h"
+#include "Core/PickingManager.h"
 #include <iostream>
 
 
@@ -18,5 +19,19 @@ MeshComponent::MeshComponent(GameObject* owner, std::shared_ptr<Mesh> mesh)
     if (!m_mesh) {
         std::cerr << "WARNING: MeshComponent created with a null Mesh pointer for owner: " << (owner ? owner->getName() : "nullptr") << std::endl;
     }
-    std::cout << "MeshComponent created with existing mesh: " << (m_mesh ? m_mesh->getName() : "NULL") << " for owner: " << (owner ? owner->getName() : "nullptr") << std::endl;
+}
+
+void MeshComponent::setMesh(std::shared_ptr<Mesh> mesh) {
+    m_mesh = std::move(mesh);
+    onMeshChanged();
+}
+
+void MeshComponent::onMeshChanged() {
+    if (!m_gameObject || !m_gameObject->getTransform()) {
+        return;
+    }
+    int proxyId = m_gameObject->getTransform()->getPickingProxy();
+    if (proxyId >= 0) {
+        PickingManager::getInstance().onTransformChanged(proxyId);
+    }
 }
\ No newline at end of file
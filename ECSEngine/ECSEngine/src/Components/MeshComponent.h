@@ -15,6 +15,10 @@ public:
     virtual ~MeshComponent() = default;
 
     std::shared_ptr<Mesh> getMesh() const { return m_mesh; }
+    // Swaps the mesh and refreshes the owner's picking bounds.
+    void setMesh(std::shared_ptr<Mesh> mesh);
+    // Call after regenerating the current mesh in place.
+    void onMeshChanged();
 
 private:
     std::shared_ptr<Mesh> m_mesh;
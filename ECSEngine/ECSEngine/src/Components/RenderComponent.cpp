@@ -2,10 +2,13 @@
 #include <GL/glew.h>
 #include "RenderComponent.h"
 #include "Core/GameObject.h"
+#include "Core/AssetManager.h"
+#include "Core/SpriteBatch.h"
 #include <iostream> 
 
 RenderComponent::RenderComponent(GameObject* owner, std::shared_ptr<Shader> shader)
-    : Component(owner), m_shader(shader), m_mesh(nullptr), m_objectColor(1.0f, 1.0f, 1.0f, 0.5f) 
+    : Component(owner), m_shader(shader), m_mesh(nullptr), m_objectColor(1.0f, 1.0f, 1.0f, 0.5f), m_uvRect(0.0f, 0.0f, 1.0f, 1.0f),
+    m_activeFeatures(SHADER_FEATURE_NONE), m_alphaCutoff(0.0f) 
 {
 
 }
@@ -19,24 +22,57 @@ void RenderComponent::Init() {
 void RenderComponent::Update(float deltaTime) {
 }
 
+uint32_t RenderComponent::getShaderFeatures() const {
+    uint32_t features = SHADER_FEATURE_NONE;
+    if (m_texture) {
+        features |= SHADER_FEATURE_HAS_TEXTURE;
+    }
+    if (m_alphaCutoff > 0.0f) {
+        features |= SHADER_FEATURE_ALPHA_TEST;
+    }
+    return features;
+}
+
+const std::shared_ptr<Shader>& RenderComponent::getActiveShader() {
+    uint32_t features = getShaderFeatures();
+    if (!m_activeShader || features != m_activeFeatures) {
+        m_activeShader = AssetManager::getInstance().getShaderVariant(m_shader, features);
+        m_activeFeatures = features;
+    }
+    return m_activeShader;
+}
+
 void RenderComponent::Render(const glm::mat4& view, const glm::mat4& projection, const glm::mat4& model) {
+    // 2D quads are collected and drawn in runs; Scene::Render flushes the last one.
+    SpriteBatch& spriteBatch = SpriteBatch::getInstance();
+    if (m_shader && m_mesh) {
+        spriteBatch.setCamera(view, projection);
+        if (spriteBatch.add(m_shader, getShaderFeatures(), m_mesh.get(), m_texture.get(), model, m_objectColor, m_uvRect, m_alphaCutoff)) {
+            return;
+        }
+    }
+    spriteBatch.flush();
+
     if (m_shader) {
-        m_shader->use();
+        const std::shared_ptr<Shader>& shader = getActiveShader();
+        shader->use();
 
-        m_shader->setMat4("model", model);
-        m_shader->setMat4("view", view);
-        m_shader->setMat4("projection", projection);
+        shader->setMat4("model", model);
+        shader->setMat4("view", view);
+        shader->setMat4("projection", projection);
 
-        m_shader->setVec4("objectColor", m_objectColor);
+        shader->setVec4("objectColor", m_objectColor);
+        shader->setVec4("uvRect", m_uvRect);
+        if (m_alphaCutoff > 0.0f) {
+            shader->setFloat("alphaCutoff", m_alphaCutoff);
+        }
 
         if (m_texture) {
             glActiveTexture(GL_TEXTURE0);
             m_texture->bind();
-            m_shader->setInt("texture_diffuse1", 0);
-            m_shader->setInt("hasTexture", 1);
+            shader->setInt("texture_diffuse1", 0);
         }
         else {
-            m_shader->setInt("hasTexture", 0);
             glBindTexture(GL_TEXTURE_2D, 0);
         }
 
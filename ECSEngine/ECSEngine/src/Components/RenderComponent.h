@@ -3,6 +3,7 @@
 #include "Core/Shader.h"
 #include "Core/Texture.h"
 #include "Core/Mesh.h"
+#include "Core/TextureAtlas.h"
 #include <glm/glm.hpp>
 #include "../Core/GameObject.h"
 
@@ -17,13 +18,27 @@ public:
     void Render(const glm::mat4& view, const glm::mat4& projection, const glm::mat4& model);
 
     void setMesh(std::shared_ptr<Mesh> mesh) { m_mesh = mesh; }
-    void setTexture(std::shared_ptr<Texture> texture) { m_texture = texture; }
+    void setTexture(std::shared_ptr<Texture> texture) { m_texture = texture; m_uvRect = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f); }
+    void setSprite(const AtlasSprite& sprite) { m_texture = sprite.texture; m_uvRect = sprite.uvRect; }
     void setObjectColor(const glm::vec4& color) { m_objectColor = color; }
+    // Fragments with alpha below the cutoff are discarded; 0 disables the test.
+    void setAlphaCutoff(float cutoff) { m_alphaCutoff = cutoff; }
+    float getAlphaCutoff() const { return m_alphaCutoff; }
+    const std::shared_ptr<Shader>& getShader() const { return m_shader; }
+
+    // ShaderFeature bits implied by the current texture and alpha cutoff.
+    uint32_t getShaderFeatures() const;
+    // The variant of the shader specialized for getShaderFeatures().
+    const std::shared_ptr<Shader>& getActiveShader();
     std::shared_ptr<Mesh> m_mesh;
     std::shared_ptr<Texture> m_texture;
     glm::vec4 m_objectColor;
+    glm::vec4 m_uvRect;
 
 
 private:
     std::shared_ptr<Shader> m_shader;
+    std::shared_ptr<Shader> m_activeShader;
+    uint32_t m_activeFeatures;
+    float m_alphaCutoff;
 };
\ No newline at end of file
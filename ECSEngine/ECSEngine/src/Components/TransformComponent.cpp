@@ -12,11 +12,22 @@ TransformComponent::TransformComponent(GameObject* owner)
     m_localRotation(1.0f, 0.0f, 0.0f, 0.0f),
     m_localScale(1.0f, 1.0f, 1.0f),
     m_worldMatrix(1.0f),
-    m_isDirty(true)
+    m_isDirty(true),
+    m_interpolationEnabled(false),
+    m_previousPosition(0.0f, 0.0f, 0.0f),
+    m_previousRotation(1.0f, 0.0f, 0.0f, 0.0f),
+    m_previousScale(1.0f, 1.0f, 1.0f),
+    m_pickingProxy(-1),
+    m_version(0)
 {
 }
 
 void TransformComponent::setLocalPosition(const glm::vec3& pos) {
+    // Scenes often re-set an unchanged position every frame; don't dirty the
+    // hierarchy or the picking cache for that.
+    if (pos == m_localPosition) {
+        return;
+    }
     m_localPosition = pos;
     invalidateWorldMatrix();
 }
@@ -27,6 +38,9 @@ void TransformComponent::setLocalRotation(const glm::quat& rot) {
 }
 
 void TransformComponent::setLocalScale(const glm::vec3& scale) {
+    if (scale == m_localScale) {
+        return;
+    }
     m_localScale = scale;
     invalidateWorldMatrix();
 }
@@ -73,6 +87,49 @@ const glm::mat4& TransformComponent::getWorldMatrix() {
     return m_worldMatrix;
 }
 
+void TransformComponent::setInterpolationEnabled(bool enabled) {
+    m_interpolationEnabled = enabled;
+    m_previousPosition = m_localPosition;
+    m_previousRotation = m_localRotation;
+    m_previousScale = m_localScale;
+}
+
+void TransformComponent::storePreviousState() {
+    if (!m_interpolationEnabled) return;
+
+    m_previousPosition = m_localPosition;
+    m_previousRotation = m_localRotation;
+    m_previousScale = m_localScale;
+}
+
+bool TransformComponent::isInterpolatedInHierarchy() const {
+    for (GameObject* obj = m_gameObject; obj; obj = obj->m_parent) {
+        if (obj->getTransform()->m_interpolationEnabled) {
+            return true;
+        }
+    }
+    return false;
+}
+
+glm::mat4 TransformComponent::getInterpolatedWorldMatrix(float alpha) {
+    if (alpha >= 1.0f || !isInterpolatedInHierarchy()) {
+        return getWorldMatrix();
+    }
+
+    glm::mat4 localMatrix = getLocalMatrix();
+    if (m_interpolationEnabled) {
+        glm::vec3 position = glm::mix(m_previousPosition, m_localPosition, alpha);
+        glm::quat rotation = glm::slerp(m_previousRotation, m_localRotation, alpha);
+        glm::vec3 scale = glm::mix(m_previousScale, m_localScale, alpha);
+        localMatrix = glm::translate(glm::mat4(1.0f), position) * glm::toMat4(rotation) * glm::scale(glm::mat4(1.0f), scale);
+    }
+
+    if (m_gameObject && m_gameObject->m_parent) {
+        return m_gameObject->m_parent->getTransform()->getInterpolatedWorldMatrix(alpha) * localMatrix;
+    }
+    return localMatrix;
+}
+
 void TransformComponent::calculateWorldMatrix() {
     glm::mat4 localMatrix = getLocalMatrix();
 
@@ -92,10 +149,15 @@ void TransformComponent::calculateWorldMatrix() {
 }
 
 void TransformComponent::invalidateWorldMatrix() {
+    ++m_version;
     if (m_isDirty) return;
 
     m_isDirty = true;
 
+    if (m_pickingProxy >= 0) {
+        PickingManager::getInstance().onTransformChanged(m_pickingProxy);
+    }
+
     if (m_gameObject) { 
         for (const auto& childUniquePtr : m_gameObject->getChildren()) {
             if (childUniquePtr) {
@@ -30,8 +30,19 @@ public:
 
     const glm::mat4& getWorldMatrix();
 
+    void setInterpolationEnabled(bool enabled);
+    bool isInterpolationEnabled() const { return m_interpolationEnabled; }
+    void storePreviousState();
+    glm::mat4 getInterpolatedWorldMatrix(float alpha);
+
+    void setPickingProxy(int proxyId) { m_pickingProxy = proxyId; }
+    int getPickingProxy() const { return m_pickingProxy; }
+
     void invalidateWorldMatrix();
 
+    // Incremented every time the transform is invalidated.
+    unsigned int getVersion() const { return m_version; }
+
     bool m_isDirty;
     glm::vec3 getLocalEulerAnglesDegrees() const;
     void calculateWorldAABB(glm::vec3& outMin, glm::vec3& outMax);
@@ -43,5 +54,14 @@ private:
 
     glm::mat4 m_worldMatrix;
 
+    bool m_interpolationEnabled;
+    glm::vec3 m_previousPosition;
+    glm::quat m_previousRotation;
+    glm::vec3 m_previousScale;
+
+    int m_pickingProxy;
+    unsigned int m_version;
+
     void calculateWorldMatrix();
+    bool isInterpolatedInHierarchy() const;
 };
\ No newline at end of file
@@ -0,0 +1,70 @@
+#include "Core/AssetArchive.h"
+#include "Core/AssetId.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+bool AssetArchiveView::parse(const void* data, size_t size) {
+    header = nullptr;
+    entries = nullptr;
+    names = nullptr;
+    base = static_cast<const unsigned char*>(data);
+
+    if (!data || size < sizeof(AssetArchiveHeader)) {
+        std::cerr << "ERROR::ASSETARCHIVE: File too small for header." << std::endl;
+        return false;
+    }
+
+    const AssetArchiveHeader* candidate = static_cast<const AssetArchiveHeader*>(data);
+    if (std::memcmp(candidate->magic, kAssetArchiveMagic, sizeof(kAssetArchiveMagic)) != 0) {
+        std::cerr << "ERROR::ASSETARCHIVE: Bad magic." << std::endl;
+        return false;
+    }
+    if (candidate->version != kAssetArchiveVersion) {
+        std::cerr << "ERROR::ASSETARCHIVE: Unsupported version " << candidate->version << "." << std::endl;
+        return false;
+    }
+
+    uint64_t tableEnd = sizeof(AssetArchiveHeader) + static_cast<uint64_t>(candidate->entryCount) * sizeof(AssetArchiveEntry);
+    if (tableEnd > size || candidate->namesOffset < tableEnd || candidate->namesOffset > size || candidate->namesSize > size - candidate->namesOffset) {
+        std::cerr << "ERROR::ASSETARCHIVE: Entry table or names out of range." << std::endl;
+        return false;
+    }
+
+    const AssetArchiveEntry* table = reinterpret_cast<const AssetArchiveEntry*>(candidate + 1);
+    for (uint32_t i = 0; i < candidate->entryCount; ++i) {
+        const AssetArchiveEntry& entry = table[i];
+        bool valid = entry.offset <= size && entry.storedSize <= size - entry.offset
+            && static_cast<uint64_t>(entry.nameOffset) + entry.nameLength <= candidate->namesSize
+            && (i == 0 || table[i - 1].id < entry.id);
+        if (entry.compression == static_cast<uint32_t>(AssetArchiveCompression::None)) {
+            valid = valid && entry.storedSize == entry.size;
+        }
+        else if (entry.compression != static_cast<uint32_t>(AssetArchiveCompression::LZ4)) {
+            valid = false;
+        }
+        if (!valid) {
+            std::cerr << "ERROR::ASSETARCHIVE: Entry " << i << " is invalid." << std::endl;
+            return false;
+        }
+    }
+
+    header = candidate;
+    entries = table;
+    names = reinterpret_cast<const char*>(base + candidate->namesOffset);
+    return true;
+}
+
+const AssetArchiveEntry* AssetArchiveView::find(std::string_view path) const {
+    if (!header) {
+        return nullptr;
+    }
+    AssetId id = hashAssetName(path);
+    const AssetArchiveEntry* end = entries + header->entryCount;
+    const AssetArchiveEntry* entry = std::lower_bound(entries, end, id,
+        [](const AssetArchiveEntry& candidate, AssetId value) { return candidate.id < value; });
+    if (entry == end || entry->id != id || getName(*entry) != path) {
+        return nullptr;
+    }
+    return entry;
+}
\ No newline at end of file
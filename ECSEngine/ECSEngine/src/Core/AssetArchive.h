@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// On-disk layout of packed asset archives (.epak), produced by the
+// AssetPacker tool. The entry table is sorted by the hashed path so lookups
+// are a binary search; every blob starts on a kAssetArchiveAlignment
+// boundary so uncompressed entries can be used straight from the mapping.
+//
+//   AssetArchiveHeader
+//   AssetArchiveEntry[entryCount]
+//   path strings (not terminated)
+//   blobs...
+
+constexpr char kAssetArchiveMagic[4] = { 'E', 'P', 'A', 'K' };
+constexpr uint32_t kAssetArchiveVersion = 1;
+constexpr uint32_t kAssetArchiveAlignment = 64;
+constexpr const char* kAssetArchiveExtension = ".epak";
+
+enum class AssetArchiveCompression : uint32_t {
+    None = 0,
+    LZ4 = 1
+};
+
+struct AssetArchiveHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t entryCount;
+    uint32_t reserved;
+    uint64_t namesOffset;
+    uint64_t namesSize;
+};
+
+struct AssetArchiveEntry {
+    // hashAssetName of the normalized path.
+    uint64_t id;
+    uint64_t offset;
+    uint64_t storedSize;
+    uint64_t size;
+    uint32_t nameOffset;
+    uint32_t nameLength;
+    uint32_t compression;
+    uint32_t reserved;
+};
+
+// Non-owning view over an archive held in memory (usually a MappedFile).
+struct AssetArchiveView {
+    const AssetArchiveHeader* header = nullptr;
+    const AssetArchiveEntry* entries = nullptr;
+    const char* names = nullptr;
+    const unsigned char* base = nullptr;
+
+    // Validates the header, the entry table and every entry's range.
+    bool parse(const void* data, size_t size);
+
+    // path must already be normalized ('/'-separated, no "./").
+    const AssetArchiveEntry* find(std::string_view path) const;
+    std::string_view getName(const AssetArchiveEntry& entry) const { return std::string_view(names + entry.nameOffset, entry.nameLength); }
+    const unsigned char* getData(const AssetArchiveEntry& entry) const { return base + entry.offset; }
+};
\ No newline at end of file
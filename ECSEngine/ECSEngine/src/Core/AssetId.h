@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+// 64-bit FNV-1a hash of an asset path. Usable at compile time, so hot code can
+// keep its asset references as constexpr AssetRef constants and never touch
+// the path string when looking an asset up.
+using AssetId = uint64_t;
+
+constexpr uint64_t kAssetIdOffsetBasis = 14695981039346656037ull;
+constexpr uint64_t kAssetIdPrime = 1099511628211ull;
+
+constexpr AssetId hashAssetName(std::string_view name, AssetId seed = kAssetIdOffsetBasis) {
+    AssetId hash = seed;
+    for (char c : name) {
+        hash ^= static_cast<uint8_t>(c);
+        hash *= kAssetIdPrime;
+    }
+    return hash;
+}
+
+// Continues the hash as if "|" + name had been appended, so combining ids
+// gives the same result as hashing the joined key string.
+constexpr AssetId appendAssetName(AssetId id, std::string_view name) {
+    return hashAssetName(name, (id ^ static_cast<uint8_t>('|')) * kAssetIdPrime);
+}
+
+// A path together with its precomputed id. Converts implicitly from string
+// literals and strings; declare it constexpr to hash at compile time.
+struct AssetRef {
+    AssetId id;
+    std::string_view path;
+
+    constexpr AssetRef(const char* assetPath) : id(hashAssetName(assetPath)), path(assetPath) {}
+    constexpr AssetRef(std::string_view assetPath) : id(hashAssetName(assetPath)), path(assetPath) {}
+    AssetRef(const std::string& assetPath) : id(hashAssetName(assetPath)), path(assetPath) {}
+};
\ No newline at end of file
@@ -1,56 +1,373 @@
 #include "Core/AssetManager.h"
 #include "Core/Shader.h" 
 #include "Core/Texture.h"
+#include "Core/TextureAtlas.h"
+#include "Core/Mesh.h"
+#include "Core/VirtualFileSystem.h"
 
 #include <iostream>
+#include <thread>
+#include <algorithm>
+#include <filesystem>
 
-std::shared_ptr<Shader> AssetManager::getShader(const std::string& vertexPath, const std::string& fragmentPath, const std::string& geometryPath) {
-    std::string shaderKey = vertexPath + "|" + fragmentPath;
-    if (!geometryPath.empty()) {
-        shaderKey += "|" + geometryPath;
+void AssetManager::Init() {
+    if (!m_placeholderTexture) {
+        const unsigned char white[4] = { 255, 255, 255, 255 };
+        GLuint placeholderID = Texture::createStorage(1, 1, 4);
+        glBindTexture(GL_TEXTURE_2D, placeholderID);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, 1, 1, GL_RGBA, GL_UNSIGNED_BYTE, white);
+        glGenerateMipmap(GL_TEXTURE_2D);
+        glBindTexture(GL_TEXTURE_2D, 0);
+        m_placeholderTexture = std::make_shared<Texture>(placeholderID, "PlaceholderTexture", 1, 1, "placeholder");
     }
 
-    auto it = m_shaders.find(shaderKey);
-    if (it != m_shaders.end()) {
+    unsigned int hardwareThreads = std::thread::hardware_concurrency();
+    m_textureLoader.start(std::max(1u, std::min(4u, hardwareThreads > 1 ? hardwareThreads - 1 : 1u)));
+}
+
+void AssetManager::Shutdown() {
+    m_fileWatcher.stop();
+    m_textureLoader.stop();
+    clearAllAssets();
+    m_placeholderTexture = nullptr;
+}
+
+void AssetManager::processTextureUploads() {
+    m_textureLoader.processUploads(m_textureUploadBudget);
+    if (m_fileWatcher.isRunning()) {
+        applyHotReload();
+    }
+    trimCache();
+}
+
+void AssetManager::enableHotReload(bool enabled, const std::vector<std::string>& directories) {
+    if (!enabled) {
+        m_fileWatcher.stop();
+        return;
+    }
+    if (m_fileWatcher.start(directories)) {
+        std::cout << "AssetManager: hot reload enabled." << std::endl;
+    }
+}
 
-        return it->second;
+// Runs between frames on the render thread, so a rebuilt program or texture is
+// swapped into the shared asset before anything draws with it again.
+void AssetManager::applyHotReload() {
+    std::vector<std::string> changedPaths;
+    m_fileWatcher.pollChanges(changedPaths);
+    if (changedPaths.empty()) {
+        return;
     }
 
-    std::shared_ptr<Shader> newShader = std::make_shared<Shader>(vertexPath.c_str(), fragmentPath.c_str(), geometryPath.c_str());
+    std::lock_guard<std::mutex> lock(m_textureMutex);
+    for (const std::string& changedPath : changedPaths) {
+        std::vector<AssetId> failedVariants;
+        m_shaders.forEach([&](AssetId id, std::shared_ptr<Shader>& shader) {
+            if (!shader) {
+                // A variant that failed before gets another chance.
+                failedVariants.push_back(id);
+                return;
+            }
+            if (!shader->dependsOn(changedPath)) {
+                return;
+            }
+            Shader rebuilt(shader->getVertexPath(), shader->getFragmentPath(), shader->getGeometryPath(), shader->getFeatures());
+            if (rebuilt.ID == 0) {
+                std::cerr << "ERROR: AssetManager: Reloading " << getAssetName(id) << " failed, keeping the previous version." << std::endl;
+                return;
+            }
+            shader->swapProgram(rebuilt);
+            std::cout << "AssetManager: reloaded shader " << getAssetName(id) << std::endl;
+        });
+        for (AssetId id : failedVariants) {
+            m_shaders.erase(id);
+        }
+
+        m_textures.forEach([&](AssetId, CacheEntry<Texture>& entry) {
+            const std::shared_ptr<Texture>& texture = entry.asset;
+            if (std::filesystem::path(texture->getPath()).lexically_normal().generic_string() != changedPath) {
+                return;
+            }
+            // The loader decodes off-thread and only replaces the GL texture
+            // once the new pixels are uploaded; a decode error leaves it alone.
+            if (m_textureLoader.isRunning()) {
+                m_textureLoader.enqueue(texture);
+            }
+            else if (!texture->reload()) {
+                std::cerr << "ERROR: AssetManager: Reloading " << changedPath << " failed, keeping the previous version." << std::endl;
+            }
+        });
+    }
+}
+
+void AssetManager::setMemoryBudget(size_t gpuBytes, size_t cpuBytes) {
+    m_gpuBudget = gpuBytes;
+    m_cpuBudget = cpuBytes;
+}
+
+// Refreshes the totals and the last-used frame of every asset that is still
+// referenced. Only when a budget is exceeded are the unreferenced assets
+// sorted and released, oldest first.
+void AssetManager::trimCache() {
+    std::lock_guard<std::mutex> lock(m_textureMutex);
+    ++m_cacheFrame;
+
+    AssetCacheStats& stats = m_cacheStats;
+    stats.gpuBudget = m_gpuBudget;
+    stats.cpuBudget = m_cpuBudget;
+    stats.gpuBytes = 0;
+    stats.cpuBytes = 0;
+    stats.unreferencedCount = 0;
+    stats.unreferencedBytes = 0;
+    stats.textureCount = m_textures.size();
+    stats.meshCount = m_meshes.size();
+    stats.atlasCount = m_atlases.size();
+
+    auto account = [this, &stats](uint64_t& lastUsedFrame, bool referenced, size_t gpuBytes, size_t cpuBytes) {
+        stats.gpuBytes += gpuBytes;
+        stats.cpuBytes += cpuBytes;
+        if (referenced) {
+            lastUsedFrame = m_cacheFrame;
+        }
+        else {
+            ++stats.unreferencedCount;
+            stats.unreferencedBytes += gpuBytes + cpuBytes;
+        }
+    };
+
+    m_textures.forEach([&account](AssetId, CacheEntry<Texture>& entry) {
+        account(entry.lastUsedFrame, entry.asset.use_count() > 1, entry.asset->getByteSize(), 0);
+    });
+    m_atlases.forEach([&account](AssetId, CacheEntry<TextureAtlas>& entry) {
+        const std::shared_ptr<Texture>& texture = entry.asset->getTexture();
+        bool referenced = entry.asset.use_count() > 1 || (texture && texture.use_count() > 1);
+        account(entry.lastUsedFrame, referenced, texture ? texture->getByteSize() : 0, 0);
+    });
+    m_meshes.forEach([&account](AssetId, CacheEntry<Mesh>& entry) {
+        size_t bytes = entry.asset->getByteSize();
+        account(entry.lastUsedFrame, entry.asset.use_count() > 1, bytes, bytes);
+    });
+
+    if ((stats.gpuBytes <= m_gpuBudget && stats.cpuBytes <= m_cpuBudget) || stats.unreferencedCount == 0) {
+        return;
+    }
+
+    enum class Kind { Texture, Atlas, Mesh };
+    struct Candidate {
+        Kind kind;
+        AssetId id;
+        uint64_t lastUsedFrame;
+        size_t gpuBytes;
+        size_t cpuBytes;
+    };
+    std::vector<Candidate> candidates;
+    candidates.reserve(stats.unreferencedCount);
+    m_textures.forEach([&candidates](AssetId id, CacheEntry<Texture>& entry) {
+        if (entry.asset.use_count() == 1) {
+            candidates.push_back({ Kind::Texture, id, entry.lastUsedFrame, entry.asset->getByteSize(), 0 });
+        }
+    });
+    m_atlases.forEach([&candidates](AssetId id, CacheEntry<TextureAtlas>& entry) {
+        const std::shared_ptr<Texture>& texture = entry.asset->getTexture();
+        if (entry.asset.use_count() == 1 && (!texture || texture.use_count() == 1)) {
+            candidates.push_back({ Kind::Atlas, id, entry.lastUsedFrame, texture ? texture->getByteSize() : 0, 0 });
+        }
+    });
+    m_meshes.forEach([&candidates](AssetId id, CacheEntry<Mesh>& entry) {
+        if (entry.asset.use_count() == 1) {
+            size_t bytes = entry.asset->getByteSize();
+            candidates.push_back({ Kind::Mesh, id, entry.lastUsedFrame, bytes, bytes });
+        }
+    });
+    std::sort(candidates.begin(), candidates.end(), [](const Candidate& a, const Candidate& b) {
+        return a.lastUsedFrame < b.lastUsedFrame;
+    });
+
+    for (const Candidate& candidate : candidates) {
+        if (stats.gpuBytes <= m_gpuBudget && stats.cpuBytes <= m_cpuBudget) {
+            break;
+        }
+        switch (candidate.kind) {
+        case Kind::Texture: m_textures.erase(candidate.id); --stats.textureCount; break;
+        case Kind::Atlas: m_atlases.erase(candidate.id); --stats.atlasCount; break;
+        case Kind::Mesh: m_meshes.erase(candidate.id); --stats.meshCount; break;
+        }
+        stats.gpuBytes -= candidate.gpuBytes;
+        stats.cpuBytes -= candidate.cpuBytes;
+        --stats.unreferencedCount;
+        stats.unreferencedBytes -= candidate.gpuBytes + candidate.cpuBytes;
+        ++stats.evictedCount;
+        stats.evictedBytes += candidate.gpuBytes + candidate.cpuBytes;
+    }
+}
+
+void AssetManager::internAssetName(AssetId id, std::string name) {
+    auto result = m_assetNames.emplace(id, name);
+    if (!result.second && result.first->second != name) {
+        std::cerr << "ERROR: AssetManager: Asset id collision between '" << result.first->second << "' and '" << name << "'" << std::endl;
+    }
+}
+
+std::string AssetManager::getAssetName(AssetId id) const {
+    auto it = m_assetNames.find(id);
+    return it != m_assetNames.end() ? it->second : std::string();
+}
+
+std::shared_ptr<Shader> AssetManager::getShader(const AssetRef& vertexPath, const AssetRef& fragmentPath, const AssetRef& geometryPath, uint32_t features) {
+    AssetId shaderId = appendAssetName(vertexPath.id, fragmentPath.path);
+    if (!geometryPath.path.empty()) {
+        shaderId = appendAssetName(shaderId, geometryPath.path);
+    }
+    if (features != 0) {
+        shaderId = appendAssetName(shaderId, std::string_view(reinterpret_cast<const char*>(&features), sizeof(features)));
+    }
+
+    std::lock_guard<std::mutex> lock(m_textureMutex);
+    if (std::shared_ptr<Shader>* cached = m_shaders.find(shaderId)) {
+        return *cached;
+    }
+
+    std::string vertexSource(vertexPath.path);
+    std::string fragmentSource(fragmentPath.path);
+    std::string geometrySource(geometryPath.path);
+    std::string shaderKey = vertexSource + "|" + fragmentSource;
+    if (!geometrySource.empty()) {
+        shaderKey += "|" + geometrySource;
+    }
+    if (features != 0) {
+        shaderKey += "#" + std::to_string(features);
+    }
+
+    std::shared_ptr<Shader> newShader = std::make_shared<Shader>(vertexSource, fragmentSource, geometrySource, features);
 
     if (newShader->getID() == 0) { 
         std::cerr << "ERROR: AssetManager: Failed to load shader: " << shaderKey << std::endl;
+        if (features != 0) {
+            // Remember the failure so a broken variant isn't recompiled every frame.
+            internAssetName(shaderId, shaderKey);
+            m_shaders.insert(shaderId, nullptr);
+        }
         return nullptr;
     }
 
-    m_shaders[shaderKey] = newShader;
+    internAssetName(shaderId, shaderKey);
+    m_shaders.insert(shaderId, newShader);
     return newShader;
 }
 
-std::shared_ptr<Texture> AssetManager::getTexture(const std::string& path, const std::string& type) {
-    std::string textureKey = path;
-    if (!type.empty()) {
-        textureKey += "|" + type;
+std::shared_ptr<Shader> AssetManager::getShaderVariant(const std::shared_ptr<Shader>& base, uint32_t features) {
+    if (!base) {
+        return nullptr;
+    }
+    features |= base->getFeatures();
+    if (features == base->getFeatures()) {
+        return base;
+    }
+
+    std::shared_ptr<Shader> variant = getShader(base->getVertexPath(), base->getFragmentPath(), base->getGeometryPath(), features);
+    return variant ? variant : base;
+}
+
+std::string AssetManager::resolveTexturePath(const std::string& path) const {
+    if (!m_preferCookedTextures || Texture::isCookedTexturePath(path)) {
+        return path;
+    }
+
+    std::filesystem::path cookedPath(path);
+    cookedPath.replace_extension(kTextureContainerExtension);
+    if (VirtualFileSystem::getInstance().exists(cookedPath.generic_string())) {
+        return cookedPath.generic_string();
+    }
+    return path;
+}
+
+std::shared_ptr<Texture> AssetManager::getTexture(const AssetRef& path, std::string_view type) {
+    AssetId textureId = type.empty() ? path.id : appendAssetName(path.id, type);
+
+    std::lock_guard<std::mutex> lock(m_textureMutex);
+    if (CacheEntry<Texture>* cached = m_textures.find(textureId)) {
+        if (!cached->asset->hasLoadFailed()) {
+            cached->lastUsedFrame = m_cacheFrame;
+            return cached->asset;
+        }
+        // The earlier asynchronous load failed; requesting it again retries.
+        m_textures.erase(textureId);
+    }
+
+    std::string textureType(type);
+    std::string textureKey(path.path);
+    if (!textureType.empty()) {
+        textureKey += "|" + textureType;
     }
+    std::string sourcePath = resolveTexturePath(std::string(path.path));
 
-    auto it = m_textures.find(textureKey);
-    if (it != m_textures.end()) {
-        return it->second;
+    if (m_asyncTextureLoading && m_placeholderTexture && m_textureLoader.isRunning()) {
+        std::shared_ptr<Texture> pendingTexture = std::make_shared<Texture>(sourcePath, textureType, *m_placeholderTexture);
+        internAssetName(textureId, textureKey);
+        m_textures.insert(textureId, { pendingTexture, m_cacheFrame });
+        m_textureLoader.enqueue(pendingTexture);
+        return pendingTexture;
     }
 
-    std::shared_ptr<Texture> newTexture = std::make_shared<Texture>(path.c_str(), type.c_str());
+    std::shared_ptr<Texture> newTexture = std::make_shared<Texture>(sourcePath.c_str(), textureType.c_str());
 
     if (newTexture->getID() == 0) {
         std::cerr << "ERROR: AssetManager: Failed to load texture: " << textureKey << std::endl;
         return nullptr;
     }
 
-    m_textures[textureKey] = newTexture;
+    internAssetName(textureId, textureKey);
+    m_textures.insert(textureId, { newTexture, m_cacheFrame });
     return newTexture;
 }
 
+std::shared_ptr<TextureAtlas> AssetManager::buildTextureAtlas(const std::string& name, const std::vector<std::string>& spritePaths, const std::vector<AtlasImage>& images) {
+    std::shared_ptr<TextureAtlas> atlas = std::make_shared<TextureAtlas>(name);
+    if (!atlas->build(spritePaths, images)) {
+        std::cerr << "ERROR: AssetManager: Failed to build texture atlas: " << name << std::endl;
+        return nullptr;
+    }
+
+    AssetId atlasId = hashAssetName(name);
+    std::lock_guard<std::mutex> lock(m_textureMutex);
+    internAssetName(atlasId, name);
+    m_atlases.insert(atlasId, { atlas, m_cacheFrame });
+    return atlas;
+}
+
+std::shared_ptr<TextureAtlas> AssetManager::getTextureAtlas(const AssetRef& name) {
+    std::lock_guard<std::mutex> lock(m_textureMutex);
+    CacheEntry<TextureAtlas>* cached = m_atlases.find(name.id);
+    if (!cached) {
+        return nullptr;
+    }
+    cached->lastUsedFrame = m_cacheFrame;
+    return cached->asset;
+}
+
+std::shared_ptr<Mesh> AssetManager::getMesh(const AssetRef& name, const std::function<std::shared_ptr<Mesh>()>& factory) {
+    std::lock_guard<std::mutex> lock(m_textureMutex);
+    if (CacheEntry<Mesh>* cached = m_meshes.find(name.id)) {
+        cached->lastUsedFrame = m_cacheFrame;
+        return cached->asset;
+    }
+
+    std::shared_ptr<Mesh> newMesh = factory ? factory() : nullptr;
+    if (!newMesh) {
+        std::cerr << "ERROR: AssetManager: Failed to create mesh: " << name.path << std::endl;
+        return nullptr;
+    }
+
+    internAssetName(name.id, std::string(name.path));
+    m_meshes.insert(name.id, { newMesh, m_cacheFrame });
+    return newMesh;
+}
+
 void AssetManager::clearAllAssets() {
     std::cout << "AssetManager: Clearing all cached assets." << std::endl;
     m_shaders.clear();
+    std::lock_guard<std::mutex> lock(m_textureMutex);
     m_textures.clear();
+    m_atlases.clear();
+    m_meshes.clear();
 }
\ No newline at end of file
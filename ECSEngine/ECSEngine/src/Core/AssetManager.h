@@ -1,11 +1,36 @@
 #pragma once
 
 #include <string>
-#include <map>
+#include <unordered_map>
 #include <memory>
 #include <iostream>
+#include <functional>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include "Core/AsyncTextureLoader.h"
+#include "Core/AssetId.h"
+#include "Core/AssetTable.h"
+#include "Core/FileWatcher.h"
+#include "Core/TextureAtlas.h"
 class Shader;
 class Texture;
+class Mesh;
+
+struct AssetCacheStats {
+    size_t gpuBytes = 0;
+    size_t cpuBytes = 0;
+    size_t gpuBudget = 0;
+    size_t cpuBudget = 0;
+    size_t textureCount = 0;
+    size_t meshCount = 0;
+    size_t atlasCount = 0;
+    // Assets nobody outside the cache holds on to; these are the eviction candidates.
+    size_t unreferencedCount = 0;
+    size_t unreferencedBytes = 0;
+    uint64_t evictedCount = 0;
+    uint64_t evictedBytes = 0;
+};
 
 class AssetManager {
 private:
@@ -16,8 +41,40 @@ private:
     AssetManager(const AssetManager&) = delete;
     AssetManager& operator=(const AssetManager&) = delete;
 
-    std::map<std::string, std::shared_ptr<Shader>> m_shaders;
-    std::map<std::string, std::shared_ptr<Texture>> m_textures;
+    template<typename T>
+    struct CacheEntry {
+        std::shared_ptr<T> asset;
+        // Last frame on which something besides the cache referenced the asset.
+        uint64_t lastUsedFrame = 0;
+    };
+
+    AssetTable<std::shared_ptr<Shader>> m_shaders;
+    AssetTable<CacheEntry<Texture>> m_textures;
+    std::mutex m_textureMutex;
+    AssetTable<CacheEntry<TextureAtlas>> m_atlases;
+    AssetTable<CacheEntry<Mesh>> m_meshes;
+
+    // Every key that has been hashed into one of the tables, for debugging
+    // and collision checks. Only written when an asset is created.
+    std::unordered_map<AssetId, std::string> m_assetNames;
+
+    uint64_t m_cacheFrame = 0;
+    size_t m_gpuBudget = 512 * 1024 * 1024;
+    size_t m_cpuBudget = 256 * 1024 * 1024;
+    AssetCacheStats m_cacheStats;
+
+    AsyncTextureLoader m_textureLoader;
+    std::shared_ptr<Texture> m_placeholderTexture;
+    bool m_asyncTextureLoading = true;
+    size_t m_textureUploadBudget = 4 * 1024 * 1024;
+    bool m_preferCookedTextures = true;
+
+    FileWatcher m_fileWatcher;
+
+    std::string resolveTexturePath(const std::string& path) const;
+    void trimCache();
+    void applyHotReload();
+    void internAssetName(AssetId id, std::string name);
 
 public:
     static AssetManager& getInstance() {
@@ -25,8 +82,54 @@ public:
         return instance;
     }
 
-    std::shared_ptr<Shader> getShader(const std::string& vertexPath, const std::string& fragmentPath, const std::string& geometryPath = "");
-    std::shared_ptr<Texture> getTexture(const std::string& path, const std::string& type = "");
+    // Creates the placeholder texture and starts the decode workers. Needs a
+    // current GL context.
+    void Init();
+    void Shutdown();
+
+    // Streams decoded textures to the GPU within the per-frame byte budget,
+    // swaps in hot-reloaded assets and evicts unreferenced assets while the
+    // cache is over budget. Call once per frame on the render thread.
+    void processTextureUploads();
+
+    // Watches the given directories and reloads shaders (including anything
+    // they #include) and textures whose files change. A shader that fails to
+    // compile keeps its previous program.
+    void enableHotReload(bool enabled, const std::vector<std::string>& directories = { "res" });
+    bool isHotReloadEnabled() const { return m_fileWatcher.isRunning(); }
+
+    // Unreferenced textures, atlases and meshes are released least recently
+    // used first once either total goes over its budget. Assets still held
+    // elsewhere are never evicted, so the totals can exceed the budget.
+    void setMemoryBudget(size_t gpuBytes, size_t cpuBytes);
+    const AssetCacheStats& getCacheStats() const { return m_cacheStats; }
+
+    void setAsyncTextureLoading(bool enabled) { m_asyncTextureLoading = enabled; }
+    void setTextureUploadBudget(size_t bytesPerFrame) { m_textureUploadBudget = bytesPerFrame; }
+    // When set, "foo.png" is loaded from "foo.etex" if the cooker produced one.
+    void setPreferCookedTextures(bool enabled) { m_preferCookedTextures = enabled; }
+    size_t getPendingTextureCount() const { return m_textureLoader.getPendingCount(); }
+
+    // Lookups hash the paths and never allocate; pass constexpr AssetRefs to
+    // skip the hashing as well.
+    std::shared_ptr<Shader> getShader(const AssetRef& vertexPath, const AssetRef& fragmentPath, const AssetRef& geometryPath = AssetRef(""), uint32_t features = 0);
+    // The permutation of base's sources with the given ShaderFeature bits
+    // added, compiled on first use. Falls back to base if it fails to build.
+    std::shared_ptr<Shader> getShaderVariant(const std::shared_ptr<Shader>& base, uint32_t features);
+    // With async loading enabled the returned texture samples a placeholder
+    // until its pixels have been uploaded (see Texture::isLoaded).
+    std::shared_ptr<Texture> getTexture(const AssetRef& path, std::string_view type = "");
+
+    // Packs the given images into one shared texture. Building an atlas under
+    // an existing name replaces it. Loads synchronously.
+    std::shared_ptr<TextureAtlas> buildTextureAtlas(const std::string& name, const std::vector<std::string>& spritePaths, const std::vector<AtlasImage>& images = {});
+    std::shared_ptr<TextureAtlas> getTextureAtlas(const AssetRef& name);
+
+    // Shared meshes, created by factory on first request.
+    std::shared_ptr<Mesh> getMesh(const AssetRef& name, const std::function<std::shared_ptr<Mesh>()>& factory);
+
+    // The key string an id was created from, or "" if it is unknown.
+    std::string getAssetName(AssetId id) const;
 
     void clearAllAssets();
 };
\ No newline at end of file
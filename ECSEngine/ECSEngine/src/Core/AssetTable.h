@@ -0,0 +1,139 @@
+#pragma once
+
+#include "Core/AssetId.h"
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+// Open-addressing hash table keyed by AssetId with linear probing. Lookups
+// never allocate; erased slots become tombstones that are dropped on the next
+// rehash.
+template<typename T>
+class AssetTable {
+public:
+    AssetTable() = default;
+
+    T* find(AssetId id) {
+        if (m_slots.empty()) {
+            return nullptr;
+        }
+        size_t index = findSlot(id);
+        return m_slots[index].state == SlotState::Occupied ? &m_slots[index].value : nullptr;
+    }
+
+    const T* find(AssetId id) const {
+        return const_cast<AssetTable*>(this)->find(id);
+    }
+
+    // Inserts or overwrites.
+    T& insert(AssetId id, T value) {
+        if ((m_count + m_tombstones + 1) * 4 > m_slots.size() * 3) {
+            rehash(m_slots.empty() ? kInitialCapacity : (m_count + 1) * 4 > m_slots.size() * 2 ? m_slots.size() * 2 : m_slots.size());
+        }
+
+        size_t index = findSlot(id);
+        Slot& slot = m_slots[index];
+        if (slot.state != SlotState::Occupied) {
+            if (slot.state == SlotState::Deleted) {
+                --m_tombstones;
+            }
+            slot.state = SlotState::Occupied;
+            slot.id = id;
+            ++m_count;
+        }
+        slot.value = std::move(value);
+        return slot.value;
+    }
+
+    bool erase(AssetId id) {
+        if (m_slots.empty()) {
+            return false;
+        }
+        Slot& slot = m_slots[findSlot(id)];
+        if (slot.state != SlotState::Occupied) {
+            return false;
+        }
+        slot.state = SlotState::Deleted;
+        slot.value = T();
+        --m_count;
+        ++m_tombstones;
+        return true;
+    }
+
+    void clear() {
+        m_slots.clear();
+        m_count = 0;
+        m_tombstones = 0;
+    }
+
+    size_t size() const { return m_count; }
+    bool empty() const { return m_count == 0; }
+
+    template<typename Fn>
+    void forEach(Fn&& fn) {
+        for (Slot& slot : m_slots) {
+            if (slot.state == SlotState::Occupied) {
+                fn(slot.id, slot.value);
+            }
+        }
+    }
+
+private:
+    enum class SlotState : uint8_t { Empty, Occupied, Deleted };
+
+    struct Slot {
+        AssetId id = 0;
+        SlotState state = SlotState::Empty;
+        T value = T();
+    };
+
+    static constexpr size_t kInitialCapacity = 64;
+
+    std::vector<Slot> m_slots;
+    size_t m_count = 0;
+    size_t m_tombstones = 0;
+
+    // FNV's low bits are weak on short keys; fold the high half in.
+    static size_t mix(AssetId id) {
+        return static_cast<size_t>(id ^ (id >> 32));
+    }
+
+    // Returns the slot holding id, or the slot it should be inserted into
+    // (the first tombstone on the probe path if there is one).
+    size_t findSlot(AssetId id) const {
+        const size_t mask = m_slots.size() - 1;
+        size_t index = mix(id) & mask;
+        size_t firstTombstone = m_slots.size();
+        while (true) {
+            const Slot& slot = m_slots[index];
+            if (slot.state == SlotState::Empty) {
+                return firstTombstone != m_slots.size() ? firstTombstone : index;
+            }
+            if (slot.state == SlotState::Occupied && slot.id == id) {
+                return index;
+            }
+            if (slot.state == SlotState::Deleted && firstTombstone == m_slots.size()) {
+                firstTombstone = index;
+            }
+            index = (index + 1) & mask;
+        }
+    }
+
+    void rehash(size_t capacity) {
+        std::vector<Slot> old = std::move(m_slots);
+        m_slots.clear();
+        m_slots.resize(capacity);
+        m_count = 0;
+        m_tombstones = 0;
+        for (Slot& slot : old) {
+            if (slot.state == SlotState::Occupied) {
+                Slot& target = m_slots[findSlot(slot.id)];
+                target.id = slot.id;
+                target.state = SlotState::Occupied;
+                target.value = std::move(slot.value);
+                ++m_count;
+            }
+        }
+    }
+};
\ No newline at end of file
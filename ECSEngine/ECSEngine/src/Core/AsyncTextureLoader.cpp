@@ -0,0 +1,292 @@
+#include "Core/AsyncTextureLoader.h"
+#include "Core/Texture.h"
+#include "Core/MemoryTracker.h"
+#include "stb_image.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+AsyncTextureLoader::AsyncTextureLoader()
+    : m_stopping(false), m_pbo(0), m_pboBytes(0), m_pendingCount(0)
+{
+}
+
+AsyncTextureLoader::~AsyncTextureLoader() {
+    stop();
+}
+
+void AsyncTextureLoader::start(unsigned int workerCount) {
+    if (isRunning()) {
+        return;
+    }
+
+    m_stopping = false;
+    workerCount = std::max(1u, workerCount);
+    for (unsigned int i = 0; i < workerCount; ++i) {
+        m_workers.emplace_back(&AsyncTextureLoader::workerMain, this);
+    }
+    std::cout << "AsyncTextureLoader started with " << workerCount << " worker thread(s)." << std::endl;
+}
+
+// Joins the workers and drops everything that has not been uploaded yet. GL
+// objects are released, so call this while the context is still current.
+void AsyncTextureLoader::stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_decodeMutex);
+        m_stopping = true;
+        m_decodeQueue.clear();
+    }
+    m_decodeCondition.notify_all();
+    for (std::thread& worker : m_workers) {
+        worker.join();
+    }
+    m_workers.clear();
+
+    {
+        std::lock_guard<std::mutex> lock(m_readyMutex);
+        for (UploadJob& job : m_readyQueue) {
+            m_uploads.push_back(std::move(job));
+        }
+        m_readyQueue.clear();
+    }
+    for (UploadJob& job : m_uploads) {
+        releaseJob(job);
+    }
+    m_uploads.clear();
+    m_pendingCount = 0;
+
+    if (m_pbo != 0) {
+        glDeleteBuffers(1, &m_pbo);
+        m_pbo = 0;
+        if (m_pboBytes != 0) {
+            MemoryTracker::getInstance().recordFree(MemoryDomain::Gpu, MemoryTag::Texture, m_pboBytes);
+            m_pboBytes = 0;
+        }
+    }
+}
+
+void AsyncTextureLoader::enqueue(const std::shared_ptr<Texture>& texture) {
+    if (!texture) {
+        return;
+    }
+    ++m_pendingCount;
+    {
+        std::lock_guard<std::mutex> lock(m_decodeMutex);
+        m_decodeQueue.push_back({ texture, texture->getPath() });
+    }
+    m_decodeCondition.notify_one();
+}
+
+void AsyncTextureLoader::workerMain() {
+    while (true) {
+        DecodeRequest request;
+        {
+            std::unique_lock<std::mutex> lock(m_decodeMutex);
+            m_decodeCondition.wait(lock, [this]() { return m_stopping || !m_decodeQueue.empty(); });
+            if (m_stopping) {
+                return;
+            }
+            request = std::move(m_decodeQueue.front());
+            m_decodeQueue.pop_front();
+        }
+
+        if (request.texture.expired()) {
+            --m_pendingCount;
+            continue;
+        }
+
+        UploadJob job;
+        job.texture = request.texture;
+        job.path = request.path;
+
+        if (Texture::isCookedTexturePath(request.path)) {
+            job.cookedFile = VirtualFileSystem::getInstance().open(request.path);
+            if (!job.cookedFile.isValid() || !job.container.parse(job.cookedFile.data, job.cookedFile.size)) {
+                std::cerr << "ERROR::TEXTURE::FAILED_TO_LOAD: " << request.path << " - invalid cooked texture" << std::endl;
+                job.cookedFile = FileView();
+                job.failed = true;
+            }
+            else {
+                job.width = job.container.header->width;
+                job.height = job.container.header->height;
+            }
+
+            std::lock_guard<std::mutex> lock(m_readyMutex);
+            m_readyQueue.push_back(std::move(job));
+            continue;
+        }
+
+        FileView file = VirtualFileSystem::getInstance().open(request.path);
+        if (file.isValid()) {
+            job.pixels = stbi_load_from_memory(file.data, static_cast<int>(file.size), &job.width, &job.height, &job.channels, 0);
+        }
+        if (!job.pixels) {
+            std::cerr << "ERROR::TEXTURE::FAILED_TO_LOAD: " << request.path << " - " << (file.isValid() ? stbi_failure_reason() : "file not found") << std::endl;
+            job.failed = true;
+        }
+
+        std::lock_guard<std::mutex> lock(m_readyMutex);
+        m_readyQueue.push_back(std::move(job));
+    }
+}
+
+void AsyncTextureLoader::processUploads(size_t byteBudget) {
+    {
+        std::lock_guard<std::mutex> lock(m_readyMutex);
+        while (!m_readyQueue.empty()) {
+            m_uploads.push_back(std::move(m_readyQueue.front()));
+            m_readyQueue.pop_front();
+        }
+    }
+
+    bool madeProgress = false;
+    while (!m_uploads.empty() && (byteBudget > 0 || !madeProgress)) {
+        UploadJob& job = m_uploads.front();
+        std::shared_ptr<Texture> texture = job.texture.lock();
+        if (!texture) {
+            releaseJob(job);
+            m_uploads.pop_front();
+            --m_pendingCount;
+            continue;
+        }
+
+        // A texture that already has pixels keeps them when a reload fails.
+        if (job.failed) {
+            if (!texture->isLoaded()) {
+                texture->markLoadFailed();
+            }
+            m_uploads.pop_front();
+            --m_pendingCount;
+            continue;
+        }
+
+        size_t bytesUploaded = 0;
+        bool finished = job.cookedFile.isValid() ? uploadLevels(job, byteBudget, bytesUploaded) : uploadRows(job, byteBudget, bytesUploaded);
+        byteBudget -= std::min(byteBudget, bytesUploaded);
+        madeProgress = true;
+
+        if (finished && job.textureID == 0) {
+            // Cooked texture in a format this context can't sample.
+            if (!texture->isLoaded()) {
+                texture->markLoadFailed();
+            }
+            releaseJob(job);
+            m_uploads.pop_front();
+            --m_pendingCount;
+            continue;
+        }
+
+        if (finished) {
+            if (!job.cookedFile.isValid()) {
+                glBindTexture(GL_TEXTURE_2D, job.textureID);
+                glGenerateMipmap(GL_TEXTURE_2D);
+                glBindTexture(GL_TEXTURE_2D, 0);
+            }
+
+            size_t byteSize = 0;
+            if (job.cookedFile.isValid()) {
+                for (uint32_t level = 0; level < job.container.header->mipCount; ++level) {
+                    byteSize += static_cast<size_t>(job.container.mips[level].size);
+                }
+            }
+            else {
+                byteSize = Texture::estimateByteSize(job.width, job.height, job.channels, true);
+            }
+            texture->finishLoading(job.textureID, job.width, job.height, byteSize);
+            job.textureID = 0;
+            releaseJob(job);
+            m_uploads.pop_front();
+            --m_pendingCount;
+        }
+    }
+}
+
+// Copies as many whole rows as fit in the budget (at least one) into the
+// unpack buffer and from there into the texture. Returns true once every row
+// has been uploaded.
+bool AsyncTextureLoader::uploadRows(UploadJob& job, size_t byteBudget, size_t& outBytesUploaded) {
+    if (job.textureID == 0) {
+        job.textureID = Texture::createStorage(job.width, job.height, job.channels);
+    }
+    if (m_pbo == 0) {
+        glGenBuffers(1, &m_pbo);
+    }
+
+    const size_t rowBytes = static_cast<size_t>(job.width) * job.channels;
+    int rows = static_cast<int>(std::max<size_t>(1, byteBudget / rowBytes));
+    rows = std::min(rows, job.height - job.rowsUploaded);
+    const size_t bytes = rowBytes * rows;
+    const unsigned char* source = job.pixels + rowBytes * job.rowsUploaded;
+
+    GLenum format;
+    GLint internalFormat;
+    Texture::getFormatForChannels(job.channels, format, internalFormat);
+
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, m_pbo);
+    // Orphan the previous contents so the driver never has to wait for the
+    // last copy out of this buffer.
+    glBufferData(GL_PIXEL_UNPACK_BUFFER, bytes, nullptr, GL_STREAM_DRAW);
+    if (bytes != m_pboBytes) {
+        if (m_pboBytes != 0) {
+            MemoryTracker::getInstance().recordFree(MemoryDomain::Gpu, MemoryTag::Texture, m_pboBytes);
+        }
+        MemoryTracker::getInstance().recordAllocation(MemoryDomain::Gpu, MemoryTag::Texture, bytes);
+        m_pboBytes = bytes;
+    }
+    const void* uploadSource = nullptr;
+    if (void* mapped = glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, bytes, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT)) {
+        std::memcpy(mapped, source, bytes);
+        glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);
+    }
+    else {
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        uploadSource = source;
+    }
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glBindTexture(GL_TEXTURE_2D, job.textureID);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, job.rowsUploaded, job.width, rows, format, GL_UNSIGNED_BYTE, uploadSource);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+
+    job.rowsUploaded += rows;
+    outBytesUploaded = bytes;
+    return job.rowsUploaded >= job.height;
+}
+
+// Uploads whole mip levels, smallest budget unit being one level. The data is
+// read straight out of the mapping, so there is nothing to stage.
+bool AsyncTextureLoader::uploadLevels(UploadJob& job, size_t byteBudget, size_t& outBytesUploaded) {
+    outBytesUploaded = 0;
+    if (job.textureID == 0) {
+        job.textureID = Texture::createContainerStorage(job.container);
+        if (job.textureID == 0) {
+            return true;
+        }
+    }
+
+    const uint32_t mipCount = job.container.header->mipCount;
+    while (job.levelsUploaded < mipCount) {
+        size_t levelBytes = static_cast<size_t>(job.container.mips[job.levelsUploaded].size);
+        if (outBytesUploaded > 0 && outBytesUploaded + levelBytes > byteBudget) {
+            break;
+        }
+        Texture::uploadContainerLevel(job.textureID, job.container, job.levelsUploaded);
+        outBytesUploaded += levelBytes;
+        ++job.levelsUploaded;
+    }
+    return job.levelsUploaded >= mipCount;
+}
+
+void AsyncTextureLoader::releaseJob(UploadJob& job) {
+    job.cookedFile = FileView();
+    if (job.pixels) {
+        stbi_image_free(job.pixels);
+        job.pixels = nullptr;
+    }
+    if (job.textureID != 0) {
+        glDeleteTextures(1, &job.textureID);
+        job.textureID = 0;
+    }
+}
\ No newline at end of file
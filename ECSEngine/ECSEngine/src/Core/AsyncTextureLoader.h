@@ -0,0 +1,84 @@
+#pragma once
+
+#include <GL/glew.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Core/TextureContainer.h"
+#include "Core/VirtualFileSystem.h"
+
+class Texture;
+
+// Decodes image files on worker threads and streams the pixels into GL
+// textures from the render thread, a few rows at a time, through a pixel
+// unpack buffer. Cooked .etex files are only mapped by the workers (through
+// the VirtualFileSystem) and uploaded one mip level at a time. Textures keep
+// their placeholder until the upload is complete, or are marked as failed.
+class AsyncTextureLoader {
+public:
+    AsyncTextureLoader();
+    ~AsyncTextureLoader();
+
+    void start(unsigned int workerCount);
+    void stop();
+    bool isRunning() const { return !m_workers.empty(); }
+
+    void enqueue(const std::shared_ptr<Texture>& texture);
+
+    // Must be called on the thread that owns the GL context. Uploads at most
+    // byteBudget bytes, but always makes progress on at least one row.
+    void processUploads(size_t byteBudget);
+
+    size_t getPendingCount() const { return m_pendingCount.load(); }
+
+private:
+    struct DecodeRequest {
+        std::weak_ptr<Texture> texture;
+        std::string path;
+    };
+
+    struct UploadJob {
+        std::weak_ptr<Texture> texture;
+        std::string path;
+        unsigned char* pixels = nullptr;
+        int width = 0;
+        int height = 0;
+        int channels = 0;
+        GLuint textureID = 0;
+        int rowsUploaded = 0;
+        // Decoding failed; the render thread only marks the texture.
+        bool failed = false;
+
+        // Valid only for cooked textures.
+        FileView cookedFile;
+        TextureContainerView container;
+        uint32_t levelsUploaded = 0;
+    };
+
+    std::vector<std::thread> m_workers;
+    std::mutex m_decodeMutex;
+    std::condition_variable m_decodeCondition;
+    std::deque<DecodeRequest> m_decodeQueue;
+    bool m_stopping;
+
+    std::mutex m_readyMutex;
+    std::deque<UploadJob> m_readyQueue;
+
+    // Only touched by the render thread.
+    std::deque<UploadJob> m_uploads;
+    GLuint m_pbo;
+    size_t m_pboBytes;
+
+    std::atomic<size_t> m_pendingCount;
+
+    void workerMain();
+    bool uploadRows(UploadJob& job, size_t byteBudget, size_t& outBytesUploaded);
+    bool uploadLevels(UploadJob& job, size_t byteBudget, size_t& outBytesUploaded);
+    void releaseJob(UploadJob& job);
+};
\ No newline at end of file
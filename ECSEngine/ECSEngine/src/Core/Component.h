@@ -9,6 +9,7 @@ public:
     virtual ~Component() = default;
     virtual void Init() {}
     virtual void Update(float dt) {}
+    virtual void FixedUpdate(float fixedDeltaTime) {}
     virtual void Render() {}
 
     GameObject* getOwner() const { return m_gameObject; }
@@ -0,0 +1,256 @@
+#include "Core/DebugDraw2D.h"
+#include "Core/AssetManager.h"
+#include "Core/FrameStats.h"
+#include "Core/MemoryTracker.h"
+#include "Core/Shader.h"
+#include "Core/VirtualFileSystem.h"
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include <glm/ext/matrix_clip_space.hpp>
+#include <algorithm>
+#include <cstddef>
+#include <iostream>
+
+static constexpr size_t kInitialVertexCapacity = 6 * 4096;
+
+DebugDraw2D::DebugDraw2D()
+    : m_vao(0), m_vbo(0), m_atlasTexture(0), m_atlasHeight(0), m_vboCapacity(0), m_glyphs(),
+    m_whiteUV(0.0f), m_lineHeight(0.0f), m_ascent(0.0f) {
+}
+
+DebugDraw2D::~DebugDraw2D() {
+    shutdown();
+}
+
+bool DebugDraw2D::init(const std::string& fontPath, unsigned int pixelSize) {
+    MemoryTagScope memoryScope(MemoryTag::Renderer);
+    if (!buildAtlas(fontPath, pixelSize)) {
+        return false;
+    }
+
+    m_shader = AssetManager::getInstance().getShader("res/shaders/debug2d.vert", "res/shaders/debug2d.frag");
+    if (!m_shader || m_shader->getID() == 0) {
+        std::cerr << "ERROR::DEBUGDRAW2D: Could not create shader (res/shaders/debug2d.vert, res/shaders/debug2d.frag)." << std::endl;
+        shutdown();
+        return false;
+    }
+
+    glGenVertexArrays(1, &m_vao);
+    glGenBuffers(1, &m_vbo);
+    glBindVertexArray(m_vao);
+    glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
+    glEnableVertexAttribArray(0);
+    glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, x));
+    glEnableVertexAttribArray(1);
+    glVertexAttribPointer(1, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)offsetof(Vertex, u));
+    glEnableVertexAttribArray(2);
+    glVertexAttribPointer(2, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), (void*)offsetof(Vertex, color));
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+
+    m_vertices.reserve(kInitialVertexCapacity);
+    return true;
+}
+
+void DebugDraw2D::shutdown() {
+    if (m_vbo != 0) {
+        glDeleteBuffers(1, &m_vbo);
+        MemoryTracker::getInstance().recordFree(MemoryDomain::Gpu, MemoryTag::Renderer, m_vboCapacity * sizeof(Vertex));
+        m_vbo = 0;
+        m_vboCapacity = 0;
+    }
+    if (m_vao != 0) {
+        glDeleteVertexArrays(1, &m_vao);
+        m_vao = 0;
+    }
+    if (m_atlasTexture != 0) {
+        glDeleteTextures(1, &m_atlasTexture);
+        MemoryTracker::getInstance().recordFree(MemoryDomain::Gpu, MemoryTag::Font, static_cast<size_t>(kAtlasWidth) * m_atlasHeight);
+        m_atlasTexture = 0;
+    }
+    m_shader = nullptr;
+    m_vertices.clear();
+}
+
+// Shelf-packs printable ASCII into one single-channel texture. The first
+// texels of the atlas are left white for untextured shapes.
+bool DebugDraw2D::buildAtlas(const std::string& fontPath, unsigned int pixelSize) {
+    FileView fontFile = VirtualFileSystem::getInstance().open(fontPath);
+    FT_Library library;
+    if (!fontFile.isValid() || FT_Init_FreeType(&library)) {
+        std::cerr << "ERROR::DEBUGDRAW2D: Could not load font '" << fontPath << "'." << std::endl;
+        return false;
+    }
+    FT_Face face;
+    if (FT_New_Memory_Face(library, fontFile.data, static_cast<FT_Long>(fontFile.size), 0, &face)) {
+        std::cerr << "ERROR::DEBUGDRAW2D: Could not load font '" << fontPath << "'." << std::endl;
+        FT_Done_FreeType(library);
+        return false;
+    }
+    FT_Set_Pixel_Sizes(face, 0, pixelSize);
+    m_ascent = static_cast<float>(face->size->metrics.ascender >> 6);
+    m_lineHeight = static_cast<float>(face->size->metrics.height >> 6);
+
+    struct Placement {
+        int x, y, width, height;
+        std::vector<unsigned char> bitmap;
+    };
+    std::vector<Placement> placements(kGlyphCount);
+    const int padding = 1;
+    int penX = 2 + padding;
+    int penY = 0;
+    int rowHeight = 2;
+    for (int i = 0; i < kGlyphCount; ++i) {
+        Glyph& glyph = m_glyphs[i];
+        glyph = Glyph();
+        if (FT_Load_Char(face, static_cast<FT_ULong>(kFirstGlyph + i), FT_LOAD_RENDER)) {
+            continue;
+        }
+        const FT_GlyphSlot slot = face->glyph;
+        Placement& placement = placements[i];
+        placement.width = static_cast<int>(slot->bitmap.width);
+        placement.height = static_cast<int>(slot->bitmap.rows);
+        if (penX + placement.width > kAtlasWidth) {
+            penX = 0;
+            penY += rowHeight + padding;
+            rowHeight = 0;
+        }
+        placement.x = penX;
+        placement.y = penY;
+        for (int row = 0; row < placement.height; ++row) {
+            const unsigned char* source = slot->bitmap.buffer + row * slot->bitmap.pitch;
+            placement.bitmap.insert(placement.bitmap.end(), source, source + placement.width);
+        }
+        penX += placement.width + padding;
+        rowHeight = std::max(rowHeight, placement.height);
+
+        glyph.size = glm::vec2(placement.width, placement.height);
+        glyph.bearing = glm::vec2(slot->bitmap_left, slot->bitmap_top);
+        glyph.advance = static_cast<float>(slot->advance.x >> 6);
+    }
+    FT_Done_Face(face);
+    FT_Done_FreeType(library);
+
+    m_atlasHeight = (penY + rowHeight + 3) & ~3;
+    std::vector<unsigned char> pixels(static_cast<size_t>(kAtlasWidth) * m_atlasHeight, 0);
+    for (int y = 0; y < 2; ++y) {
+        pixels[static_cast<size_t>(y) * kAtlasWidth] = 255;
+        pixels[static_cast<size_t>(y) * kAtlasWidth + 1] = 255;
+    }
+    for (int i = 0; i < kGlyphCount; ++i) {
+        const Placement& placement = placements[i];
+        for (int row = 0; row < placement.height; ++row) {
+            std::copy_n(placement.bitmap.data() + static_cast<size_t>(row) * placement.width, placement.width,
+                pixels.data() + static_cast<size_t>(placement.y + row) * kAtlasWidth + placement.x);
+        }
+        const glm::vec2 atlasSize(kAtlasWidth, m_atlasHeight);
+        m_glyphs[i].uvMin = glm::vec2(placement.x, placement.y) / atlasSize;
+        m_glyphs[i].uvMax = glm::vec2(placement.x + placement.width, placement.y + placement.height) / atlasSize;
+    }
+    m_whiteUV = glm::vec2(1.0f / kAtlasWidth, 1.0f / m_atlasHeight);
+
+    glGenTextures(1, &m_atlasTexture);
+    glBindTexture(GL_TEXTURE_2D, m_atlasTexture);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, kAtlasWidth, m_atlasHeight, 0, GL_RED, GL_UNSIGNED_BYTE, pixels.data());
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    MemoryTracker::getInstance().recordAllocation(MemoryDomain::Gpu, MemoryTag::Font, pixels.size());
+    return true;
+}
+
+uint32_t DebugDraw2D::packColor(const glm::vec4& color) {
+    glm::vec4 scaled = glm::clamp(color, 0.0f, 1.0f) * 255.0f + 0.5f;
+    return static_cast<uint32_t>(scaled.r) | (static_cast<uint32_t>(scaled.g) << 8)
+        | (static_cast<uint32_t>(scaled.b) << 16) | (static_cast<uint32_t>(scaled.a) << 24);
+}
+
+void DebugDraw2D::quad(float x0, float y0, float x1, float y1, const glm::vec2& uv0, const glm::vec2& uv1, uint32_t color) {
+    m_vertices.push_back({ x0, y0, uv0.x, uv0.y, color });
+    m_vertices.push_back({ x0, y1, uv0.x, uv1.y, color });
+    m_vertices.push_back({ x1, y1, uv1.x, uv1.y, color });
+    m_vertices.push_back({ x0, y0, uv0.x, uv0.y, color });
+    m_vertices.push_back({ x1, y1, uv1.x, uv1.y, color });
+    m_vertices.push_back({ x1, y0, uv1.x, uv0.y, color });
+}
+
+void DebugDraw2D::rect(float x, float y, float width, float height, const glm::vec4& color) {
+    quad(x, y, x + width, y + height, m_whiteUV, m_whiteUV, packColor(color));
+}
+
+float DebugDraw2D::text(float x, float y, std::string_view text, const glm::vec4& color) {
+    const uint32_t packed = packColor(color);
+    const float baseline = y + m_ascent;
+    float penX = x;
+    for (char c : text) {
+        int index = (c >= kFirstGlyph && c < kFirstGlyph + kGlyphCount) ? c - kFirstGlyph : '?' - kFirstGlyph;
+        const Glyph& glyph = m_glyphs[index];
+        if (glyph.size.x > 0.0f) {
+            float x0 = penX + glyph.bearing.x;
+            float y0 = baseline - glyph.bearing.y;
+            quad(x0, y0, x0 + glyph.size.x, y0 + glyph.size.y, glyph.uvMin, glyph.uvMax, packed);
+        }
+        penX += glyph.advance;
+    }
+    return penX - x;
+}
+
+float DebugDraw2D::measureText(std::string_view text) const {
+    float width = 0.0f;
+    for (char c : text) {
+        int index = (c >= kFirstGlyph && c < kFirstGlyph + kGlyphCount) ? c - kFirstGlyph : '?' - kFirstGlyph;
+        width += m_glyphs[index].advance;
+    }
+    return width;
+}
+
+void DebugDraw2D::flush(int windowWidth, int windowHeight) {
+    if (m_vertices.empty()) {
+        return;
+    }
+    if (!isInitialized()) {
+        m_vertices.clear();
+        return;
+    }
+
+    GLboolean depthTest = glIsEnabled(GL_DEPTH_TEST);
+    GLboolean cullFace = glIsEnabled(GL_CULL_FACE);
+    glDisable(GL_DEPTH_TEST);
+    glDisable(GL_CULL_FACE);
+
+    m_shader->use();
+    m_shader->setMat4("projection", glm::ortho(0.0f, static_cast<float>(windowWidth), static_cast<float>(windowHeight), 0.0f));
+    m_shader->setInt("atlas", 0);
+    glActiveTexture(GL_TEXTURE0);
+    glBindTexture(GL_TEXTURE_2D, m_atlasTexture);
+    FrameStats::getInstance().countStateChange();
+
+    glBindVertexArray(m_vao);
+    glBindBuffer(GL_ARRAY_BUFFER, m_vbo);
+    if (m_vertices.size() > m_vboCapacity) {
+        size_t capacity = std::max(m_vertices.size(), m_vboCapacity * 2);
+        MemoryTracker& tracker = MemoryTracker::getInstance();
+        if (m_vboCapacity != 0) {
+            tracker.recordFree(MemoryDomain::Gpu, MemoryTag::Renderer, m_vboCapacity * sizeof(Vertex));
+        }
+        tracker.recordAllocation(MemoryDomain::Gpu, MemoryTag::Renderer, capacity * sizeof(Vertex));
+        m_vboCapacity = capacity;
+    }
+    // Orphan last frame's storage so the upload never waits on the GPU.
+    glBufferData(GL_ARRAY_BUFFER, m_vboCapacity * sizeof(Vertex), nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, m_vertices.size() * sizeof(Vertex), m_vertices.data());
+    glDrawArrays(GL_TRIANGLES, 0, static_cast<GLsizei>(m_vertices.size()));
+    FrameStats::getInstance().countDrawCall(m_vertices.size() / 3);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    glBindVertexArray(0);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    m_shader->detach();
+
+    if (depthTest) glEnable(GL_DEPTH_TEST);
+    if (cullFace) glEnable(GL_CULL_FACE);
+    m_vertices.clear();
+}
\ No newline at end of file
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class Shader;
+
+// Immediate-mode 2D layer for debug overlays. Rectangles and ASCII text are
+// appended to one vertex buffer during the frame and drawn with a single
+// call in flush(). Coordinates are window pixels with the origin top left.
+class DebugDraw2D {
+public:
+    DebugDraw2D();
+    ~DebugDraw2D();
+
+    DebugDraw2D(const DebugDraw2D&) = delete;
+    DebugDraw2D& operator=(const DebugDraw2D&) = delete;
+
+    bool init(const std::string& fontPath, unsigned int pixelSize);
+    void shutdown();
+    bool isInitialized() const { return m_vao != 0; }
+
+    void rect(float x, float y, float width, float height, const glm::vec4& color);
+    // Returns the width of the drawn text.
+    float text(float x, float y, std::string_view text, const glm::vec4& color);
+    float measureText(std::string_view text) const;
+    float getLineHeight() const { return m_lineHeight; }
+
+    void flush(int windowWidth, int windowHeight);
+
+private:
+    struct Vertex {
+        float x, y;
+        float u, v;
+        uint32_t color;
+    };
+
+    struct Glyph {
+        glm::vec2 uvMin;
+        glm::vec2 uvMax;
+        glm::vec2 size;
+        glm::vec2 bearing;
+        float advance;
+    };
+
+    static constexpr int kFirstGlyph = 32;
+    static constexpr int kGlyphCount = 95;
+    static constexpr int kAtlasWidth = 512;
+
+    std::shared_ptr<Shader> m_shader;
+    GLuint m_vao;
+    GLuint m_vbo;
+    GLuint m_atlasTexture;
+    int m_atlasHeight;
+    size_t m_vboCapacity;
+    std::vector<Vertex> m_vertices;
+    Glyph m_glyphs[kGlyphCount];
+    glm::vec2 m_whiteUV;
+    float m_lineHeight;
+    float m_ascent;
+
+    bool buildAtlas(const std::string& fontPath, unsigned int pixelSize);
+    void quad(float x0, float y0, float x1, float y1, const glm::vec2& uv0, const glm::vec2& uv1, uint32_t color);
+    static uint32_t packColor(const glm::vec4& color);
+};
\ No newline at end of file
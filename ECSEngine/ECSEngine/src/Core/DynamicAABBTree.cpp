@@ -0,0 +1,252 @@
+#include "Core/DynamicAABBTree.h"
+#include <glm/gtx/component_wise.hpp>
+
+DynamicAABBTree::DynamicAABBTree(float margin)
+    : m_root(kNullNode), m_margin(margin)
+{
+}
+
+int DynamicAABBTree::allocateNode() {
+    int nodeId;
+    if (!m_freeList.empty()) {
+        nodeId = m_freeList.back();
+        m_freeList.pop_back();
+    }
+    else {
+        nodeId = static_cast<int>(m_nodes.size());
+        m_nodes.emplace_back();
+    }
+
+    Node& node = m_nodes[nodeId];
+    node.parent = kNullNode;
+    node.child1 = kNullNode;
+    node.child2 = kNullNode;
+    node.height = 0;
+    node.userData = -1;
+    return nodeId;
+}
+
+void DynamicAABBTree::freeNode(int nodeId) {
+    m_nodes[nodeId].height = -1;
+    m_freeList.push_back(nodeId);
+}
+
+void DynamicAABBTree::clear() {
+    m_nodes.clear();
+    m_freeList.clear();
+    m_root = kNullNode;
+}
+
+int DynamicAABBTree::createProxy(const glm::vec3& min, const glm::vec3& max, int userData) {
+    int proxyId = allocateNode();
+    m_nodes[proxyId].min = min - glm::vec3(m_margin);
+    m_nodes[proxyId].max = max + glm::vec3(m_margin);
+    m_nodes[proxyId].userData = userData;
+    insertLeaf(proxyId);
+    return proxyId;
+}
+
+void DynamicAABBTree::destroyProxy(int proxyId) {
+    removeLeaf(proxyId);
+    freeNode(proxyId);
+}
+
+bool DynamicAABBTree::moveProxy(int proxyId, const glm::vec3& min, const glm::vec3& max) {
+    Node& node = m_nodes[proxyId];
+    if (glm::all(glm::lessThanEqual(node.min, min)) && glm::all(glm::greaterThanEqual(node.max, max))) {
+        return false;
+    }
+
+    removeLeaf(proxyId);
+    m_nodes[proxyId].min = min - glm::vec3(m_margin);
+    m_nodes[proxyId].max = max + glm::vec3(m_margin);
+    insertLeaf(proxyId);
+    return true;
+}
+
+float DynamicAABBTree::surfaceArea(const glm::vec3& min, const glm::vec3& max) {
+    glm::vec3 d = max - min;
+    return 2.0f * (d.x * d.y + d.y * d.z + d.z * d.x);
+}
+
+bool DynamicAABBTree::rayHitsBox(const glm::vec3& origin, const glm::vec3& invDirection, const glm::vec3& min, const glm::vec3& max, float maxT) {
+    glm::vec3 t0 = (min - origin) * invDirection;
+    glm::vec3 t1 = (max - origin) * invDirection;
+    float tEnter = glm::compMax(glm::min(t0, t1));
+    float tExit = glm::compMin(glm::max(t0, t1));
+    return tEnter <= tExit && tExit >= 0.0f && tEnter <= maxT;
+}
+
+void DynamicAABBTree::insertLeaf(int leaf) {
+    if (m_root == kNullNode) {
+        m_root = leaf;
+        m_nodes[leaf].parent = kNullNode;
+        return;
+    }
+
+    const glm::vec3 leafMin = m_nodes[leaf].min;
+    const glm::vec3 leafMax = m_nodes[leaf].max;
+
+    // Descend towards the sibling that grows the tree's surface area the least.
+    int index = m_root;
+    while (!m_nodes[index].isLeaf()) {
+        const Node& node = m_nodes[index];
+        float area = surfaceArea(node.min, node.max);
+        float combinedArea = surfaceArea(glm::min(node.min, leafMin), glm::max(node.max, leafMax));
+
+        float cost = 2.0f * combinedArea;
+        float inheritanceCost = 2.0f * (combinedArea - area);
+
+        float childCost[2];
+        int children[2] = { node.child1, node.child2 };
+        for (int i = 0; i < 2; ++i) {
+            const Node& child = m_nodes[children[i]];
+            float enlarged = surfaceArea(glm::min(child.min, leafMin), glm::max(child.max, leafMax));
+            childCost[i] = child.isLeaf()
+                ? enlarged + inheritanceCost
+                : (enlarged - surfaceArea(child.min, child.max)) + inheritanceCost;
+        }
+
+        if (cost < childCost[0] && cost < childCost[1]) {
+            break;
+        }
+        index = childCost[0] < childCost[1] ? children[0] : children[1];
+    }
+
+    int sibling = index;
+    int oldParent = m_nodes[sibling].parent;
+    int newParent = allocateNode();
+    m_nodes[newParent].parent = oldParent;
+    m_nodes[newParent].min = glm::min(leafMin, m_nodes[sibling].min);
+    m_nodes[newParent].max = glm::max(leafMax, m_nodes[sibling].max);
+    m_nodes[newParent].height = m_nodes[sibling].height + 1;
+    m_nodes[newParent].child1 = sibling;
+    m_nodes[newParent].child2 = leaf;
+    m_nodes[sibling].parent = newParent;
+    m_nodes[leaf].parent = newParent;
+
+    if (oldParent != kNullNode) {
+        if (m_nodes[oldParent].child1 == sibling) {
+            m_nodes[oldParent].child1 = newParent;
+        }
+        else {
+            m_nodes[oldParent].child2 = newParent;
+        }
+    }
+    else {
+        m_root = newParent;
+    }
+
+    refitAncestors(m_nodes[leaf].parent);
+}
+
+void DynamicAABBTree::removeLeaf(int leaf) {
+    if (leaf == m_root) {
+        m_root = kNullNode;
+        return;
+    }
+
+    int parent = m_nodes[leaf].parent;
+    int grandParent = m_nodes[parent].parent;
+    int sibling = m_nodes[parent].child1 == leaf ? m_nodes[parent].child2 : m_nodes[parent].child1;
+
+    if (grandParent != kNullNode) {
+        if (m_nodes[grandParent].child1 == parent) {
+            m_nodes[grandParent].child1 = sibling;
+        }
+        else {
+            m_nodes[grandParent].child2 = sibling;
+        }
+        m_nodes[sibling].parent = grandParent;
+        freeNode(parent);
+        refitAncestors(grandParent);
+    }
+    else {
+        m_root = sibling;
+        m_nodes[sibling].parent = kNullNode;
+        freeNode(parent);
+    }
+}
+
+void DynamicAABBTree::refitAncestors(int nodeId) {
+    int index = nodeId;
+    while (index != kNullNode) {
+        index = balance(index);
+
+        Node& node = m_nodes[index];
+        const Node& child1 = m_nodes[node.child1];
+        const Node& child2 = m_nodes[node.child2];
+        node.height = 1 + std::max(child1.height, child2.height);
+        node.min = glm::min(child1.min, child2.min);
+        node.max = glm::max(child1.max, child2.max);
+
+        index = node.parent;
+    }
+}
+
+// Rotates the subtree rooted at iA when its children's heights differ by more
+// than one. Returns the index of the node now at the subtree's root.
+int DynamicAABBTree::balance(int iA) {
+    Node& A = m_nodes[iA];
+    if (A.isLeaf() || A.height < 2) {
+        return iA;
+    }
+
+    int iB = A.child1;
+    int iC = A.child2;
+    int heightDiff = m_nodes[iC].height - m_nodes[iB].height;
+
+    auto rotateUp = [this, iA](int iUp, int iOther) {
+        Node& a = m_nodes[iA];
+        Node& up = m_nodes[iUp];
+        int iF = up.child1;
+        int iG = up.child2;
+
+        up.child1 = iA;
+        up.parent = a.parent;
+        a.parent = iUp;
+
+        if (up.parent != kNullNode) {
+            if (m_nodes[up.parent].child1 == iA) {
+                m_nodes[up.parent].child1 = iUp;
+            }
+            else {
+                m_nodes[up.parent].child2 = iUp;
+            }
+        }
+        else {
+            m_root = iUp;
+        }
+
+        // Keep the taller grandchild under iUp, hand the shorter one to iA.
+        int iKeep = m_nodes[iF].height > m_nodes[iG].height ? iF : iG;
+        int iGive = iKeep == iF ? iG : iF;
+        up.child2 = iKeep;
+        if (a.child1 == iUp) {
+            a.child1 = iGive;
+        }
+        else {
+            a.child2 = iGive;
+        }
+        m_nodes[iGive].parent = iA;
+
+        const Node& other = m_nodes[iOther];
+        const Node& give = m_nodes[iGive];
+        const Node& keep = m_nodes[iKeep];
+        a.min = glm::min(other.min, give.min);
+        a.max = glm::max(other.max, give.max);
+        a.height = 1 + std::max(other.height, give.height);
+        up.min = glm::min(a.min, keep.min);
+        up.max = glm::max(a.max, keep.max);
+        up.height = 1 + std::max(a.height, keep.height);
+        return iUp;
+    };
+
+    if (heightDiff > 1) {
+        return rotateUp(iC, iB);
+    }
+    if (heightDiff < -1) {
+        return rotateUp(iB, iC);
+    }
+    return iA;
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <vector>
+#include <algorithm>
+#include <cassert>
+
+// Incrementally maintained bounding volume hierarchy. Leaves store "fat"
+// AABBs so small movements don't touch the tree; inserts and removals keep
+// it height-balanced with AVL-style rotations.
+class DynamicAABBTree {
+public:
+    static constexpr int kNullNode = -1;
+
+    DynamicAABBTree(float margin = 0.1f);
+
+    int createProxy(const glm::vec3& min, const glm::vec3& max, int userData);
+    void destroyProxy(int proxyId);
+    bool moveProxy(int proxyId, const glm::vec3& min, const glm::vec3& max);
+    void clear();
+
+    int getUserData(int proxyId) const { return m_nodes[proxyId].userData; }
+    int getHeight() const { return m_root == kNullNode ? 0 : m_nodes[m_root].height; }
+
+    // Callback signature: float(int userData, float maxT). It returns the new
+    // maximum distance, which lets closest-hit queries prune the traversal.
+    template<typename Callback>
+    void raycast(const glm::vec3& origin, const glm::vec3& direction, float maxT, Callback&& callback) const;
+
+private:
+    struct Node {
+        glm::vec3 min;
+        glm::vec3 max;
+        int parent;
+        int child1;
+        int child2;
+        int height;
+        int userData;
+
+        bool isLeaf() const { return child1 == kNullNode; }
+    };
+
+    std::vector<Node> m_nodes;
+    std::vector<int> m_freeList;
+    int m_root;
+    float m_margin;
+
+    int allocateNode();
+    void freeNode(int nodeId);
+    void insertLeaf(int leaf);
+    void removeLeaf(int leaf);
+    int balance(int nodeId);
+    void refitAncestors(int nodeId);
+
+    static float surfaceArea(const glm::vec3& min, const glm::vec3& max);
+    static bool rayHitsBox(const glm::vec3& origin, const glm::vec3& invDirection, const glm::vec3& min, const glm::vec3& max, float maxT);
+};
+
+template<typename Callback>
+void DynamicAABBTree::raycast(const glm::vec3& origin, const glm::vec3& direction, float maxT, Callback&& callback) const {
+    if (m_root == kNullNode) {
+        return;
+    }
+
+    const glm::vec3 invDirection = 1.0f / direction;
+
+    // A depth-first walk never holds more than height + 1 pending nodes. Deep
+    // trees spill into a heap stack instead of dropping subtrees.
+    constexpr int kInlineStackSize = 128;
+    int inlineStack[kInlineStackSize];
+    std::vector<int> heapStack;
+    const int stackSize = m_nodes[m_root].height + 2;
+    int* stack = inlineStack;
+    if (stackSize > kInlineStackSize) {
+        heapStack.resize(stackSize);
+        stack = heapStack.data();
+    }
+    int stackCount = 0;
+    stack[stackCount++] = m_root;
+
+    while (stackCount > 0) {
+        const Node& node = m_nodes[stack[--stackCount]];
+        if (!rayHitsBox(origin, invDirection, node.min, node.max, maxT)) {
+            continue;
+        }
+
+        if (node.isLeaf()) {
+            maxT = callback(node.userData, maxT);
+        }
+        else {
+            assert(stackCount + 2 <= stackSize);
+            stack[stackCount++] = node.child1;
+            stack[stackCount++] = node.child2;
+        }
+    }
+}
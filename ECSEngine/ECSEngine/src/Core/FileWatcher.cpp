@@ -0,0 +1,255 @@
+#include "Core/FileWatcher.h"
+#include <filesystem>
+#include <iostream>
+#include <memory>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+static std::string normalizePath(const std::filesystem::path& path) {
+    return path.lexically_normal().generic_string();
+}
+
+FileWatcher::FileWatcher()
+#ifdef _WIN32
+    : m_stopEvent(nullptr)
+#else
+    : m_inotifyDescriptor(-1), m_stopPipe{ -1, -1 }
+#endif
+{
+}
+
+FileWatcher::~FileWatcher() {
+    stop();
+}
+
+void FileWatcher::recordChange(const std::string& path) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_changes[path] = std::chrono::steady_clock::now();
+}
+
+void FileWatcher::pollChanges(std::vector<std::string>& outPaths, std::chrono::milliseconds settleTime) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_changes.empty()) {
+        return;
+    }
+    auto now = std::chrono::steady_clock::now();
+    for (auto it = m_changes.begin(); it != m_changes.end();) {
+        if (now - it->second >= settleTime) {
+            outPaths.push_back(it->first);
+            it = m_changes.erase(it);
+        }
+        else {
+            ++it;
+        }
+    }
+}
+
+#ifdef _WIN32
+
+bool FileWatcher::start(const std::vector<std::string>& directories) {
+    stop();
+    m_directories = directories;
+    m_stopEvent = CreateEventA(nullptr, TRUE, FALSE, nullptr);
+    if (!m_stopEvent) {
+        std::cerr << "ERROR::FILEWATCHER: Could not create stop event." << std::endl;
+        return false;
+    }
+    m_thread = std::thread(&FileWatcher::threadMain, this);
+    return true;
+}
+
+void FileWatcher::stop() {
+    if (m_thread.joinable()) {
+        SetEvent(static_cast<HANDLE>(m_stopEvent));
+        m_thread.join();
+    }
+    if (m_stopEvent) {
+        CloseHandle(static_cast<HANDLE>(m_stopEvent));
+        m_stopEvent = nullptr;
+    }
+}
+
+void FileWatcher::threadMain() {
+    struct Watch {
+        std::string directory;
+        HANDLE handle;
+        OVERLAPPED overlapped;
+        alignas(DWORD) char buffer[16 * 1024];
+    };
+
+    std::vector<std::unique_ptr<Watch>> watches;
+    std::vector<HANDLE> waitHandles;
+    waitHandles.push_back(static_cast<HANDLE>(m_stopEvent));
+
+    auto issueRead = [](Watch& watch) {
+        return ReadDirectoryChangesW(watch.handle, watch.buffer, sizeof(watch.buffer), TRUE,
+            FILE_NOTIFY_CHANGE_LAST_WRITE | FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_SIZE,
+            nullptr, &watch.overlapped, nullptr) != 0;
+    };
+
+    for (const std::string& directory : m_directories) {
+        auto watch = std::make_unique<Watch>();
+        watch->directory = normalizePath(directory);
+        watch->handle = CreateFileA(directory.c_str(), FILE_LIST_DIRECTORY,
+            FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING,
+            FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+        if (watch->handle == INVALID_HANDLE_VALUE) {
+            std::cerr << "ERROR::FILEWATCHER: Could not watch " << directory << std::endl;
+            continue;
+        }
+        ZeroMemory(&watch->overlapped, sizeof(watch->overlapped));
+        watch->overlapped.hEvent = CreateEventA(nullptr, FALSE, FALSE, nullptr);
+        if (!issueRead(*watch)) {
+            CloseHandle(watch->overlapped.hEvent);
+            CloseHandle(watch->handle);
+            continue;
+        }
+        waitHandles.push_back(watch->overlapped.hEvent);
+        watches.push_back(std::move(watch));
+    }
+
+    while (true) {
+        DWORD result = WaitForMultipleObjects(static_cast<DWORD>(waitHandles.size()), waitHandles.data(), FALSE, INFINITE);
+        if (result == WAIT_OBJECT_0 || result < WAIT_OBJECT_0 || result >= WAIT_OBJECT_0 + waitHandles.size()) {
+            break;
+        }
+
+        Watch& watch = *watches[result - WAIT_OBJECT_0 - 1];
+        DWORD bytes = 0;
+        if (GetOverlappedResult(watch.handle, &watch.overlapped, &bytes, FALSE) && bytes > 0) {
+            const char* cursor = watch.buffer;
+            while (true) {
+                const FILE_NOTIFY_INFORMATION* info = reinterpret_cast<const FILE_NOTIFY_INFORMATION*>(cursor);
+                std::wstring name(info->FileName, info->FileNameLength / sizeof(WCHAR));
+                recordChange(normalizePath(std::filesystem::path(watch.directory) / name));
+                if (info->NextEntryOffset == 0) {
+                    break;
+                }
+                cursor += info->NextEntryOffset;
+            }
+        }
+        issueRead(watch);
+    }
+
+    for (auto& watch : watches) {
+        CancelIoEx(watch->handle, &watch->overlapped);
+        DWORD bytes = 0;
+        GetOverlappedResult(watch->handle, &watch->overlapped, &bytes, TRUE);
+        CloseHandle(watch->overlapped.hEvent);
+        CloseHandle(watch->handle);
+    }
+}
+
+#else
+
+bool FileWatcher::start(const std::vector<std::string>& directories) {
+    stop();
+    m_directories = directories;
+
+    m_inotifyDescriptor = inotify_init1(IN_CLOEXEC);
+    if (m_inotifyDescriptor < 0 || pipe(m_stopPipe) != 0) {
+        std::cerr << "ERROR::FILEWATCHER: Could not initialize inotify." << std::endl;
+        stop();
+        return false;
+    }
+
+    for (const std::string& directory : directories) {
+        addWatchTree(directory, false);
+    }
+
+    m_thread = std::thread(&FileWatcher::threadMain, this);
+    return true;
+}
+
+// inotify is not recursive, so every subdirectory gets its own watch.
+// Editors either rewrite in place or save to a temporary and rename it over;
+// IN_CREATE and IN_MOVED_TO on directories let threadMain watch new subtrees.
+// A subtree that appears after start() may already hold files by the time its
+// watch exists, so those are reported as changed when recordFiles is set.
+void FileWatcher::addWatchTree(const std::string& root, bool recordFiles) {
+    const uint32_t mask = IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE;
+    std::error_code error;
+    std::vector<std::filesystem::path> paths = { root };
+    for (std::filesystem::recursive_directory_iterator it(root, error), end; !error && it != end; it.increment(error)) {
+        if (it->is_directory(error)) {
+            paths.push_back(it->path());
+        }
+        else if (recordFiles) {
+            recordChange(normalizePath(it->path()));
+        }
+    }
+    for (const std::filesystem::path& path : paths) {
+        int watch = inotify_add_watch(m_inotifyDescriptor, path.c_str(), mask);
+        if (watch < 0) {
+            std::cerr << "ERROR::FILEWATCHER: Could not watch " << path.string() << std::endl;
+            continue;
+        }
+        m_watchPaths[watch] = normalizePath(path);
+    }
+}
+
+void FileWatcher::stop() {
+    if (m_thread.joinable()) {
+        char byte = 0;
+        (void)!write(m_stopPipe[1], &byte, 1);
+        m_thread.join();
+    }
+    int* descriptors[] = { &m_inotifyDescriptor, &m_stopPipe[0], &m_stopPipe[1] };
+    for (int* descriptor : descriptors) {
+        if (*descriptor >= 0) {
+            ::close(*descriptor);
+            *descriptor = -1;
+        }
+    }
+    m_watchPaths.clear();
+}
+
+void FileWatcher::threadMain() {
+    alignas(inotify_event) char buffer[16 * 1024];
+    pollfd descriptors[2] = { { m_inotifyDescriptor, POLLIN, 0 }, { m_stopPipe[0], POLLIN, 0 } };
+
+    while (true) {
+        if (poll(descriptors, 2, -1) < 0) {
+            continue;
+        }
+        if (descriptors[1].revents != 0) {
+            return;
+        }
+        if (!(descriptors[0].revents & POLLIN)) {
+            continue;
+        }
+
+        ssize_t length = read(m_inotifyDescriptor, buffer, sizeof(buffer));
+        for (ssize_t offset = 0; offset < length;) {
+            const inotify_event* event = reinterpret_cast<const inotify_event*>(buffer + offset);
+            auto it = m_watchPaths.find(event->wd);
+            if (event->mask & IN_IGNORED) {
+                if (it != m_watchPaths.end()) {
+                    m_watchPaths.erase(it);
+                }
+            }
+            else if (it != m_watchPaths.end() && event->len > 0) {
+                std::string path = normalizePath(std::filesystem::path(it->second) / event->name);
+                if (event->mask & IN_ISDIR) {
+                    if (event->mask & (IN_CREATE | IN_MOVED_TO)) {
+                        addWatchTree(path, true);
+                    }
+                }
+                else if (!(event->mask & IN_CREATE)) {
+                    recordChange(path);
+                }
+            }
+            offset += sizeof(inotify_event) + event->len;
+        }
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <chrono>
+#include <map>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Reports files that changed under a set of directories. A background thread
+// blocks on the OS notification API (inotify on Linux, ReadDirectoryChangesW
+// on Windows), so nothing runs while the files are left alone.
+class FileWatcher {
+public:
+    FileWatcher();
+    ~FileWatcher();
+
+    // Watches every directory recursively. Calling start again replaces the
+    // previous set.
+    bool start(const std::vector<std::string>& directories);
+    void stop();
+    bool isRunning() const { return m_thread.joinable(); }
+
+    // Moves out the paths (normalized, '/'-separated) whose last change is at
+    // least settleTime old. Editors often write a file in several steps; the
+    // delay avoids picking up a half-written one.
+    void pollChanges(std::vector<std::string>& outPaths, std::chrono::milliseconds settleTime = std::chrono::milliseconds(100));
+
+private:
+    std::thread m_thread;
+    std::mutex m_mutex;
+    std::map<std::string, std::chrono::steady_clock::time_point> m_changes;
+    std::vector<std::string> m_directories;
+
+#ifdef _WIN32
+    void* m_stopEvent;
+#else
+    int m_inotifyDescriptor;
+    int m_stopPipe[2];
+    std::map<int, std::string> m_watchPaths;
+
+    void addWatchTree(const std::string& root, bool recordFiles);
+#endif
+
+    void threadMain();
+    void recordChange(const std::string& path);
+};
\ No newline at end of file
@@ -1,17 +1,31 @@
 #include "Core/FontRenderer.h"
 #include <iostream>
+#include "Core/FrameArena.h"
+#include "Core/MemoryTracker.h"
+#include "Core/FrameStats.h"
 #include <ft2build.h>
 #include <glm/ext/matrix_clip_space.hpp>
 #include <vector>
 #include FT_FREETYPE_H
 #include FT_GLYPH_H 
+
+static constexpr size_t kQuadBufferBytes = sizeof(float) * 6 * 4;
+
+// Glyph textures are single-channel, one byte per texel.
+static size_t glyphByteSize(const Character& character) {
+    return static_cast<size_t>(character.Size.x) * character.Size.y;
+}
+
 FontRenderer::FontRenderer()
     : m_textShader(nullptr), m_VAO(0), m_VBO(0), m_ft(nullptr), m_face(nullptr) {
 }
 
 
 FontRenderer::~FontRenderer() {
-    if (m_VBO != 0) glDeleteBuffers(1, &m_VBO);
+    if (m_VBO != 0) {
+        glDeleteBuffers(1, &m_VBO);
+        MemoryTracker::getInstance().recordFree(MemoryDomain::Gpu, MemoryTag::Font, kQuadBufferBytes);
+    }
     if (m_VAO != 0) glDeleteVertexArrays(1, &m_VAO);
 
     if (m_face) {
@@ -26,12 +40,14 @@ FontRenderer::~FontRenderer() {
 
     for (std::map<FT_ULong, Character>::const_iterator it = m_characters.begin(); it != m_characters.end(); ++it) {
         glDeleteTextures(1, &it->second.TextureID);
+        MemoryTracker::getInstance().recordFree(MemoryDomain::Gpu, MemoryTag::Font, glyphByteSize(it->second));
     }
     m_characters.clear();
 }
 
 
 bool FontRenderer::init(unsigned int windowWidth, unsigned int windowHeight) {
+    MemoryTagScope memoryScope(MemoryTag::Font);
     if (FT_Init_FreeType(&m_ft)) {
         std::cerr << "ERROR::FREETYPE: Could not init FreeType Library" << std::endl;
         return false;
@@ -42,7 +58,8 @@ bool FontRenderer::init(unsigned int windowWidth, unsigned int windowHeight) {
     glGenBuffers(1, &m_VBO);
     glBindVertexArray(m_VAO);
     glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
-    glBufferData(GL_ARRAY_BUFFER, sizeof(float) * 6 * 4, NULL, GL_DYNAMIC_DRAW);
+    glBufferData(GL_ARRAY_BUFFER, kQuadBufferBytes, NULL, GL_DYNAMIC_DRAW);
+    MemoryTracker::getInstance().recordAllocation(MemoryDomain::Gpu, MemoryTag::Font, kQuadBufferBytes);
     glEnableVertexAttribArray(0);
     glVertexAttribPointer(0, 4, GL_FLOAT, GL_FALSE, 4 * sizeof(float), (void*)0);
     glBindBuffer(GL_ARRAY_BUFFER, 0);
@@ -51,7 +68,10 @@ bool FontRenderer::init(unsigned int windowWidth, unsigned int windowHeight) {
     m_textShader = std::make_shared<Shader>("res/shaders/text.vert", "res/shaders/text.frag");
     if (!m_textShader) {
         std::cerr << "ERROR::FONTRENDERER: Could not create text shader. Check shader files (res/shaders/text.vert, res/shaders/text.frag) and their content." << std::endl;
-        if (m_VBO != 0) glDeleteBuffers(1, &m_VBO);
+        if (m_VBO != 0) {
+            glDeleteBuffers(1, &m_VBO);
+            MemoryTracker::getInstance().recordFree(MemoryDomain::Gpu, MemoryTag::Font, kQuadBufferBytes);
+        }
         if (m_VAO != 0) glDeleteVertexArrays(1, &m_VAO);
         m_VAO = 0; m_VBO = 0; 
         return false;
@@ -93,6 +113,7 @@ void loadGlyph(FT_Face face, FT_ULong charCode, std::map<FT_ULong, Character>& c
         glm::ivec2(face->glyph->bitmap_left, face->glyph->bitmap_top),
         static_cast<unsigned int>(face->glyph->advance.x)
     };
+    MemoryTracker::getInstance().recordAllocation(MemoryDomain::Gpu, MemoryTag::Font, glyphByteSize(character));
     characters.insert(std::pair<FT_ULong, Character>(charCode, character));
 }
 
@@ -101,6 +122,7 @@ bool FontRenderer::loadFont(const std::string& fontPath, unsigned int fontSize,
         std::cerr << "ERROR::FREETYPE: FreeType library not initialized. Call init() first." << std::endl;
         return false;
     }
+    MemoryTagScope memoryScope(MemoryTag::Font);
 
     if (m_face) { 
         FT_Done_Face(m_face);
@@ -108,10 +130,15 @@ bool FontRenderer::loadFont(const std::string& fontPath, unsigned int fontSize,
     }
     for (std::map<FT_ULong, Character>::const_iterator it = m_characters.begin(); it != m_characters.end(); ++it) {
         glDeleteTextures(1, &it->second.TextureID);
+        MemoryTracker::getInstance().recordFree(MemoryDomain::Gpu, MemoryTag::Font, glyphByteSize(it->second));
     }
     m_characters.clear();
 
-    if (FT_New_Face(m_ft, fontPath.c_str(), 0, &m_face)) {
+    m_fontFile = VirtualFileSystem::getInstance().open(fontPath);
+    m_fontPath = m_fontFile.isValid() ? fontPath : std::string();
+    if (!m_fontFile.isValid()
+        || FT_New_Memory_Face(m_ft, m_fontFile.data, static_cast<FT_Long>(m_fontFile.size), 0, &m_face)) {
+        m_face = nullptr;
         std::cerr << "ERROR::FREETYPE: Failed to load font: " << fontPath << ". Check path and font file validity." << std::endl;
         return false;
     }
@@ -134,9 +161,10 @@ bool FontRenderer::loadFont(const std::string& fontPath, unsigned int fontSize,
     }
 
     if (!textToWarmUp.empty()) {
-        std::string::const_iterator it = textToWarmUp.begin();
-        while (it != textToWarmUp.end()) {
-            FT_ULong charCode = decodeUtf8(it, textToWarmUp.end());
+        const char* it = textToWarmUp.data();
+        const char* end = it + textToWarmUp.size();
+        while (it != end) {
+            FT_ULong charCode = decodeUtf8(it, end);
             if (charCode != 0 && m_characters.find(charCode) == m_characters.end()) { 
                 loadGlyph(m_face, charCode, m_characters);
                 loaded_count++;
@@ -156,7 +184,7 @@ bool FontRenderer::loadFont(const std::string& fontPath, unsigned int fontSize,
     return true;
 }
 
-void FontRenderer::renderText(const std::string& text, float x, float y, float scale, glm::vec3 color) {
+void FontRenderer::renderText(std::string_view text, float x, float y, float scale, glm::vec3 color) {
     if (!m_textShader || m_characters.empty()) {
         std::cerr << "ERROR::FONTRENDERER: Shader or characters not initialized. Cannot render text." << std::endl;
         return;
@@ -171,9 +199,10 @@ void FontRenderer::renderText(const std::string& text, float x, float y, float s
     glActiveTexture(GL_TEXTURE0);
     glBindVertexArray(m_VAO);
 
-    std::string::const_iterator it = text.begin();
-    while (it != text.end()) {
-        FT_ULong charCode = decodeUtf8(it, text.end());
+    const char* it = text.data();
+    const char* end = it + text.size();
+    while (it != end) {
+        FT_ULong charCode = decodeUtf8(it, end);
 
         if (charCode == 0) { 
             break;
@@ -204,11 +233,13 @@ void FontRenderer::renderText(const std::string& text, float x, float y, float s
             { xpos + w, ypos + h,   1.0f, 0.0f }  
         };
         glBindTexture(GL_TEXTURE_2D, ch.TextureID);
+        FrameStats::getInstance().countStateChange();
         glBindBuffer(GL_ARRAY_BUFFER, m_VBO);
         glBufferSubData(GL_ARRAY_BUFFER, 0, sizeof(vertices), vertices); 
 
         glBindBuffer(GL_ARRAY_BUFFER, 0);
         glDrawArrays(GL_TRIANGLES, 0, 6);
+        FrameStats::getInstance().countDrawCall(2);
         x += (ch.Advance >> 6) * scale;
     }
     glBindVertexArray(0);
@@ -225,7 +256,7 @@ void FontRenderer::setProjection(unsigned int windowWidth, unsigned int windowHe
     m_projection = glm::ortho(0.0f, static_cast<float>(windowWidth), 0.0f, static_cast<float>(windowHeight));
 }
 
-FT_ULong FontRenderer::decodeUtf8(std::string::const_iterator& it, const std::string::const_iterator& end) {
+FT_ULong FontRenderer::decodeUtf8(const char*& it, const char* end) {
     if (it == end) return 0;
 
     FT_ULong codePoint = 0;
@@ -274,23 +305,99 @@ FT_ULong FontRenderer::decodeUtf8(std::string::const_iterator& it, const std::st
     return codePoint;
 }
 
-std::unique_ptr<Texture> FontRenderer::GenerateTextTexture(const std::string& ttfPath,
-    const std::string& text,
+std::unique_ptr<Texture> FontRenderer::GenerateTextTexture(std::string_view ttfPath,
+    std::string_view text,
     int pxSize) {
+    FrameVector<unsigned char> pixels(&FrameArena::getThreadInstance());
+    int width, height;
+    if (!rasterizeText(ttfPath, text, pxSize, pixels, width, height)) {
+        return nullptr;
+    }
+    GLuint textureID = uploadTextPixels(pixels, width, height, 0);
+    return std::make_unique<Texture>(
+        textureID,
+        std::string("GeneratedText_").append(text.substr(0, std::min(text.size(), size_t(50)))),
+        static_cast<GLuint>(width),
+        static_cast<GLuint>(height),
+        "generated_text_texture" 
+    );
+}
+
+// Re-renders into the GL texture texture already owns, so text that changes
+// every few frames costs no Texture, name string or shared_ptr allocations.
+bool FontRenderer::UpdateTextTexture(Texture& texture, std::string_view ttfPath, std::string_view text, int pxSize) {
+    if (texture.getID() == 0 || texture.getByteSize() == 0) {
+        return false;
+    }
+    FrameVector<unsigned char> pixels(&FrameArena::getThreadInstance());
+    int width, height;
+    if (!rasterizeText(ttfPath, text, pxSize, pixels, width, height)) {
+        return false;
+    }
+    uploadTextPixels(pixels, width, height, texture.getID());
+    texture.resizeStorage(static_cast<GLuint>(width), static_cast<GLuint>(height), Texture::estimateByteSize(width, height, 4, false));
+    return true;
+}
+
+bool FontRenderer::RasterizeText(std::string_view ttfPath, std::string_view text, int pxSize, AtlasImage& outImage) {
+    FrameVector<unsigned char> pixels(&FrameArena::getThreadInstance());
+    if (!rasterizeText(ttfPath, text, pxSize, pixels, outImage.width, outImage.height)) {
+        return false;
+    }
+    outImage.pixels.assign(pixels.begin(), pixels.end());
+    return true;
+}
+
+// Uploads into targetTexture when it is non-zero, otherwise into a new
+// texture, and returns the texture.
+GLuint FontRenderer::uploadTextPixels(const FrameVector<unsigned char>& pixels, int width, int height, GLuint targetTexture) {
+    GLuint textureID = targetTexture;
+    if (textureID == 0) {
+        glGenTextures(1, &textureID);
+    }
+    glBindTexture(GL_TEXTURE_2D, textureID);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
 
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, width, height,
+        0, GL_RGBA, GL_UNSIGNED_BYTE, pixels.data());
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE); 
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    return textureID;
+}
+
+// Renders text into a white RGBA image sized to fit it, with the glyph
+// coverage in alpha. The pixels come from the caller's arena.
+bool FontRenderer::rasterizeText(std::string_view ttfPath, std::string_view text, int pxSize, FrameVector<unsigned char>& outPixels, int& outWidth, int& outHeight) {
+    MemoryTagScope memoryScope(MemoryTag::Font);
 
     FT_Face face_local; 
 
-    if (FT_New_Face(m_ft, ttfPath.c_str(), 0, &face_local)) {
+    // Usually the font loadFont already has in memory.
+    FileView fontFile = ttfPath == m_fontPath ? m_fontFile : VirtualFileSystem::getInstance().open(std::string(ttfPath));
+    if (!fontFile.isValid()
+        || FT_New_Memory_Face(m_ft, fontFile.data, static_cast<FT_Long>(fontFile.size), 0, &face_local)) {
         std::cerr << "ERROR::FREETYPE: Failed to load font '" << ttfPath << "' for GenerateTextTexture." << std::endl;
-        return nullptr;
+        return false;
     }
     FT_Set_Pixel_Sizes(face_local, 0, pxSize);
 
-    std::string::const_iterator it_text = text.begin();
-    std::vector<FT_ULong> u32_text_codes;
-    while (it_text != text.end()) {
-        FT_ULong code = decodeUtf8(it_text, text.end());
+    // Scratch buffers only live for this call, so they come from the frame
+    // arena instead of the heap.
+    FrameArena& arena = FrameArena::getThreadInstance();
+
+    const char* it_text = text.data();
+    const char* end_text = it_text + text.size();
+    FrameVector<FT_ULong> u32_text_codes(&arena);
+    u32_text_codes.reserve(text.size());
+    while (it_text != end_text) {
+        FT_ULong code = decodeUtf8(it_text, end_text);
         if (code != 0) { 
             u32_text_codes.push_back(code);
         }
@@ -301,18 +408,17 @@ std::unique_ptr<Texture> FontRenderer::GenerateTextTexture(const std::string& tt
     if (u32_text_codes.empty()) {
         std::cerr << "WARNING::FREETYPE: Input text for GenerateTextTexture is empty or contains only invalid UTF-8. No texture generated." << std::endl;
         FT_Done_Face(face_local);
-        return nullptr;
+        return false;
     }
 
-    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
-
     struct TempGlyphData {
         glm::ivec2   Size;      
         glm::ivec2   Bearing;   
         unsigned int Advance;  
-        std::vector<unsigned char> bitmap;
+        size_t bitmapOffset;
     };
-    std::map<FT_ULong, TempGlyphData> local_raw_glyph_data; 
+    std::pmr::map<FT_ULong, TempGlyphData> local_raw_glyph_data(&arena);
+    FrameVector<unsigned char> glyphBitmaps(&arena);
 
     int maxAscent = 0; 
     int maxDescent = 0;
@@ -334,9 +440,10 @@ std::unique_ptr<Texture> FontRenderer::GenerateTextTexture(const std::string& tt
         temp_ch_data.Bearing = glm::ivec2(face_local->glyph->bitmap_left, face_local->glyph->bitmap_top);
         temp_ch_data.Advance = static_cast<unsigned int>(face_local->glyph->advance.x);
 
+        temp_ch_data.bitmapOffset = glyphBitmaps.size();
         if (face_local->glyph->bitmap.width > 0 && face_local->glyph->bitmap.rows > 0) {
             size_t bitmap_size = static_cast<size_t>(face_local->glyph->bitmap.width) * face_local->glyph->bitmap.rows;
-            temp_ch_data.bitmap.assign(face_local->glyph->bitmap.buffer, face_local->glyph->bitmap.buffer + bitmap_size);
+            glyphBitmaps.insert(glyphBitmaps.end(), face_local->glyph->bitmap.buffer, face_local->glyph->bitmap.buffer + bitmap_size);
         }
         local_raw_glyph_data[ch_u32] = temp_ch_data; 
 
@@ -359,10 +466,11 @@ std::unique_ptr<Texture> FontRenderer::GenerateTextTexture(const std::string& tt
     if (finalWidth <= 0 || finalHeight <= 0) {
         std::cerr << "WARNING::FREETYPE: Calculated text dimensions are non-positive (" << finalWidth << "x" << finalHeight << ") for text: '"
             << text.substr(0, std::min(text.size(), size_t(50))) << "'. Returning nullptr texture." << std::endl;
-        return nullptr;
+        return false;
     }
 
-    std::vector<unsigned char> finalBuffer(static_cast<size_t>(finalWidth) * static_cast<size_t>(finalHeight) * 4, 0);
+    FrameVector<unsigned char>& finalBuffer = outPixels;
+    finalBuffer.assign(static_cast<size_t>(finalWidth) * static_cast<size_t>(finalHeight) * 4, 0);
 
     int penX_draw = padding;
     for (FT_ULong ch_u32 : u32_text_codes) {
@@ -378,7 +486,7 @@ std::unique_ptr<Texture> FontRenderer::GenerateTextTexture(const std::string& tt
 
         int glyphW = ch.Size.x;
         int glyphH = ch.Size.y;
-        const std::vector<unsigned char>& glyphBitmap = ch.bitmap;
+        const unsigned char* glyphBitmap = glyphBitmaps.data() + ch.bitmapOffset;
 
         for (int row = 0; row < glyphH; ++row) {
             for (int col = 0; col < glyphW; ++col) {
@@ -389,7 +497,7 @@ std::unique_ptr<Texture> FontRenderer::GenerateTextTexture(const std::string& tt
                 assert(finalY >= 0 && finalY < finalHeight && "Generated texture Y coordinate out of bounds!");
 
                 size_t glyphBufferIdx = static_cast<size_t>(row) * glyphW + col;
-                assert(glyphBufferIdx < glyphBitmap.size() && "Glyph bitmap data access out of bounds!");
+                assert(ch.bitmapOffset + glyphBufferIdx < glyphBitmaps.size() && "Glyph bitmap data access out of bounds!");
 
                 unsigned char alpha = glyphBitmap[glyphBufferIdx];
 
@@ -406,27 +514,7 @@ std::unique_ptr<Texture> FontRenderer::GenerateTextTexture(const std::string& tt
     }
 
 
-    GLuint finalTexID;
-    glGenTextures(1, &finalTexID);
-    glBindTexture(GL_TEXTURE_2D, finalTexID);
-
-    glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, finalWidth, finalHeight,
-        0, GL_RGBA, GL_UNSIGNED_BYTE, finalBuffer.data());
-
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE); 
-    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
-
-    glBindTexture(GL_TEXTURE_2D, 0);
-
-    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
-
-    return std::make_unique<Texture>(
-        finalTexID,
-        "GeneratedText_" + text.substr(0, std::min(text.size(), size_t(50))),
-        static_cast<GLuint>(finalWidth),
-        static_cast<GLuint>(finalHeight),
-        "generated_text_texture" 
-    );
+    outWidth = finalWidth;
+    outHeight = finalHeight;
+    return true;
 }
\ No newline at end of file
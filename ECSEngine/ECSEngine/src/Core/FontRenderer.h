@@ -7,10 +7,14 @@
 #include <glm/glm.hpp>
 #include <map>
 #include <string>
+#include <string_view>
 #include <memory> 
 
 #include "Core/Shader.h"
+#include "Core/VirtualFileSystem.h"
 #include "Texture.h"
+#include "Core/TextureAtlas.h"
+#include "Core/FrameArena.h"
 
 
 struct Character {
@@ -29,10 +33,14 @@ public:
 
     bool loadFont(const std::string& fontPath, unsigned int fontSize, const std::string& textToWarmUp = "");
 
-    void renderText(const std::string& text, float x, float y, float scale, glm::vec3 color);
+    void renderText(std::string_view text, float x, float y, float scale, glm::vec3 color);
 
 
-    std::unique_ptr<Texture> GenerateTextTexture(const std::string& ttfPath, const std::string& text, int pxSize);
+    std::unique_ptr<Texture> GenerateTextTexture(std::string_view ttfPath, std::string_view text, int pxSize);
+    // Re-renders text into a texture made by GenerateTextTexture, keeping its GL id.
+    bool UpdateTextTexture(Texture& texture, std::string_view ttfPath, std::string_view text, int pxSize);
+    // The same image on the CPU, e.g. for packing into a TextureAtlas.
+    bool RasterizeText(std::string_view ttfPath, std::string_view text, int pxSize, AtlasImage& outImage);
 
     void setProjection(unsigned int windowWidth, unsigned int windowHeight);
 
@@ -44,6 +52,11 @@ private:
 
     FT_Library m_ft;
     FT_Face m_face;
+    // FreeType reads from this for as long as m_face is alive.
+    FileView m_fontFile;
+    std::string m_fontPath;
 
-    FT_ULong decodeUtf8(std::string::const_iterator& it, const std::string::const_iterator& end);
+    FT_ULong decodeUtf8(const char*& it, const char* end);
+    bool rasterizeText(std::string_view ttfPath, std::string_view text, int pxSize, FrameVector<unsigned char>& outPixels, int& outWidth, int& outHeight);
+    GLuint uploadTextPixels(const FrameVector<unsigned char>& pixels, int width, int height, GLuint targetTexture);
 };
\ No newline at end of file
@@ -0,0 +1,88 @@
+#include "Core/FrameArena.h"
+#include <algorithm>
+#include <cstdarg>
+#include <cstdio>
+#include <new>
+
+FrameArena::FrameArena(size_t blockSize)
+    : m_blockSize(blockSize), m_currentBlock(0), m_offset(0), m_bytesUsed(0), m_peakBytesUsed(0), m_capacity(0) {
+}
+
+FrameArena::~FrameArena() {
+    for (const Block& block : m_blocks) {
+        ::operator delete(block.data);
+    }
+}
+
+FrameArena& FrameArena::getThreadInstance() {
+    thread_local FrameArena instance;
+    return instance;
+}
+
+void FrameArena::reset() {
+    m_currentBlock = 0;
+    m_offset = 0;
+    m_bytesUsed = 0;
+}
+
+void* FrameArena::do_allocate(size_t bytes, size_t alignment) {
+    // Walk forward through the blocks kept from earlier frames before
+    // growing; a request that fits nowhere gets a block of its own size.
+    while (m_currentBlock < m_blocks.size()) {
+        const Block& block = m_blocks[m_currentBlock];
+        size_t address = reinterpret_cast<size_t>(block.data) + m_offset;
+        size_t padding = (alignment - address % alignment) % alignment;
+        if (m_offset + padding + bytes <= block.size) {
+            m_offset += padding + bytes;
+            m_bytesUsed += padding + bytes;
+            m_peakBytesUsed = std::max(m_peakBytesUsed, m_bytesUsed);
+            return block.data + m_offset - bytes;
+        }
+        if (m_currentBlock + 1 == m_blocks.size()) {
+            break;
+        }
+        ++m_currentBlock;
+        m_offset = 0;
+    }
+
+    size_t size = std::max(m_blockSize, bytes + alignment);
+    Block block = { static_cast<unsigned char*>(::operator new(size)), size };
+    m_blocks.push_back(block);
+    m_capacity += size;
+    m_currentBlock = m_blocks.size() - 1;
+    m_offset = 0;
+    return do_allocate(bytes, alignment);
+}
+
+void FrameArena::do_deallocate(void* pointer, size_t bytes, size_t) {
+    // Only the most recent allocation can be given back, which is enough for
+    // temporaries released in reverse order.
+    if (m_currentBlock < m_blocks.size()
+        && static_cast<unsigned char*>(pointer) + bytes == m_blocks[m_currentBlock].data + m_offset) {
+        m_offset -= bytes;
+        m_bytesUsed -= bytes;
+    }
+}
+
+FrameString formatFrameString(const char* format, ...) {
+    FrameString result(&FrameArena::getThreadInstance());
+    char buffer[256];
+
+    va_list args;
+    va_start(args, format);
+    int length = std::vsnprintf(buffer, sizeof(buffer), format, args);
+    va_end(args);
+    if (length < 0) {
+        return result;
+    }
+    if (static_cast<size_t>(length) < sizeof(buffer)) {
+        result.assign(buffer, static_cast<size_t>(length));
+        return result;
+    }
+
+    result.resize(static_cast<size_t>(length));
+    va_start(args, format);
+    std::vsnprintf(result.data(), result.size() + 1, format, args);
+    va_end(args);
+    return result;
+}
\ No newline at end of file
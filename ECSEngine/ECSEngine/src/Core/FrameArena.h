@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <vector>
+
+// Bump allocator for data that only lives until the end of the frame. Each
+// thread has its own arena, reset by whoever owns the thread's frame loop.
+// Blocks are kept across resets, so once the arena has grown to a frame's
+// working set, allocating from it no longer touches the heap.
+class FrameArena : public std::pmr::memory_resource {
+public:
+    static constexpr size_t kDefaultBlockSize = 256 * 1024;
+
+    explicit FrameArena(size_t blockSize = kDefaultBlockSize);
+    ~FrameArena() override;
+
+    FrameArena(const FrameArena&) = delete;
+    FrameArena& operator=(const FrameArena&) = delete;
+
+    static FrameArena& getThreadInstance();
+
+    // Everything allocated since the last reset becomes invalid.
+    void reset();
+
+    size_t getBytesUsed() const { return m_bytesUsed; }
+    size_t getPeakBytesUsed() const { return m_peakBytesUsed; }
+    size_t getCapacity() const { return m_capacity; }
+
+private:
+    struct Block {
+        unsigned char* data;
+        size_t size;
+    };
+
+    std::vector<Block> m_blocks;
+    size_t m_blockSize;
+    size_t m_currentBlock;
+    size_t m_offset;
+    size_t m_bytesUsed;
+    size_t m_peakBytesUsed;
+    size_t m_capacity;
+
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* pointer, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override { return this == &other; }
+};
+
+// Containers that allocate from an arena. Pass the arena on construction:
+//   FrameVector<int> ids(&FrameArena::getThreadInstance());
+template<typename T>
+using FrameVector = std::pmr::vector<T>;
+using FrameString = std::pmr::string;
+
+// printf-style formatting into a string backed by the thread's frame arena.
+FrameString formatFrameString(const char* format, ...);
\ No newline at end of file
@@ -0,0 +1,12 @@
+#include "Core/FrameStats.h"
+
+FrameStats& FrameStats::getInstance() {
+    static FrameStats instance;
+    return instance;
+}
+
+void FrameStats::endFrame() {
+    m_current.clickablesTested = m_clickablesTested.exchange(0, std::memory_order_relaxed);
+    m_last = m_current;
+    m_current = FrameStatsValues();
+}
\ No newline at end of file
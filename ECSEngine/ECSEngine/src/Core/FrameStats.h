@@ -0,0 +1,41 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+
+struct FrameStatsValues {
+    uint32_t drawCalls = 0;
+    // Shader and texture binds.
+    uint32_t stateChanges = 0;
+    uint64_t triangles = 0;
+    // Objects that issued at least one draw; the pipelined renderer counts
+    // draw packets instead.
+    uint32_t visibleEntities = 0;
+    uint32_t clickablesTested = 0;
+};
+
+// Per-frame render and picking counters for the performance HUD. Everything
+// except clickablesTested is only touched by the GL thread; picking may run on
+// the simulation thread.
+class FrameStats {
+public:
+    static FrameStats& getInstance();
+    FrameStats(const FrameStats&) = delete;
+    FrameStats& operator=(const FrameStats&) = delete;
+
+    void countDrawCall(uint64_t triangles) { ++m_current.drawCalls; m_current.triangles += triangles; }
+    void countStateChange() { ++m_current.stateChanges; }
+    void countVisibleEntity() { ++m_current.visibleEntities; }
+    void countClickablesTested(uint32_t count) { m_clickablesTested.fetch_add(count, std::memory_order_relaxed); }
+
+    // Publishes the counts gathered since the previous call.
+    void endFrame();
+    const FrameStatsValues& getLastFrame() const { return m_last; }
+
+private:
+    FrameStats() = default;
+
+    FrameStatsValues m_current;
+    FrameStatsValues m_last;
+    std::atomic<uint32_t> m_clickablesTested{ 0 };
+};
\ No newline at end of file
@@ -3,15 +3,20 @@
 #include "Components/MeshComponent.h"
 #include "Components/ClickableComponent.h"
 #include "Core/PickingManager.h"
+#include "Core/FrameStats.h"
 
 #include <iostream> 
 
+std::atomic<size_t> GameObject::s_liveCount(0);
+
 GameObject::GameObject(const std::string& name)
     : m_name(name), m_transform(this), m_parent(nullptr)
 {
+    s_liveCount.fetch_add(1, std::memory_order_relaxed);
 }
 
 GameObject::~GameObject() {
+    s_liveCount.fetch_sub(1, std::memory_order_relaxed);
     for (const auto& comp_ptr : m_components) {
         if (comp_ptr) { 
             if (ClickableComponent* clickable = dynamic_cast<ClickableComponent*>(comp_ptr.get())) {
@@ -41,11 +46,42 @@ void GameObject::Update(float deltaTime) {
     }
 }
 
-void GameObject::Render(const glm::mat4& view, const glm::mat4& projection) {
-    RenderComponents(view, projection); 
+void GameObject::FixedUpdate(float fixedDeltaTime) {
+    m_transform.storePreviousState();
+
+    for (const auto& comp : m_components) {
+        if (comp) {
+            comp->FixedUpdate(fixedDeltaTime);
+        }
+    }
+    for (const auto& child : m_children) {
+        if (child) {
+            child->FixedUpdate(fixedDeltaTime);
+        }
+    }
+}
+
+void GameObject::Render(const glm::mat4& view, const glm::mat4& projection, float interpolationAlpha) {
+    RenderComponents(view, projection, interpolationAlpha); 
     for (const auto& child : m_children) {
         if (child) {
-            child->Render(view, projection);
+            child->Render(view, projection, interpolationAlpha);
+        }
+    }
+}
+
+void GameObject::CollectDrawPackets(FrameVector<DrawPacket>& outPackets, float interpolationAlpha) {
+    glm::mat4 modelMatrix = m_transform.getInterpolatedWorldMatrix(interpolationAlpha);
+
+    for (const auto& comp : m_components) {
+        if (RenderComponent* renderComp = dynamic_cast<RenderComponent*>(comp.get())) {
+            outPackets.push_back({ modelMatrix, renderComp->m_mesh, renderComp->getShader(), renderComp->m_texture, renderComp->m_objectColor, renderComp->m_uvRect,
+                renderComp->getShaderFeatures(), renderComp->getAlphaCutoff() });
+        }
+    }
+    for (const auto& child : m_children) {
+        if (child) {
+            child->CollectDrawPackets(outPackets, interpolationAlpha);
         }
     }
 }
@@ -61,14 +97,19 @@ void GameObject::UpdateComponents(float deltaTime) {
     }
 }
 
-void GameObject::RenderComponents(const glm::mat4& view, const glm::mat4& projection) {
-    glm::mat4 modelMatrix = m_transform.getWorldMatrix();
+void GameObject::RenderComponents(const glm::mat4& view, const glm::mat4& projection, float interpolationAlpha) {
+    glm::mat4 modelMatrix = m_transform.getInterpolatedWorldMatrix(interpolationAlpha);
 
+    bool rendered = false;
     for (const auto& comp : m_components) {
         if (RenderComponent* renderComp = dynamic_cast<RenderComponent*>(comp.get())) {
             renderComp->Render(view, projection, modelMatrix);
+            rendered = true;
         }
     }
+    if (rendered) {
+        FrameStats::getInstance().countVisibleEntity();
+    }
 }
 
 GameObject* GameObject::addChild(std::unique_ptr<GameObject> child) {
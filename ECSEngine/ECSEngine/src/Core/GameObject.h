@@ -5,11 +5,14 @@
 #include "../Components/ClickableComponent.h"
 #include "PickingManager.h"
 #include "../Components/RenderComponent.h"
+#include "RenderSnapshot.h"
+#include "MemoryTracker.h"
 #include <string>
 #include <vector>
 #include <memory>
 #include <algorithm>
 #include <type_traits>
+#include <atomic>
 class Camera3DComponent;
 
 
@@ -20,7 +23,9 @@ public:
 
     void Init();
     void Update(float deltaTime);
-    void Render(const glm::mat4& view, const glm::mat4& projection);
+    void FixedUpdate(float fixedDeltaTime);
+    void Render(const glm::mat4& view, const glm::mat4& projection, float interpolationAlpha = 1.0f);
+    void CollectDrawPackets(FrameVector<DrawPacket>& outPackets, float interpolationAlpha = 1.0f);
     virtual void Shutdown() {} 
 
     template<typename T, typename... Args>
@@ -39,11 +44,16 @@ public:
     void removeLastChild();
 
     const std::vector<std::unique_ptr<GameObject>>& getChildren() const { return m_children; }
+    const std::vector<std::unique_ptr<Component>>& getComponents() const { return m_components; }
+    void reserveChildren(size_t count) { m_children.reserve(count); }
     const std::string& getName() const { return m_name; }
 
     TransformComponent* getTransform() { return &m_transform; }
     const TransformComponent* getTransform() const { return &m_transform; } 
 
+    // GameObjects currently alive across all scenes.
+    static size_t getLiveCount() { return s_liveCount.load(std::memory_order_relaxed); }
+
     GameObject* m_parent; 
 
 private:
@@ -52,9 +62,11 @@ private:
     std::vector<std::unique_ptr<Component>> m_components;
     std::vector<std::unique_ptr<GameObject>> m_children;
 
+    static std::atomic<size_t> s_liveCount;
+
     void InitComponents();
     void UpdateComponents(float deltaTime);
-    void RenderComponents(const glm::mat4& view, const glm::mat4& projection);
+    void RenderComponents(const glm::mat4& view, const glm::mat4& projection, float interpolationAlpha);
 };
 
 
@@ -62,6 +74,7 @@ template<typename T, typename... Args>
 T* GameObject::addComponent(Args&&... args) {
     static_assert(std::is_base_of<Component, T>::value, "T must be a Component type.");
 
+    MemoryTagScope memoryScope(MemoryTag::Component);
     auto component = std::make_unique<T>(this, std::forward<Args>(args)...);
     T* rawPtr = component.get();
     m_components.push_back(std::move(component));
@@ -0,0 +1,64 @@
+#include "Core/GpuFrameTimer.h"
+
+GpuFrameTimer::GpuFrameTimer()
+    : m_queries(), m_pending(), m_current(0), m_active(false), m_lastMilliseconds(-1.0) {
+}
+
+GpuFrameTimer::~GpuFrameTimer() {
+    shutdown();
+}
+
+bool GpuFrameTimer::init() {
+    if (m_queries[0] != 0) {
+        return true;
+    }
+    glGenQueries(kQueryCount, m_queries);
+    return m_queries[0] != 0;
+}
+
+void GpuFrameTimer::shutdown() {
+    if (m_queries[0] == 0) {
+        return;
+    }
+    if (m_active) {
+        glEndQuery(GL_TIME_ELAPSED);
+        m_active = false;
+    }
+    glDeleteQueries(kQueryCount, m_queries);
+    for (int i = 0; i < kQueryCount; ++i) {
+        m_queries[i] = 0;
+        m_pending[i] = false;
+    }
+}
+
+void GpuFrameTimer::begin() {
+    if (m_queries[0] == 0 || m_active) {
+        return;
+    }
+    // Collect the result this slot held from kQueryCount frames ago. If the
+    // GPU is still behind, skip the sample rather than stall.
+    GLuint query = m_queries[m_current];
+    if (m_pending[m_current]) {
+        GLint available = 0;
+        glGetQueryObjectiv(query, GL_QUERY_RESULT_AVAILABLE, &available);
+        if (!available) {
+            return;
+        }
+        GLuint64 elapsed = 0;
+        glGetQueryObjectui64v(query, GL_QUERY_RESULT, &elapsed);
+        m_lastMilliseconds = elapsed / 1.0e6;
+        m_pending[m_current] = false;
+    }
+    glBeginQuery(GL_TIME_ELAPSED, query);
+    m_active = true;
+}
+
+void GpuFrameTimer::end() {
+    if (!m_active) {
+        return;
+    }
+    glEndQuery(GL_TIME_ELAPSED);
+    m_active = false;
+    m_pending[m_current] = true;
+    m_current = (m_current + 1) % kQueryCount;
+}
\ No newline at end of file
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <GL/glew.h>
+
+// Measures GPU time per frame with GL_TIME_ELAPSED queries. Results are read
+// a few frames late from a ring of queries so the CPU never waits on them.
+class GpuFrameTimer {
+public:
+    GpuFrameTimer();
+    ~GpuFrameTimer();
+
+    GpuFrameTimer(const GpuFrameTimer&) = delete;
+    GpuFrameTimer& operator=(const GpuFrameTimer&) = delete;
+
+    bool init();
+    void shutdown();
+
+    void begin();
+    void end();
+
+    // Most recent completed measurement, or a negative value if none yet.
+    double getLastMilliseconds() const { return m_lastMilliseconds; }
+
+private:
+    static constexpr int kQueryCount = 4;
+
+    GLuint m_queries[kQueryCount];
+    bool m_pending[kQueryCount];
+    int m_current;
+    bool m_active;
+    double m_lastMilliseconds;
+};
\ No newline at end of file
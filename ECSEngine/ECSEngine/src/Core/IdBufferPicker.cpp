@@ -0,0 +1,216 @@
+#include "Core/IdBufferPicker.h"
+#include "Core/Mesh.h"
+#include "Core/MemoryTracker.h"
+#include <iostream>
+
+IdBufferPicker::IdBufferPicker()
+    : m_fbo(0), m_idTexture(0), m_depthBuffer(0),
+    m_pbos{ 0, 0 }, m_fences{ nullptr, nullptr },
+    m_writeIndex(0), m_width(0), m_height(0), m_targetBytes(0),
+    m_shader(nullptr), m_previousFramebuffer(0), m_previousViewport{ 0, 0, 0, 0 },
+    m_previousDepthFunc(GL_LESS), m_previousDepthTest(GL_TRUE), m_previousCullFace(GL_FALSE), m_previousBlend(GL_FALSE)
+{
+}
+
+IdBufferPicker::~IdBufferPicker() {
+    shutdown();
+}
+
+bool IdBufferPicker::init(int width, int height) {
+    if (isInitialized()) {
+        return true;
+    }
+
+    m_width = width;
+    m_height = height;
+
+    m_shader = std::make_shared<Shader>("res/shaders/picking.vert", "res/shaders/picking.frag");
+    if (!m_shader || m_shader->getID() == 0) {
+        std::cerr << "ERROR::IDBUFFERPICKER: Could not create picking shader (res/shaders/picking.vert, res/shaders/picking.frag)." << std::endl;
+        m_shader = nullptr;
+        return false;
+    }
+
+    glGenBuffers(kReadbackCount, m_pbos);
+    for (int i = 0; i < kReadbackCount; ++i) {
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, m_pbos[i]);
+        glBufferData(GL_PIXEL_PACK_BUFFER, sizeof(GLuint), nullptr, GL_STREAM_READ);
+        MemoryTracker::getInstance().recordAllocation(MemoryDomain::Gpu, MemoryTag::Renderer, sizeof(GLuint));
+    }
+    glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+    if (!createTargets()) {
+        shutdown();
+        return false;
+    }
+
+    std::cout << "IdBufferPicker initialized (" << width << "x" << height << ")." << std::endl;
+    return true;
+}
+
+void IdBufferPicker::shutdown() {
+    destroyTargets();
+
+    for (int i = 0; i < kReadbackCount; ++i) {
+        if (m_fences[i]) {
+            glDeleteSync(m_fences[i]);
+            m_fences[i] = nullptr;
+        }
+    }
+    if (m_pbos[0] != 0) {
+        glDeleteBuffers(kReadbackCount, m_pbos);
+        m_pbos[0] = m_pbos[1] = 0;
+        for (int i = 0; i < kReadbackCount; ++i) {
+            MemoryTracker::getInstance().recordFree(MemoryDomain::Gpu, MemoryTag::Renderer, sizeof(GLuint));
+        }
+    }
+    m_shader = nullptr;
+}
+
+bool IdBufferPicker::createTargets() {
+    glGenFramebuffers(1, &m_fbo);
+    glBindFramebuffer(GL_FRAMEBUFFER, m_fbo);
+
+    glGenTextures(1, &m_idTexture);
+    glBindTexture(GL_TEXTURE_2D, m_idTexture);
+    glTexImage2D(GL_TEXTURE_2D, 0, GL_R32UI, m_width, m_height, 0, GL_RED_INTEGER, GL_UNSIGNED_INT, nullptr);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_idTexture, 0);
+
+    glGenRenderbuffers(1, &m_depthBuffer);
+    glBindRenderbuffer(GL_RENDERBUFFER, m_depthBuffer);
+    glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH_COMPONENT24, m_width, m_height);
+    glBindRenderbuffer(GL_RENDERBUFFER, 0);
+    glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_ATTACHMENT, GL_RENDERBUFFER, m_depthBuffer);
+
+    // R32UI ids plus a depth buffer drivers store in four bytes.
+    m_targetBytes = static_cast<size_t>(m_width) * m_height * 8;
+    MemoryTracker::getInstance().recordAllocation(MemoryDomain::Gpu, MemoryTag::Renderer, m_targetBytes);
+
+    GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+    glBindFramebuffer(GL_FRAMEBUFFER, 0);
+
+    if (status != GL_FRAMEBUFFER_COMPLETE) {
+        std::cerr << "ERROR::IDBUFFERPICKER: Framebuffer incomplete (status 0x" << std::hex << status << std::dec << ")." << std::endl;
+        destroyTargets();
+        return false;
+    }
+    return true;
+}
+
+void IdBufferPicker::destroyTargets() {
+    if (m_depthBuffer != 0) glDeleteRenderbuffers(1, &m_depthBuffer);
+    if (m_idTexture != 0) glDeleteTextures(1, &m_idTexture);
+    if (m_fbo != 0) glDeleteFramebuffers(1, &m_fbo);
+    if (m_targetBytes != 0) {
+        MemoryTracker::getInstance().recordFree(MemoryDomain::Gpu, MemoryTag::Renderer, m_targetBytes);
+        m_targetBytes = 0;
+    }
+    m_depthBuffer = 0;
+    m_idTexture = 0;
+    m_fbo = 0;
+}
+
+void IdBufferPicker::resize(int width, int height) {
+    if (!isInitialized() || (width == m_width && height == m_height) || width <= 0 || height <= 0) {
+        return;
+    }
+    m_width = width;
+    m_height = height;
+    destroyTargets();
+    createTargets();
+}
+
+void IdBufferPicker::beginPass(const glm::mat4& view, const glm::mat4& projection) {
+    glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &m_previousFramebuffer);
+    glGetIntegerv(GL_VIEWPORT, m_previousViewport);
+    glGetIntegerv(GL_DEPTH_FUNC, &m_previousDepthFunc);
+    m_previousDepthTest = glIsEnabled(GL_DEPTH_TEST);
+    m_previousCullFace = glIsEnabled(GL_CULL_FACE);
+    m_previousBlend = glIsEnabled(GL_BLEND);
+
+    glBindFramebuffer(GL_FRAMEBUFFER, m_fbo);
+    glViewport(0, 0, m_width, m_height);
+
+    const GLuint clearId[4] = { kNoId, 0, 0, 0 };
+    glClearBufferuiv(GL_COLOR, 0, clearId);
+    glClear(GL_DEPTH_BUFFER_BIT);
+
+    // Equal depths resolve to the object drawn last, matching the CPU picker's
+    // "latest registration wins" rule for flat 2D scenes. Culling is off so
+    // flipped quads stay pickable.
+    glEnable(GL_DEPTH_TEST);
+    glDepthFunc(GL_LEQUAL);
+    glDisable(GL_CULL_FACE);
+    glDisable(GL_BLEND);
+
+    m_shader->use();
+    m_shader->setMat4("view", view);
+    m_shader->setMat4("projection", projection);
+}
+
+void IdBufferPicker::drawObject(Mesh& mesh, const glm::mat4& model, unsigned int id) {
+    m_shader->setMat4("model", model);
+    m_shader->setUInt("objectId", id);
+    mesh.draw();
+}
+
+void IdBufferPicker::endPass(int mouseX, int mouseY) {
+    m_shader->detach();
+
+    int pixelX = mouseX;
+    int pixelY = m_height - 1 - mouseY;
+    if (pixelX >= 0 && pixelX < m_width && pixelY >= 0 && pixelY < m_height) {
+        // A readback still in flight in this slot is simply dropped.
+        if (m_fences[m_writeIndex]) {
+            glDeleteSync(m_fences[m_writeIndex]);
+            m_fences[m_writeIndex] = nullptr;
+        }
+
+        glReadBuffer(GL_COLOR_ATTACHMENT0);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, m_pbos[m_writeIndex]);
+        glReadPixels(pixelX, pixelY, 1, 1, GL_RED_INTEGER, GL_UNSIGNED_INT, nullptr);
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+        m_fences[m_writeIndex] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+        m_writeIndex = (m_writeIndex + 1) % kReadbackCount;
+    }
+
+    glDepthFunc(m_previousDepthFunc);
+    if (!m_previousDepthTest) glDisable(GL_DEPTH_TEST);
+    if (m_previousCullFace) glEnable(GL_CULL_FACE);
+    if (m_previousBlend) glEnable(GL_BLEND);
+    glBindFramebuffer(GL_FRAMEBUFFER, m_previousFramebuffer);
+    glViewport(m_previousViewport[0], m_previousViewport[1], m_previousViewport[2], m_previousViewport[3]);
+}
+
+bool IdBufferPicker::pollResult(unsigned int& outId) {
+    bool found = false;
+
+    // m_writeIndex is the oldest slot; walk forward so the newest finished
+    // readback is the one that sticks.
+    for (int i = 0; i < kReadbackCount; ++i) {
+        int slot = (m_writeIndex + i) % kReadbackCount;
+        if (!m_fences[slot]) {
+            continue;
+        }
+
+        GLenum state = glClientWaitSync(m_fences[slot], 0, 0);
+        if (state != GL_ALREADY_SIGNALED && state != GL_CONDITION_SATISFIED) {
+            continue;
+        }
+        glDeleteSync(m_fences[slot]);
+        m_fences[slot] = nullptr;
+
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, m_pbos[slot]);
+        if (const GLuint* data = static_cast<const GLuint*>(glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, sizeof(GLuint), GL_MAP_READ_BIT))) {
+            outId = *data;
+            found = true;
+            glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+        }
+        glBindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+    }
+    return found;
+}
\ No newline at end of file
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <memory>
+
+#include "Core/Shader.h"
+
+class Mesh;
+
+// Offscreen R32UI target that clickable objects are rendered into with their
+// pick id. The texel under the cursor is copied into a pixel buffer and read
+// back once its fence has signalled, so the CPU never waits on the GPU.
+class IdBufferPicker {
+public:
+    static constexpr unsigned int kNoId = 0;
+
+    IdBufferPicker();
+    ~IdBufferPicker();
+
+    bool init(int width, int height);
+    void shutdown();
+    void resize(int width, int height);
+    bool isInitialized() const { return m_fbo != 0; }
+
+    void beginPass(const glm::mat4& view, const glm::mat4& projection);
+    void drawObject(Mesh& mesh, const glm::mat4& model, unsigned int id);
+    void endPass(int mouseX, int mouseY);
+
+    // Returns true and writes the id if a readback finished since the last call.
+    bool pollResult(unsigned int& outId);
+
+private:
+    static constexpr int kReadbackCount = 2;
+
+    GLuint m_fbo;
+    GLuint m_idTexture;
+    GLuint m_depthBuffer;
+    GLuint m_pbos[kReadbackCount];
+    GLsync m_fences[kReadbackCount];
+    int m_writeIndex;
+    int m_width;
+    int m_height;
+    size_t m_targetBytes;
+
+    std::shared_ptr<Shader> m_shader;
+
+    GLint m_previousFramebuffer;
+    GLint m_previousViewport[4];
+    GLint m_previousDepthFunc;
+    GLboolean m_previousDepthTest;
+    GLboolean m_previousCullFace;
+    GLboolean m_previousBlend;
+
+    bool createTargets();
+    void destroyTargets();
+};
\ No newline at end of file
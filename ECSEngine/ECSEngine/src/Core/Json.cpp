@@ -0,0 +1,274 @@
+#include "Core/Json.h"
+#include <cstdlib>
+
+class JsonParser {
+public:
+    explicit JsonParser(std::string_view text) : m_text(text), m_position(0), m_depth(0) {}
+
+    bool parseDocument(JsonValue& outValue, std::string& outError) {
+        if (!parseValue(outValue)) {
+            outError = m_error + " at offset " + std::to_string(m_position);
+            return false;
+        }
+        skipWhitespace();
+        if (m_position != m_text.size()) {
+            outError = "Unexpected trailing characters at offset " + std::to_string(m_position);
+            return false;
+        }
+        return true;
+    }
+
+private:
+    static constexpr int kMaxDepth = 64;
+
+    std::string_view m_text;
+    size_t m_position;
+    int m_depth;
+    std::string m_error;
+
+    bool fail(const char* message) {
+        m_error = message;
+        return false;
+    }
+
+    void skipWhitespace() {
+        while (m_position < m_text.size()) {
+            char c = m_text[m_position];
+            if (c != ' ' && c != '\t' && c != '\n' && c != '\r') {
+                break;
+            }
+            ++m_position;
+        }
+    }
+
+    bool consume(char expected) {
+        skipWhitespace();
+        if (m_position < m_text.size() && m_text[m_position] == expected) {
+            ++m_position;
+            return true;
+        }
+        return false;
+    }
+
+    bool consumeLiteral(std::string_view literal) {
+        if (m_text.substr(m_position, literal.size()) != literal) {
+            return false;
+        }
+        m_position += literal.size();
+        return true;
+    }
+
+    bool parseValue(JsonValue& outValue) {
+        skipWhitespace();
+        if (m_position >= m_text.size()) {
+            return fail("Unexpected end of input");
+        }
+
+        char c = m_text[m_position];
+        if (c == '{' || c == '[') {
+            if (++m_depth > kMaxDepth) {
+                return fail("Nesting too deep");
+            }
+            bool parsed = c == '{' ? parseObject(outValue) : parseArray(outValue);
+            --m_depth;
+            return parsed;
+        }
+        if (c == '"') {
+            outValue.m_type = JsonValue::Type::String;
+            return parseString(outValue.m_string);
+        }
+        if (consumeLiteral("true")) {
+            outValue.m_type = JsonValue::Type::Bool;
+            outValue.m_bool = true;
+            return true;
+        }
+        if (consumeLiteral("false")) {
+            outValue.m_type = JsonValue::Type::Bool;
+            outValue.m_bool = false;
+            return true;
+        }
+        if (consumeLiteral("null")) {
+            outValue.m_type = JsonValue::Type::Null;
+            return true;
+        }
+        return parseNumber(outValue);
+    }
+
+    bool parseObject(JsonValue& outValue) {
+        ++m_position;
+        outValue.m_type = JsonValue::Type::Object;
+        if (consume('}')) {
+            return true;
+        }
+        do {
+            skipWhitespace();
+            std::string key;
+            if (m_position >= m_text.size() || m_text[m_position] != '"' || !parseString(key)) {
+                return fail("Expected object key");
+            }
+            if (!consume(':')) {
+                return fail("Expected ':'");
+            }
+            outValue.m_object.emplace_back(std::move(key), JsonValue());
+            if (!parseValue(outValue.m_object.back().second)) {
+                return false;
+            }
+        } while (consume(','));
+        return consume('}') || fail("Expected ',' or '}'");
+    }
+
+    bool parseArray(JsonValue& outValue) {
+        ++m_position;
+        outValue.m_type = JsonValue::Type::Array;
+        if (consume(']')) {
+            return true;
+        }
+        do {
+            outValue.m_array.emplace_back();
+            if (!parseValue(outValue.m_array.back())) {
+                return false;
+            }
+        } while (consume(','));
+        return consume(']') || fail("Expected ',' or ']'");
+    }
+
+    static void appendUtf8(std::string& out, unsigned int codepoint) {
+        if (codepoint < 0x80) {
+            out += static_cast<char>(codepoint);
+        }
+        else if (codepoint < 0x800) {
+            out += static_cast<char>(0xC0 | (codepoint >> 6));
+            out += static_cast<char>(0x80 | (codepoint & 0x3F));
+        }
+        else if (codepoint < 0x10000) {
+            out += static_cast<char>(0xE0 | (codepoint >> 12));
+            out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (codepoint & 0x3F));
+        }
+        else {
+            out += static_cast<char>(0xF0 | (codepoint >> 18));
+            out += static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+            out += static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+            out += static_cast<char>(0x80 | (codepoint & 0x3F));
+        }
+    }
+
+    bool parseHex4(unsigned int& outValue) {
+        if (m_text.size() - m_position < 4) {
+            return false;
+        }
+        outValue = 0;
+        for (int i = 0; i < 4; ++i) {
+            char c = m_text[m_position++];
+            outValue <<= 4;
+            if (c >= '0' && c <= '9') outValue |= c - '0';
+            else if (c >= 'a' && c <= 'f') outValue |= c - 'a' + 10;
+            else if (c >= 'A' && c <= 'F') outValue |= c - 'A' + 10;
+            else return false;
+        }
+        return true;
+    }
+
+    bool parseString(std::string& outString) {
+        ++m_position;
+        while (m_position < m_text.size()) {
+            char c = m_text[m_position++];
+            if (c == '"') {
+                return true;
+            }
+            if (static_cast<unsigned char>(c) < 0x20) {
+                return fail("Control character in string");
+            }
+            if (c != '\\') {
+                outString += c;
+                continue;
+            }
+            if (m_position >= m_text.size()) {
+                break;
+            }
+            char escape = m_text[m_position++];
+            switch (escape) {
+            case '"': outString += '"'; break;
+            case '\\': outString += '\\'; break;
+            case '/': outString += '/'; break;
+            case 'b': outString += '\b'; break;
+            case 'f': outString += '\f'; break;
+            case 'n': outString += '\n'; break;
+            case 'r': outString += '\r'; break;
+            case 't': outString += '\t'; break;
+            case 'u': {
+                unsigned int codepoint;
+                if (!parseHex4(codepoint)) {
+                    return fail("Invalid \\u escape");
+                }
+                if (codepoint >= 0xD800 && codepoint < 0xDC00) {
+                    unsigned int low;
+                    if (!consumeLiteral("\\u") || !parseHex4(low) || low < 0xDC00 || low >= 0xE000) {
+                        return fail("Invalid surrogate pair");
+                    }
+                    codepoint = 0x10000 + ((codepoint - 0xD800) << 10) + (low - 0xDC00);
+                }
+                appendUtf8(outString, codepoint);
+                break;
+            }
+            default:
+                return fail("Invalid escape");
+            }
+        }
+        return fail("Unterminated string");
+    }
+
+    bool parseNumber(JsonValue& outValue) {
+        size_t start = m_position;
+        if (m_position < m_text.size() && m_text[m_position] == '-') {
+            ++m_position;
+        }
+        while (m_position < m_text.size()) {
+            char c = m_text[m_position];
+            if ((c < '0' || c > '9') && c != '.' && c != 'e' && c != 'E' && c != '+' && c != '-') {
+                break;
+            }
+            ++m_position;
+        }
+        if (m_position == start) {
+            return fail("Unexpected character");
+        }
+
+        std::string number(m_text.substr(start, m_position - start));
+        char* end = nullptr;
+        outValue.m_number = std::strtod(number.c_str(), &end);
+        if (end != number.c_str() + number.size()) {
+            m_position = start;
+            return fail("Invalid number");
+        }
+        outValue.m_type = JsonValue::Type::Number;
+        return true;
+    }
+};
+
+bool JsonValue::parse(std::string_view text, JsonValue& outValue, std::string* outError) {
+    outValue = JsonValue();
+    if (text.size() >= 3 && text.substr(0, 3) == "\xEF\xBB\xBF") {
+        text.remove_prefix(3);
+    }
+
+    std::string error;
+    JsonParser parser(text);
+    if (!parser.parseDocument(outValue, error)) {
+        outValue = JsonValue();
+        if (outError) {
+            *outError = error;
+        }
+        return false;
+    }
+    return true;
+}
+
+const JsonValue* JsonValue::find(std::string_view key) const {
+    for (const auto& member : m_object) {
+        if (member.first == key) {
+            return &member.second;
+        }
+    }
+    return nullptr;
+}
\ No newline at end of file
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+// Minimal JSON document for reading config files. Object members keep their
+// file order; numbers are doubles.
+class JsonValue {
+public:
+    enum class Type {
+        Null,
+        Bool,
+        Number,
+        String,
+        Array,
+        Object
+    };
+
+    static bool parse(std::string_view text, JsonValue& outValue, std::string* outError = nullptr);
+
+    Type getType() const { return m_type; }
+    bool isNull() const { return m_type == Type::Null; }
+    bool isBool() const { return m_type == Type::Bool; }
+    bool isNumber() const { return m_type == Type::Number; }
+    bool isString() const { return m_type == Type::String; }
+    bool isArray() const { return m_type == Type::Array; }
+    bool isObject() const { return m_type == Type::Object; }
+
+    bool getBool(bool fallback = false) const { return isBool() ? m_bool : fallback; }
+    double getNumber(double fallback = 0.0) const { return isNumber() ? m_number : fallback; }
+    const std::string& getString() const { return m_string; }
+    const std::vector<JsonValue>& getArray() const { return m_array; }
+    const std::vector<std::pair<std::string, JsonValue>>& getObject() const { return m_object; }
+
+    // Member of an object by key, or nullptr.
+    const JsonValue* find(std::string_view key) const;
+
+private:
+    friend class JsonParser;
+
+    Type m_type = Type::Null;
+    bool m_bool = false;
+    double m_number = 0.0;
+    std::string m_string;
+    std::vector<JsonValue> m_array;
+    std::vector<std::pair<std::string, JsonValue>> m_object;
+};
\ No newline at end of file
@@ -0,0 +1,172 @@
+#include "Core/Lz4.h"
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace {
+    const size_t kMinMatch = 4;
+    // The format requires the last 5 bytes to be literals and the last match
+    // to start at least 12 bytes before the end.
+    const size_t kLastLiterals = 5;
+    const size_t kMatchFindLimit = 12;
+    const size_t kMaxOffset = 65535;
+    const int kHashBits = 12;
+
+    uint32_t read32(const unsigned char* p) {
+        uint32_t value;
+        std::memcpy(&value, p, sizeof(value));
+        return value;
+    }
+
+    uint32_t hashSequence(uint32_t sequence) {
+        return (sequence * 2654435761u) >> (32 - kHashBits);
+    }
+
+    void writeLength(unsigned char*& op, size_t length) {
+        while (length >= 255) {
+            *op++ = 255;
+            length -= 255;
+        }
+        *op++ = static_cast<unsigned char>(length);
+    }
+
+    void writeLiterals(unsigned char*& op, unsigned char* token, const unsigned char* literals, size_t length) {
+        *token = static_cast<unsigned char>((length < 15 ? length : 15) << 4);
+        if (length >= 15) {
+            writeLength(op, length - 15);
+        }
+        if (length > 0) {
+            std::memcpy(op, literals, length);
+            op += length;
+        }
+    }
+
+    bool readLength(const unsigned char*& ip, const unsigned char* ipEnd, size_t& length) {
+        unsigned char byte;
+        do {
+            if (ip >= ipEnd) {
+                return false;
+            }
+            byte = *ip++;
+            length += byte;
+        } while (byte == 255);
+        return true;
+    }
+}
+
+size_t lz4CompressBound(size_t size) {
+    return size + size / 255 + 16;
+}
+
+size_t lz4Compress(const unsigned char* src, size_t srcSize, unsigned char* dst, size_t dstCapacity) {
+    if (dstCapacity < lz4CompressBound(srcSize)) {
+        return 0;
+    }
+
+    unsigned char* op = dst;
+    size_t ip = 0;
+    size_t anchor = 0;
+
+    if (srcSize > kMatchFindLimit) {
+        std::vector<uint32_t> table(size_t(1) << kHashBits, 0);
+        const size_t matchStartLimit = srcSize - kMatchFindLimit;
+        const size_t matchEndLimit = srcSize - kLastLiterals;
+
+        while (ip < matchStartLimit) {
+            uint32_t sequence = read32(src + ip);
+            uint32_t& slot = table[hashSequence(sequence)];
+            size_t candidate = slot;
+            slot = static_cast<uint32_t>(ip);
+
+            if (candidate >= ip || ip - candidate > kMaxOffset || read32(src + candidate) != sequence) {
+                ++ip;
+                continue;
+            }
+
+            size_t matchLength = kMinMatch;
+            while (ip + matchLength < matchEndLimit && src[candidate + matchLength] == src[ip + matchLength]) {
+                ++matchLength;
+            }
+
+            unsigned char* token = op++;
+            writeLiterals(op, token, src + anchor, ip - anchor);
+
+            size_t offset = ip - candidate;
+            *op++ = static_cast<unsigned char>(offset & 0xFF);
+            *op++ = static_cast<unsigned char>(offset >> 8);
+
+            size_t extraLength = matchLength - kMinMatch;
+            *token |= static_cast<unsigned char>(extraLength < 15 ? extraLength : 15);
+            if (extraLength >= 15) {
+                writeLength(op, extraLength - 15);
+            }
+
+            ip += matchLength;
+            anchor = ip;
+        }
+    }
+
+    unsigned char* token = op++;
+    writeLiterals(op, token, src + anchor, srcSize - anchor);
+    return static_cast<size_t>(op - dst);
+}
+
+bool lz4Decompress(const unsigned char* src, size_t srcSize, unsigned char* dst, size_t dstSize) {
+    const unsigned char* ip = src;
+    const unsigned char* const ipEnd = src + srcSize;
+    unsigned char* op = dst;
+    unsigned char* const opEnd = dst + dstSize;
+
+    while (ip < ipEnd) {
+        const unsigned char token = *ip++;
+
+        size_t literalLength = token >> 4;
+        if (literalLength == 15 && !readLength(ip, ipEnd, literalLength)) {
+            return false;
+        }
+        if (literalLength > static_cast<size_t>(ipEnd - ip) || literalLength > static_cast<size_t>(opEnd - op)) {
+            return false;
+        }
+        if (literalLength > 0) {
+            std::memcpy(op, ip, literalLength);
+            op += literalLength;
+            ip += literalLength;
+        }
+
+        // The last sequence has no match part.
+        if (ip == ipEnd) {
+            return op == opEnd;
+        }
+
+        if (ipEnd - ip < 2) {
+            return false;
+        }
+        size_t offset = static_cast<size_t>(ip[0]) | (static_cast<size_t>(ip[1]) << 8);
+        ip += 2;
+        if (offset == 0 || offset > static_cast<size_t>(op - dst)) {
+            return false;
+        }
+
+        size_t matchLength = token & 15;
+        if (matchLength == 15 && !readLength(ip, ipEnd, matchLength)) {
+            return false;
+        }
+        matchLength += kMinMatch;
+        if (matchLength > static_cast<size_t>(opEnd - op)) {
+            return false;
+        }
+
+        const unsigned char* match = op - offset;
+        if (offset >= matchLength) {
+            std::memcpy(op, match, matchLength);
+            op += matchLength;
+        }
+        else {
+            // Overlapping copy repeats the last offset bytes.
+            for (size_t i = 0; i < matchLength; ++i) {
+                *op++ = match[i];
+            }
+        }
+    }
+    return false;
+}
\ No newline at end of file
@@ -0,0 +1,16 @@
+#pragma once
+
+#include <cstddef>
+
+// Minimal codec for the LZ4 block format, so archives written here can be
+// read by any LZ4 implementation and vice versa. The compressor is a simple
+// greedy one meant for offline packing; decompression is the fast path.
+
+size_t lz4CompressBound(size_t size);
+
+// Returns the compressed size, or 0 if dst is too small.
+size_t lz4Compress(const unsigned char* src, size_t srcSize, unsigned char* dst, size_t dstCapacity);
+
+// Decodes exactly dstSize bytes. Fails on malformed or truncated input rather
+// than reading or writing out of bounds.
+bool lz4Decompress(const unsigned char* src, size_t srcSize, unsigned char* dst, size_t dstSize);
\ No newline at end of file
@@ -0,0 +1,97 @@
+#include "Core/MappedFile.h"
+#include <iostream>
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile()
+    : m_data(nullptr), m_size(0),
+#ifdef _WIN32
+    m_fileHandle(INVALID_HANDLE_VALUE), m_mappingHandle(nullptr)
+#else
+    m_fileDescriptor(-1)
+#endif
+{
+}
+
+MappedFile::~MappedFile() {
+    close();
+}
+
+bool MappedFile::open(const std::string& path) {
+    close();
+    m_path = path;
+
+#ifdef _WIN32
+    m_fileHandle = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+    if (m_fileHandle == INVALID_HANDLE_VALUE) {
+        std::cerr << "ERROR::MAPPEDFILE: Could not open " << path << std::endl;
+        return false;
+    }
+
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(m_fileHandle, &fileSize) || fileSize.QuadPart == 0) {
+        std::cerr << "ERROR::MAPPEDFILE: Empty or unreadable file " << path << std::endl;
+        close();
+        return false;
+    }
+    m_size = static_cast<size_t>(fileSize.QuadPart);
+
+    m_mappingHandle = CreateFileMappingA(m_fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!m_mappingHandle) {
+        std::cerr << "ERROR::MAPPEDFILE: CreateFileMapping failed for " << path << std::endl;
+        close();
+        return false;
+    }
+
+    m_data = MapViewOfFile(m_mappingHandle, FILE_MAP_READ, 0, 0, 0);
+#else
+    m_fileDescriptor = ::open(path.c_str(), O_RDONLY);
+    if (m_fileDescriptor < 0) {
+        std::cerr << "ERROR::MAPPEDFILE: Could not open " << path << std::endl;
+        return false;
+    }
+
+    struct stat fileStat;
+    if (fstat(m_fileDescriptor, &fileStat) != 0 || fileStat.st_size == 0) {
+        std::cerr << "ERROR::MAPPEDFILE: Empty or unreadable file " << path << std::endl;
+        close();
+        return false;
+    }
+    m_size = static_cast<size_t>(fileStat.st_size);
+
+    void* mapping = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, m_fileDescriptor, 0);
+    m_data = mapping == MAP_FAILED ? nullptr : mapping;
+#endif
+
+    if (!m_data) {
+        std::cerr << "ERROR::MAPPEDFILE: Mapping failed for " << path << std::endl;
+        close();
+        return false;
+    }
+    return true;
+}
+
+void MappedFile::close() {
+#ifdef _WIN32
+    if (m_data) UnmapViewOfFile(m_data);
+    if (m_mappingHandle) CloseHandle(m_mappingHandle);
+    if (m_fileHandle != INVALID_HANDLE_VALUE) CloseHandle(m_fileHandle);
+    m_mappingHandle = nullptr;
+    m_fileHandle = INVALID_HANDLE_VALUE;
+#else
+    if (m_data) munmap(m_data, m_size);
+    if (m_fileDescriptor >= 0) ::close(m_fileDescriptor);
+    m_fileDescriptor = -1;
+#endif
+    m_data = nullptr;
+    m_size = 0;
+}
\ No newline at end of file
@@ -0,0 +1,65 @@
+#include "Core/MemoryOverlay.h"
+#include "Core/DebugDraw2D.h"
+#include "Core/MemoryTracker.h"
+#include "Core/FrameArena.h"
+
+static constexpr float kOverlayPadding = 6.0f;
+static constexpr float kColumnX[] = { 0.0f, 110.0f, 200.0f, 290.0f, 380.0f, 470.0f };
+static constexpr float kWidth = 570.0f;
+
+static FrameString formatBytes(int64_t bytes) {
+    if (bytes >= 1024 * 1024) {
+        return formatFrameString("%.1f MB", bytes / (1024.0 * 1024.0));
+    }
+    if (bytes >= 1024) {
+        return formatFrameString("%.1f KB", bytes / 1024.0);
+    }
+    return formatFrameString("%lld B", static_cast<long long>(bytes));
+}
+
+MemoryOverlay::MemoryOverlay()
+    : m_visible(false) {
+}
+
+float MemoryOverlay::render(DebugDraw2D& draw, float x, float y) {
+    if (!m_visible) {
+        return y;
+    }
+
+    const MemoryTracker& tracker = MemoryTracker::getInstance();
+    const glm::vec4 headerColor(1.0f, 0.85f, 0.3f, 1.0f);
+    const glm::vec4 rowColor(0.9f, 0.9f, 0.9f, 1.0f);
+    const float lineHeight = draw.getLineHeight();
+    const size_t rows = static_cast<size_t>(MemoryTag::Count) + 2 + (MemoryTracker::isHeapTrackingEnabled() ? 0 : 1);
+
+    draw.rect(x, y, kWidth, rows * lineHeight + 2.0f * kOverlayPadding, glm::vec4(0.0f, 0.0f, 0.0f, 0.6f));
+    x += kOverlayPadding;
+    y += kOverlayPadding;
+
+    const char* headers[] = { "Memory", "CPU live", "CPU peak", "GPU live", "GPU peak", "Allocs/frame" };
+    for (int column = 0; column < 6; ++column) {
+        draw.text(x + kColumnX[column], y, headers[column], headerColor);
+    }
+
+    auto drawRow = [&](const char* name, const MemoryStats& cpu, const MemoryStats& gpu, const glm::vec4& color) {
+        y += lineHeight;
+        draw.text(x + kColumnX[0], y, name, color);
+        draw.text(x + kColumnX[1], y, formatBytes(cpu.liveBytes), color);
+        draw.text(x + kColumnX[2], y, formatBytes(cpu.peakBytes), color);
+        draw.text(x + kColumnX[3], y, formatBytes(gpu.liveBytes), color);
+        draw.text(x + kColumnX[4], y, formatBytes(gpu.peakBytes), color);
+        draw.text(x + kColumnX[5], y, formatFrameString("%llu", static_cast<unsigned long long>(cpu.frameAllocations)), color);
+    };
+
+    for (size_t i = 0; i < static_cast<size_t>(MemoryTag::Count); ++i) {
+        MemoryTag tag = static_cast<MemoryTag>(i);
+        drawRow(MemoryTracker::getTagName(tag), tracker.getStats(MemoryDomain::Cpu, tag), tracker.getStats(MemoryDomain::Gpu, tag), rowColor);
+    }
+    drawRow("Total", tracker.getTotals(MemoryDomain::Cpu), tracker.getTotals(MemoryDomain::Gpu), headerColor);
+
+    if (!MemoryTracker::isHeapTrackingEnabled()) {
+        y += lineHeight;
+        draw.text(x, y, "CPU heap tracking is compiled out (ECSENGINE_NO_HEAP_TRACKING).", rowColor);
+    }
+    return y + lineHeight + kOverlayPadding;
+}
\ No newline at end of file
@@ -0,0 +1,19 @@
+#pragma once
+
+class DebugDraw2D;
+
+// Text overlay listing MemoryTracker's live and peak bytes per tag for CPU and
+// GPU, plus the heap allocations made during the last frame.
+class MemoryOverlay {
+public:
+    MemoryOverlay();
+
+    void toggle() { m_visible = !m_visible; }
+    bool isVisible() const { return m_visible; }
+
+    // Queues the table at (x, y), top left, and returns the y below it.
+    float render(DebugDraw2D& draw, float x, float y);
+
+private:
+    bool m_visible;
+};
\ No newline at end of file
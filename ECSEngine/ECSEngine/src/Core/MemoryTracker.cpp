@@ -0,0 +1,207 @@
+#include "Core/MemoryTracker.h"
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <new>
+
+static thread_local MemoryTag t_currentTag = MemoryTag::General;
+
+MemoryTracker& MemoryTracker::getInstance() {
+    // Constant-initialized, so it is usable from operator new during static
+    // initialization and after main returns.
+    static MemoryTracker instance;
+    return instance;
+}
+
+void MemoryTracker::add(Counters& counters, size_t bytes) {
+    int64_t live = counters.liveBytes.fetch_add(static_cast<int64_t>(bytes), std::memory_order_relaxed) + static_cast<int64_t>(bytes);
+    int64_t peak = counters.peakBytes.load(std::memory_order_relaxed);
+    while (live > peak && !counters.peakBytes.compare_exchange_weak(peak, live, std::memory_order_relaxed)) {
+    }
+    counters.liveAllocations.fetch_add(1, std::memory_order_relaxed);
+    counters.totalAllocations.fetch_add(1, std::memory_order_relaxed);
+    counters.currentFrameAllocations.fetch_add(1, std::memory_order_relaxed);
+}
+
+void MemoryTracker::subtract(Counters& counters, size_t bytes) {
+    counters.liveBytes.fetch_sub(static_cast<int64_t>(bytes), std::memory_order_relaxed);
+    counters.liveAllocations.fetch_sub(1, std::memory_order_relaxed);
+}
+
+MemoryStats MemoryTracker::read(const Counters& counters) {
+    MemoryStats stats;
+    stats.liveBytes = counters.liveBytes.load(std::memory_order_relaxed);
+    stats.peakBytes = counters.peakBytes.load(std::memory_order_relaxed);
+    stats.liveAllocations = counters.liveAllocations.load(std::memory_order_relaxed);
+    stats.totalAllocations = counters.totalAllocations.load(std::memory_order_relaxed);
+    stats.frameAllocations = counters.lastFrameAllocations.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void MemoryTracker::recordAllocation(MemoryDomain domain, MemoryTag tag, size_t bytes) {
+    Counters* counters = m_counters[static_cast<size_t>(domain)];
+    add(counters[static_cast<size_t>(tag)], bytes);
+    add(counters[kTagCount], bytes);
+}
+
+void MemoryTracker::recordFree(MemoryDomain domain, MemoryTag tag, size_t bytes) {
+    Counters* counters = m_counters[static_cast<size_t>(domain)];
+    subtract(counters[static_cast<size_t>(tag)], bytes);
+    subtract(counters[kTagCount], bytes);
+}
+
+MemoryStats MemoryTracker::getStats(MemoryDomain domain, MemoryTag tag) const {
+    return read(m_counters[static_cast<size_t>(domain)][static_cast<size_t>(tag)]);
+}
+
+MemoryStats MemoryTracker::getTotals(MemoryDomain domain) const {
+    return read(m_counters[static_cast<size_t>(domain)][kTagCount]);
+}
+
+void MemoryTracker::endFrame() {
+    for (auto& domain : m_counters) {
+        for (Counters& counters : domain) {
+            counters.lastFrameAllocations.store(counters.currentFrameAllocations.exchange(0, std::memory_order_relaxed), std::memory_order_relaxed);
+        }
+    }
+}
+
+const char* MemoryTracker::getTagName(MemoryTag tag) {
+    switch (tag) {
+    case MemoryTag::General: return "General";
+    case MemoryTag::Scene: return "Scene";
+    case MemoryTag::Component: return "Component";
+    case MemoryTag::Mesh: return "Mesh";
+    case MemoryTag::Texture: return "Texture";
+    case MemoryTag::Font: return "Font";
+    case MemoryTag::Shader: return "Shader";
+    case MemoryTag::Renderer: return "Renderer";
+    case MemoryTag::Count: break;
+    }
+    return "Unknown";
+}
+
+MemoryTag MemoryTracker::getCurrentTag() {
+    return t_currentTag;
+}
+
+void MemoryTracker::setCurrentTag(MemoryTag tag) {
+    t_currentTag = tag;
+}
+
+#ifdef ECSENGINE_NO_HEAP_TRACKING
+
+bool MemoryTracker::isHeapTrackingEnabled() {
+    return false;
+}
+
+#else
+
+bool MemoryTracker::isHeapTrackingEnabled() {
+    return true;
+}
+
+// Every allocation carries a header with its size and tag so the free is
+// charged to the same tag, whichever scope it happens in. The header keeps
+// the default new alignment.
+namespace {
+    struct alignas(alignof(std::max_align_t)) HeapHeader {
+        size_t size;
+        MemoryTag tag;
+    };
+
+    void* trackedAllocate(size_t size) noexcept {
+        HeapHeader* header = static_cast<HeapHeader*>(std::malloc(sizeof(HeapHeader) + size));
+        if (!header) {
+            return nullptr;
+        }
+        header->size = size;
+        header->tag = t_currentTag;
+        MemoryTracker::getInstance().recordAllocation(MemoryDomain::Cpu, header->tag, size);
+        return header + 1;
+    }
+
+    void trackedFree(void* pointer) noexcept {
+        if (!pointer) {
+            return;
+        }
+        HeapHeader* header = static_cast<HeapHeader*>(pointer) - 1;
+        MemoryTracker::getInstance().recordFree(MemoryDomain::Cpu, header->tag, header->size);
+        std::free(header);
+    }
+
+    // Over-aligned allocations pad the malloc block so the pointer handed out
+    // is aligned, and keep the block's start in the header to free it.
+    struct alignas(alignof(std::max_align_t)) AlignedHeapHeader {
+        void* block;
+        size_t size;
+        MemoryTag tag;
+    };
+
+    void* trackedAllocateAligned(size_t size, std::align_val_t alignment) noexcept {
+        const size_t align = std::max(static_cast<size_t>(alignment), alignof(AlignedHeapHeader));
+        const size_t overhead = sizeof(AlignedHeapHeader) + align - 1;
+        if (size > SIZE_MAX - overhead) {
+            return nullptr;
+        }
+        void* block = std::malloc(overhead + size);
+        if (!block) {
+            return nullptr;
+        }
+        uintptr_t address = (reinterpret_cast<uintptr_t>(block) + sizeof(AlignedHeapHeader) + align - 1) & ~(static_cast<uintptr_t>(align) - 1);
+        AlignedHeapHeader* header = reinterpret_cast<AlignedHeapHeader*>(address) - 1;
+        header->block = block;
+        header->size = size;
+        header->tag = t_currentTag;
+        MemoryTracker::getInstance().recordAllocation(MemoryDomain::Cpu, header->tag, size);
+        return header + 1;
+    }
+
+    void trackedFreeAligned(void* pointer) noexcept {
+        if (!pointer) {
+            return;
+        }
+        AlignedHeapHeader* header = static_cast<AlignedHeapHeader*>(pointer) - 1;
+        MemoryTracker::getInstance().recordFree(MemoryDomain::Cpu, header->tag, header->size);
+        std::free(header->block);
+    }
+
+    // An alignment of 0 means the default new alignment.
+    void* trackedAllocateOrThrow(size_t size, std::align_val_t alignment = std::align_val_t(0)) {
+        for (;;) {
+            void* pointer = alignment == std::align_val_t(0) ? trackedAllocate(size) : trackedAllocateAligned(size, alignment);
+            if (pointer) {
+                return pointer;
+            }
+            std::new_handler handler = std::get_new_handler();
+            if (!handler) {
+                throw std::bad_alloc();
+            }
+            handler();
+        }
+    }
+}
+
+void* operator new(size_t size) { return trackedAllocateOrThrow(size); }
+void* operator new[](size_t size) { return trackedAllocateOrThrow(size); }
+void* operator new(size_t size, const std::nothrow_t&) noexcept { return trackedAllocate(size); }
+void* operator new[](size_t size, const std::nothrow_t&) noexcept { return trackedAllocate(size); }
+void operator delete(void* pointer) noexcept { trackedFree(pointer); }
+void operator delete[](void* pointer) noexcept { trackedFree(pointer); }
+void operator delete(void* pointer, size_t) noexcept { trackedFree(pointer); }
+void operator delete[](void* pointer, size_t) noexcept { trackedFree(pointer); }
+void operator delete(void* pointer, const std::nothrow_t&) noexcept { trackedFree(pointer); }
+void operator delete[](void* pointer, const std::nothrow_t&) noexcept { trackedFree(pointer); }
+
+void* operator new(size_t size, std::align_val_t alignment) { return trackedAllocateOrThrow(size, alignment); }
+void* operator new[](size_t size, std::align_val_t alignment) { return trackedAllocateOrThrow(size, alignment); }
+void* operator new(size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return trackedAllocateAligned(size, alignment); }
+void* operator new[](size_t size, std::align_val_t alignment, const std::nothrow_t&) noexcept { return trackedAllocateAligned(size, alignment); }
+void operator delete(void* pointer, std::align_val_t) noexcept { trackedFreeAligned(pointer); }
+void operator delete[](void* pointer, std::align_val_t) noexcept { trackedFreeAligned(pointer); }
+void operator delete(void* pointer, size_t, std::align_val_t) noexcept { trackedFreeAligned(pointer); }
+void operator delete[](void* pointer, size_t, std::align_val_t) noexcept { trackedFreeAligned(pointer); }
+void operator delete(void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { trackedFreeAligned(pointer); }
+void operator delete[](void* pointer, std::align_val_t, const std::nothrow_t&) noexcept { trackedFreeAligned(pointer); }
+
+#endif
\ No newline at end of file
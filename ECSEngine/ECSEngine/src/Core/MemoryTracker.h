@@ -0,0 +1,95 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+// Subsystems that memory is attributed to. Heap allocations take the tag of
+// the innermost MemoryTagScope on the allocating thread.
+enum class MemoryTag : uint8_t {
+    General,
+    Scene,
+    Component,
+    Mesh,
+    Texture,
+    Font,
+    Shader,
+    Renderer,
+    Count
+};
+
+enum class MemoryDomain : uint8_t {
+    Cpu,
+    Gpu,
+    Count
+};
+
+struct MemoryStats {
+    int64_t liveBytes = 0;
+    int64_t peakBytes = 0;
+    int64_t liveAllocations = 0;
+    uint64_t totalAllocations = 0;
+    // Allocations made during the last completed frame.
+    uint64_t frameAllocations = 0;
+};
+
+// Live, peak and per-frame allocation counters by domain and tag. CPU numbers
+// come from the global operator new/delete replacement in MemoryTracker.cpp
+// (compiled out with ECSENGINE_NO_HEAP_TRACKING); GPU numbers are reported by
+// the code that creates buffers and textures, using estimated sizes.
+class MemoryTracker {
+public:
+    static MemoryTracker& getInstance();
+    MemoryTracker(const MemoryTracker&) = delete;
+    MemoryTracker& operator=(const MemoryTracker&) = delete;
+
+    void recordAllocation(MemoryDomain domain, MemoryTag tag, size_t bytes);
+    void recordFree(MemoryDomain domain, MemoryTag tag, size_t bytes);
+
+    MemoryStats getStats(MemoryDomain domain, MemoryTag tag) const;
+    MemoryStats getTotals(MemoryDomain domain) const;
+
+    // Publishes this frame's allocation counts and starts counting the next.
+    void endFrame();
+
+    static const char* getTagName(MemoryTag tag);
+    static bool isHeapTrackingEnabled();
+
+    static MemoryTag getCurrentTag();
+    static void setCurrentTag(MemoryTag tag);
+
+private:
+    constexpr MemoryTracker() = default;
+
+    struct Counters {
+        std::atomic<int64_t> liveBytes{ 0 };
+        std::atomic<int64_t> peakBytes{ 0 };
+        std::atomic<int64_t> liveAllocations{ 0 };
+        std::atomic<uint64_t> totalAllocations{ 0 };
+        std::atomic<uint64_t> currentFrameAllocations{ 0 };
+        std::atomic<uint64_t> lastFrameAllocations{ 0 };
+    };
+
+    static constexpr size_t kTagCount = static_cast<size_t>(MemoryTag::Count);
+    static constexpr size_t kDomainCount = static_cast<size_t>(MemoryDomain::Count);
+
+    // The extra slot per domain holds the domain total.
+    Counters m_counters[kDomainCount][kTagCount + 1];
+
+    static void add(Counters& counters, size_t bytes);
+    static void subtract(Counters& counters, size_t bytes);
+    static MemoryStats read(const Counters& counters);
+};
+
+// Attributes heap allocations on this thread to a tag until it goes out of scope.
+class MemoryTagScope {
+public:
+    explicit MemoryTagScope(MemoryTag tag) : m_previous(MemoryTracker::getCurrentTag()) { MemoryTracker::setCurrentTag(tag); }
+    ~MemoryTagScope() { MemoryTracker::setCurrentTag(m_previous); }
+
+    MemoryTagScope(const MemoryTagScope&) = delete;
+    MemoryTagScope& operator=(const MemoryTagScope&) = delete;
+
+private:
+    MemoryTag m_previous;
+};
\ No newline at end of file
@@ -1,20 +1,24 @@
 #include "Mesh.h"
+#include "Core/MemoryTracker.h"
+#include "Core/FrameStats.h"
 #include <iostream>
 #include <numeric>
 #include <limits> 
 
 Mesh::Mesh(const std::string& name)
-    : m_name(name), VAO(0), VBO(0), EBO(0),
+    : m_name(name), VAO(0), VBO(0), EBO(0), m_gpuByteSize(0), m_primitive(MeshPrimitive::Cube), m_primitiveParameter(0.0f),
     m_localAABBMin(std::numeric_limits<float>::max()), 
     m_localAABBMax(std::numeric_limits<float>::lowest())
 {
+    MemoryTagScope memoryScope(MemoryTag::Mesh);
     createDefaultCube();
     setupMesh();
     calculateLocalAABB();
 }
 
 Mesh::Mesh(std::vector<Vertex> vertices, std::vector<unsigned int> indices, const std::string& name)
-    : m_name(name), m_vertices(std::move(vertices)), m_indices(std::move(indices)), VAO(0), VBO(0), EBO(0),
+    : m_name(name), m_vertices(std::move(vertices)), m_indices(std::move(indices)), VAO(0), VBO(0), EBO(0), m_gpuByteSize(0),
+    m_primitive(MeshPrimitive::Custom), m_primitiveParameter(0.0f),
     m_localAABBMin(std::numeric_limits<float>::max()),
     m_localAABBMax(std::numeric_limits<float>::lowest())
 {
@@ -27,6 +31,7 @@ Mesh::~Mesh() {
         glDeleteVertexArrays(1, &VAO);
         glDeleteBuffers(1, &VBO);
         glDeleteBuffers(1, &EBO);
+        MemoryTracker::getInstance().recordFree(MemoryDomain::Gpu, MemoryTag::Mesh, m_gpuByteSize);
     }
 }
 
@@ -36,6 +41,7 @@ void Mesh::draw() {
     }
     glBindVertexArray(VAO);
     glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(m_indices.size()), GL_UNSIGNED_INT, 0);
+    FrameStats::getInstance().countDrawCall(m_indices.size() / 3);
     GLenum error = glGetError();
     if (error != GL_NO_ERROR) {
         std::cerr << "OpenGL Error inside Mesh::draw() for " << m_name << ": " << error << std::endl;
@@ -53,6 +59,7 @@ void Mesh::setupMesh() {
         glDeleteVertexArrays(1, &VAO);
         glDeleteBuffers(1, &VBO);
         glDeleteBuffers(1, &EBO);
+        MemoryTracker::getInstance().recordFree(MemoryDomain::Gpu, MemoryTag::Mesh, m_gpuByteSize);
     }
 
     glGenVertexArrays(1, &VAO);
@@ -65,6 +72,8 @@ void Mesh::setupMesh() {
 
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, EBO);
     glBufferData(GL_ELEMENT_ARRAY_BUFFER, m_indices.size() * sizeof(unsigned int), &m_indices[0], GL_STATIC_DRAW);
+    m_gpuByteSize = getByteSize();
+    MemoryTracker::getInstance().recordAllocation(MemoryDomain::Gpu, MemoryTag::Mesh, m_gpuByteSize);
 
     glEnableVertexAttribArray(0);
     glVertexAttribPointer(0, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (void*)0);
@@ -96,6 +105,8 @@ void Mesh::calculateLocalAABB() {
 
 
 void Mesh::createDefaultCube() {
+    m_primitive = MeshPrimitive::Cube;
+    m_primitiveParameter = 0.0f;
     m_vertices = {
         {{-0.5f, -0.5f,  0.5f}, {0.0f, 0.0f, 1.0f}, {0.0f, 1.0f}}, 
         {{ 0.5f, -0.5f,  0.5f}, {0.0f, 0.0f, 1.0f}, {1.0f, 1.0f}}, 
@@ -140,6 +151,8 @@ void Mesh::createDefaultCube() {
 
 void Mesh::generatePlane(float tileFactor) {
     m_name = "Generated Plane";
+    m_primitive = MeshPrimitive::Plane;
+    m_primitiveParameter = tileFactor;
     m_vertices = {
         {{-0.5f, 0.0f,  0.5f}, {0.0f, 1.0f, 0.0f}, {0.0f * tileFactor, 1.0f * tileFactor}}, 
         {{ 0.5f, 0.0f,  0.5f}, {0.0f, 1.0f, 0.0f}, {1.0f * tileFactor, 1.0f * tileFactor}}, 
@@ -157,6 +170,8 @@ void Mesh::generatePlane(float tileFactor) {
 
 void Mesh::generateQuad2D() {
     m_name = "Generated 2D Quad";
+    m_primitive = MeshPrimitive::Quad2D;
+    m_primitiveParameter = 0.0f;
     m_vertices.clear();
     m_indices.clear();
 
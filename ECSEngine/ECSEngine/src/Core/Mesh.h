@@ -1,5 +1,6 @@
 #pragma once
 
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <glm/glm.hpp>
@@ -13,6 +14,15 @@ struct Vertex {
 };
 
 
+// Which built-in generator produced the mesh, so scenes can refer to it
+// without storing the vertices.
+enum class MeshPrimitive : uint32_t {
+    Custom = 0,
+    Cube = 1,
+    Plane = 2,
+    Quad2D = 3
+};
+
 struct MeshTexture {
     unsigned int id;
     std::string type;
@@ -33,6 +43,18 @@ public:
     void generatePlane(float tileFactor = 1.0f);
     void generateQuad2D();
 
+    // Vertex and index data; the same amount lives in the GL buffers and in
+    // the CPU-side copies kept for AABB and picking queries.
+    size_t getByteSize() const { return m_vertices.size() * sizeof(Vertex) + m_indices.size() * sizeof(unsigned int); }
+
+    MeshPrimitive getPrimitive() const { return m_primitive; }
+    // Tile factor for planes, 0 otherwise.
+    float getPrimitiveParameter() const { return m_primitiveParameter; }
+
+    // For callers that add their own attributes, such as per-instance data.
+    unsigned int getVertexArray() const { return VAO; }
+    size_t getIndexCount() const { return m_indices.size(); }
+
     const glm::vec3& getLocalAABBMin() const { return m_localAABBMin; }
     const glm::vec3& getLocalAABBMax() const { return m_localAABBMax; }
 
@@ -42,6 +64,10 @@ private:
     std::vector<unsigned int> m_indices;
 
     unsigned int VAO, VBO, EBO;
+    size_t m_gpuByteSize;
+
+    MeshPrimitive m_primitive;
+    float m_primitiveParameter;
 
     glm::vec3 m_localAABBMin;
     glm::vec3 m_localAABBMax;
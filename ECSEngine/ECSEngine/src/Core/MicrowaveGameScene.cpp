@@ -7,9 +7,11 @@
 #include "Components/Camera2DComponent.h"
 #include "Components/ClickableComponent.h" 
 #include "Core/FontRenderer.h"
+#include "Core/FrameArena.h"
 #include "Core/AssetManager.h"
 #include "Core/Shader.h"
 #include "Core/Texture.h"
+#include "Core/TextureAtlas.h"
 #include "Core/Mesh.h"
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
@@ -17,12 +19,18 @@
 #include <glm/glm.hpp>
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtx/string_cast.hpp>
-#include <iomanip>
-#include <sstream>
 #include <cmath>
+#include <algorithm>
+#include <iterator>
+
+static std::string keypadLabelSpriteName(std::string_view label) {
+	return std::string("KeypadLabel_").append(label);
+}
 
 MicrowaveGameScene::MicrowaveGameScene(const std::string& name)
 	: Scene(name),
+	m_tickAccumulator(0.0f),
+	m_visualState(s_visualStates, VisualState::Off),
 	m_microwaveGameObject(nullptr),
 	m_windowGameObject(nullptr),
 	m_hexContainerGameObject(nullptr),
@@ -30,13 +38,15 @@ MicrowaveGameScene::MicrowaveGameScene(const std::string& name)
 	m_windowPivotGameObject(nullptr),
 	m_interiorContainerGameObject(nullptr),
 	m_displayContainer(nullptr),
+	m_smokeFilterGameObject(nullptr),
+	m_timerTextRenderComponent(nullptr),
+	m_hexRenderComponent(nullptr),
+	m_smokeFilterRenderComponent(nullptr),
 	m_doorAnimationTime(0.0f),
 	m_animationDuration(0.5f),
 	m_initialWindowWorldX(0.0f),
 	m_initialWindowWorldY(0.0f), 
 	m_initialWindowWidth(0.0f),
-	m_timerTextRenderComponent(nullptr),
-	m_hexRenderComponent(nullptr),
 	m_flickerTimer(0.0f),
 	m_flickerSpeed(20.0f),
 	m_flickerMinAlpha(0.2f),
@@ -50,8 +60,16 @@ MicrowaveGameScene::MicrowaveGameScene(const std::string& name)
 	m_runningStateIndicatorRenderComponent(nullptr),
 	m_runningBlinkTimer(0.0f),
 	m_runningBlinkInterval(0.55f),
-	m_isIndicatorVisible(true)
+	m_isIndicatorVisible(true),
+	m_startAction(kInvalidInputAction),
+	m_stopAction(kInvalidInputAction),
+	m_clearAction(kInvalidInputAction),
+	m_repairAction(kInvalidInputAction),
+	m_toggleHexAction(kInvalidInputAction),
+	m_doorAction(kInvalidInputAction),
+	m_breakAction(kInvalidInputAction)
 {
+	std::fill(std::begin(m_digitActions), std::end(m_digitActions), kInvalidInputAction);
 	std::cout << "MicrowaveGameScene '" << m_name << "' created." << std::endl;
 }
 
@@ -66,8 +84,49 @@ void MicrowaveGameScene::Init() {
 	glDisable(GL_CULL_FACE);
 
 	Scene::Init();
+
+	InputManager& input = InputManager::getInstance();
+	for (int i = 0; i <= 9; ++i) {
+		m_digitActions[i] = input.getActionId("microwave.digit" + std::to_string(i));
+	}
+	m_startAction = input.getActionId("microwave.start");
+	m_stopAction = input.getActionId("microwave.stop");
+	m_clearAction = input.getActionId("microwave.clear");
+	m_repairAction = input.getActionId("microwave.repair");
+	m_toggleHexAction = input.getActionId("microwave.toggleHex");
+	m_doorAction = input.getActionId("microwave.door");
+	m_breakAction = input.getActionId("microwave.break");
+
 	std::cout << "MicrowaveGameScene '" << m_name << "' initialized with 2D objects." << std::endl;
 	SetupMicrowaveGameObjects();
+	m_visualState.enter(*this);
+}
+
+MicrowaveGameScene::VisualEvent MicrowaveGameScene::toVisualEvent(Microwave::State state) {
+	switch (state) {
+	case Microwave::IDLE: return VisualEvent::Idle;
+	case Microwave::COOKING: return VisualEvent::Cooking;
+	case Microwave::COOKING_COMPLETE: return VisualEvent::CookingComplete;
+	case Microwave::BROKEN: return VisualEvent::Broken;
+	}
+	return VisualEvent::Idle;
+}
+
+void MicrowaveGameScene::enterOff(MicrowaveGameScene& scene) {
+	if (scene.m_runningStateIndicatorRenderComponent) {
+		scene.m_runningStateIndicatorRenderComponent->setObjectColor(glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
+	}
+	scene.m_isIndicatorVisible = true;
+	scene.m_runningBlinkTimer = 0.0f;
+}
+
+void MicrowaveGameScene::exitBroken(MicrowaveGameScene& scene) {
+	if (!scene.m_isErrorTextVisible) {
+		scene.m_isErrorTextVisible = true;
+		scene.updateTimerDisplay();
+	}
+	scene.m_errorBlinkTimer = 0.0f;
+	scene.m_flickerTimer = 0.0f;
 }
 
 
@@ -85,20 +144,70 @@ glm::vec4 MicrowaveGameScene::calculateFlicker(float time, float speed) {
 }
 
 
-void MicrowaveGameScene::Update(float deltaTime) {
-	Scene::Update(deltaTime);
+void MicrowaveGameScene::FixedUpdate(float fixedDeltaTime) {
+	Scene::FixedUpdate(fixedDeltaTime);
 
-	static float accumulatedTimeForTick = 0.0f;
-	accumulatedTimeForTick += deltaTime;
-
-	if (accumulatedTimeForTick >= 1.0f) {
+	m_tickAccumulator += fixedDeltaTime;
+	if (m_tickAccumulator >= 1.0f) {
 		m_microwave.tick();
 		updateTimerDisplay(); 
 
-		accumulatedTimeForTick -= 1.0f;
+		m_tickAccumulator -= 1.0f;
 	}
+}
 
-	if (m_microwave.getCurrentState() == Microwave::State::BROKEN) {
+// Called once per triggered action instead of polling every bound key each frame.
+void MicrowaveGameScene::handleAction(InputActionId action) {
+	for (int i = 0; i <= 9; ++i) {
+		if (action == m_digitActions[i]) {
+			m_microwave.inputNumber(i);
+			updateTimerDisplay();
+			return;
+		}
+	}
+
+	if (action == m_startAction) {
+		m_microwave.startCooking();
+	}
+	else if (action == m_stopAction) {
+		m_microwave.stopCooking();
+		updateTimerDisplay();
+	}
+	else if (action == m_clearAction) {
+		m_microwave.clearInput();
+		updateTimerDisplay();
+	}
+	else if (action == m_repairAction) {
+		m_microwave.repairMicrowave();
+		updateTimerDisplay();
+	}
+	else if (action == m_toggleHexAction) {
+		m_hexContainerGameObject->getComponent<RenderComponent>()->m_objectColor.a = m_hexContainerGameObject->getComponent<RenderComponent>()->m_objectColor.a == 0.5f ? 1.0f : 0.5f;
+	}
+	else if (action == m_doorAction) {
+		if (m_microwave.getDoorState() == Microwave::DoorState::CLOSED) {
+			m_microwave.openDoor();
+			m_currentDoorTargetAngle = -180.0f;
+		}
+		else {
+			m_microwave.closeDoor();
+			m_currentDoorTargetAngle = 0.0f;
+		}
+		m_doorAnimationTime = 0.0f;
+	}
+	else if (action == m_breakAction) {
+		m_microwave.breakMicrowave();
+		updateTimerDisplay();
+	}
+}
+
+void MicrowaveGameScene::Update(float deltaTime) {
+	Scene::Update(deltaTime);
+
+	m_visualState.dispatch(toVisualEvent(m_microwave.getCurrentState()), *this);
+	const VisualState visualState = m_visualState.getState();
+
+	if (visualState == VisualState::Broken) {
 		m_flickerTimer += deltaTime;
 		if (m_lightContainerGameObject && m_lightContainerGameObject->getComponent<RenderComponent>()) {
 			RenderComponent* lightRenderComp = m_lightContainerGameObject->getComponent<RenderComponent>();
@@ -123,17 +232,17 @@ void MicrowaveGameScene::Update(float deltaTime) {
 			m_smokeFilterRenderComponent->setObjectColor(glm::vec4(0.5f, 0.5f, 0.5f, newSmokeAlpha));
 		}
 	}
-	else if (m_microwave.getCurrentState() == Microwave::State::COOKING) {
+	else {
 		if (m_lightContainerGameObject && m_lightContainerGameObject->getComponent<RenderComponent>()) {
 			RenderComponent* lightRenderComp = m_lightContainerGameObject->getComponent<RenderComponent>();
 			glm::vec4 currentColor = lightRenderComp->m_objectColor;
-			float targetAlpha = m_microwave.isLightOn() ? m_baseLightColor.a : 0.0f; 
+			float targetAlpha = m_microwave.isLightOn() ? m_baseLightColor.a : 0.0f;
 			float fadeSpeed = 5.0f;
 			currentColor.a = glm::mix(currentColor.a, targetAlpha, deltaTime * fadeSpeed);
 			lightRenderComp->setObjectColor(currentColor);
 		}
 
-		if (m_runningStateIndicatorRenderComponent) {
+		if (visualState == VisualState::Running && m_runningStateIndicatorRenderComponent) {
 			m_runningBlinkTimer += deltaTime;
 			if (m_runningBlinkTimer >= m_runningBlinkInterval) {
 				m_isIndicatorVisible = !m_isIndicatorVisible;
@@ -146,99 +255,22 @@ void MicrowaveGameScene::Update(float deltaTime) {
 				m_runningBlinkTimer -= m_runningBlinkInterval;
 			}
 		}
-		if (!m_isErrorTextVisible) { m_isErrorTextVisible = true; updateTimerDisplay(); }
-		m_errorBlinkTimer = 0.0f;
-		m_flickerTimer = 0.0f;
-		if (m_smokeFilterRenderComponent) {
-			float targetAlpha = 0.0f;
-			float decreaseSpeed = 0.5f;
-			float currentSmokeAlpha = m_smokeFilterRenderComponent->m_objectColor.a;
-			float newSmokeAlpha = glm::max(currentSmokeAlpha - deltaTime * decreaseSpeed, targetAlpha);
-			m_smokeFilterRenderComponent->setObjectColor(glm::vec4(0.5f, 0.5f, 0.5f, newSmokeAlpha));
-		}
-	}
-	else { 
-		if (m_lightContainerGameObject && m_lightContainerGameObject->getComponent<RenderComponent>()) {
-			RenderComponent* lightRenderComp = m_lightContainerGameObject->getComponent<RenderComponent>();
-			glm::vec4 currentColor = lightRenderComp->m_objectColor;
-
-			float targetAlpha = m_microwave.isLightOn() ? m_baseLightColor.a : 0.0f;
-			float fadeSpeed = 5.0f;
-
-			currentColor.a = glm::mix(currentColor.a, targetAlpha, deltaTime * fadeSpeed);
-			lightRenderComp->setObjectColor(currentColor);
-		}
-		if (!m_isErrorTextVisible) {
-			m_isErrorTextVisible = true;
-			updateTimerDisplay();
-		}
-		m_errorBlinkTimer = 0.0f;
-		m_flickerTimer = 0.0f; 
 
 		if (m_smokeFilterRenderComponent) {
 			float targetAlpha = 0.0f;
-			float decreaseSpeed = 0.5f; 
+			float decreaseSpeed = 0.5f;
 			float currentSmokeAlpha = m_smokeFilterRenderComponent->m_objectColor.a;
 			float newSmokeAlpha = glm::max(currentSmokeAlpha - deltaTime * decreaseSpeed, targetAlpha);
 			m_smokeFilterRenderComponent->setObjectColor(glm::vec4(0.5f, 0.5f, 0.5f, newSmokeAlpha));
 		}
-		if (m_runningStateIndicatorRenderComponent) {
-			m_runningStateIndicatorRenderComponent->setObjectColor(glm::vec4(0.0f, 0.0f, 0.0f, 1.0f)); 
-			m_isIndicatorVisible = true; 
-		}
-		m_runningBlinkTimer = 0.0f; 
 	}
 
-
-	for (int i = 0; i <= 9; ++i) {
-		int glfw_key = GLFW_KEY_0 + i;
-		if (InputManager::getInstance().isKeyJustPressed(glfw_key)) {
-			m_microwave.inputNumber(i);
-			updateTimerDisplay();
+	for (const InputActionEvent& action : InputManager::getInstance().getActionEvents()) {
+		if (action.pressed) {
+			handleAction(action.action);
 		}
 	}
 
-	if (InputManager::getInstance().isKeyJustPressed(GLFW_KEY_ENTER)) {
-		m_microwave.startCooking();
-	}
-
-	if (InputManager::getInstance().isKeyJustPressed(GLFW_KEY_BACKSPACE)) { 
-		m_microwave.stopCooking();
-		updateTimerDisplay();
-	}
-
-	if (InputManager::getInstance().isKeyJustPressed(GLFW_KEY_DELETE)) { 
-		m_microwave.clearInput();
-		updateTimerDisplay();
-	}
-
-
-	if (InputManager::getInstance().isKeyJustPressed(GLFW_KEY_R)) { 
-		m_microwave.repairMicrowave();
-		updateTimerDisplay(); 
-	}
-
-	if (InputManager::getInstance().isKeyJustPressed(GLFW_KEY_P)) {
-		m_hexContainerGameObject->getComponent<RenderComponent>()->m_objectColor.a = m_hexContainerGameObject->getComponent<RenderComponent>()->m_objectColor.a == 0.5f ? 1.0f : 0.5f;
-	}
-
-	if (InputManager::getInstance().isKeyJustPressed(GLFW_KEY_SPACE)) {
-		if (m_microwave.getDoorState() == Microwave::DoorState::CLOSED) {
-			m_microwave.openDoor();
-			m_currentDoorTargetAngle = -180.0f; 
-		}
-		else {
-			m_microwave.closeDoor();
-			m_currentDoorTargetAngle = 0.0f; 
-		}
-		m_doorAnimationTime = 0.0f;
-	}
-
-	if (InputManager::getInstance().isKeyJustPressed(GLFW_KEY_X)) {
-		m_microwave.breakMicrowave();
-		updateTimerDisplay();
-	}
-
 
 	if (m_windowPivotGameObject && m_windowPivotGameObject->getTransform()) {
 		float currentAnimatedDoorAngle = m_windowPivotGameObject->getTransform()->getLocalEulerAnglesDegrees().y;
@@ -269,7 +301,7 @@ void MicrowaveGameScene::Render() {
 	Scene::Render();
 
 	if (m_fontRenderer) {
-		std::string nameText = "Milan Arežina, SV55/2021";
+		std::string_view nameText = "Milan Arežina, SV55/2021";
 		float nameTextScale = 0.3f;
 		float estimatedCharWidth = 48.0f * 0.6f;
 		float textPixelWidth = nameText.length() * estimatedCharWidth * nameTextScale;
@@ -318,6 +350,7 @@ void MicrowaveGameScene::Shutdown() {
 	m_timerTextRenderComponent = nullptr;
 	m_hexRenderComponent = nullptr;
 	Scene::Shutdown();
+	m_timerTextTexture.reset();
 	std::cout << "MicrowaveGameScene '" << m_name << "' shutdown complete." << std::endl;
 }
 
@@ -327,7 +360,7 @@ void MicrowaveGameScene::updateTimerDisplay() {
 		return;
 	}
 
-	std::string timeString;
+	FrameString timeString(&FrameArena::getThreadInstance());
 	glm::vec4 textColor = glm::vec4(1.0f, 1.0f, 1.0f, 1.0f); 
 
 	if (m_microwave.getCurrentState() == Microwave::State::BROKEN) {
@@ -341,14 +374,20 @@ void MicrowaveGameScene::updateTimerDisplay() {
 	}
 	else {
 		Microwave::Time remainingTime = m_microwave.getRemainingTime();
-		std::stringstream ss;
-		ss << std::setfill('0') << std::setw(2) << remainingTime.minutes << ":"
-			<< std::setfill('0') << std::setw(2) << remainingTime.seconds;
-		timeString = ss.str();
+		timeString = formatFrameString("%02d:%02d", remainingTime.minutes, remainingTime.seconds);
 	}
 
 	float timerTextPixelSize = 64.0f;
 
+	if (m_timerTextTexture && m_fontRenderer->UpdateTextTexture(*m_timerTextTexture,
+		"res/fonts/Roboto-Regular.ttf",
+		timeString,
+		static_cast<int>(timerTextPixelSize))) {
+		m_timerTextRenderComponent->setTexture(m_timerTextTexture);
+		m_timerTextRenderComponent->setObjectColor(textColor);
+		return;
+	}
+
 	std::unique_ptr<Texture> newTimerTextTexture = m_fontRenderer->GenerateTextTexture(
 		"res/fonts/Roboto-Regular.ttf",
 		timeString,
@@ -356,7 +395,8 @@ void MicrowaveGameScene::updateTimerDisplay() {
 	);
 
 	if (newTimerTextTexture) {
-		m_timerTextRenderComponent->setTexture(std::shared_ptr<Texture>(std::move(newTimerTextTexture)));
+		m_timerTextTexture = std::move(newTimerTextTexture);
+		m_timerTextRenderComponent->setTexture(m_timerTextTexture);
 		m_timerTextRenderComponent->setObjectColor(textColor);
 	}
 	else {
@@ -373,8 +413,35 @@ void MicrowaveGameScene::SetupMicrowaveGameObjects() {
 		std::cerr << "ERROR: Failed to load basic shader! Objects may not render." << std::endl;
 		return;
 	}
-	std::shared_ptr<Texture> wallTexture = AssetManager::getInstance().getTexture("res/textures/pizza.png", "diffuse");
-	std::shared_ptr<Texture> grassTexture = AssetManager::getInstance().getTexture("res/textures/kitchenCounter.png", "diffuse");
+	// All 2D sprites of the scene share one atlas texture: the images, the
+	// keypad labels (rasterized once here) and, for plain coloured quads, the
+	// atlas' solid sprite. Only the timer text keeps its own texture since it
+	// changes while running. Falls back to individual textures if the atlas
+	// can't be built.
+	const float keypadTextPixelSize = 48.0f;
+	std::vector<AtlasImage> keypadLabels;
+	for (const char* label : { "0", "1", "2", "3", "4", "5", "6", "7", "8", "9", "START", "STOP" }) {
+		AtlasImage image;
+		image.name = keypadLabelSpriteName(label);
+		if (m_fontRenderer->RasterizeText("res/fonts/Roboto-Regular.ttf", label, static_cast<int>(keypadTextPixelSize), image)) {
+			keypadLabels.push_back(std::move(image));
+		}
+	}
+
+	AtlasSprite wallSprite;
+	AtlasSprite grassSprite;
+	AtlasSprite solidSprite;
+	std::shared_ptr<TextureAtlas> spriteAtlas = AssetManager::getInstance().buildTextureAtlas("MicrowaveSprites",
+		{ "res/textures/pizza.png", "res/textures/kitchenCounter.png" }, keypadLabels);
+	if (spriteAtlas) {
+		wallSprite = spriteAtlas->getSprite("res/textures/pizza.png");
+		grassSprite = spriteAtlas->getSprite("res/textures/kitchenCounter.png");
+		solidSprite = spriteAtlas->getSprite(TextureAtlas::kSolidSprite);
+	}
+	else {
+		wallSprite.texture = AssetManager::getInstance().getTexture("res/textures/pizza.png", "diffuse");
+		grassSprite.texture = AssetManager::getInstance().getTexture("res/textures/kitchenCounter.png", "diffuse");
+	}
 
 
 	auto cameraObject = std::make_unique<GameObject>("MainCamera");
@@ -503,7 +570,7 @@ void MicrowaveGameScene::SetupMicrowaveGameObjects() {
 	bgMeshComp->getMesh()->generateQuad2D();
 	bgRenderComp = background->addComponent<RenderComponent>(basicShader);
 	bgRenderComp->setMesh(bgMeshComp->getMesh());
-	bgRenderComp->setTexture(grassTexture);
+	bgRenderComp->setSprite(grassSprite);
 	bgRenderComp->setObjectColor(glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
 	background->getTransform()->setLocalPosition(glm::vec3(getWindowWidth() / 2.0f, getWindowHeight() / 2.0f, 0.0f));
 	background->getTransform()->setLocalScale(glm::vec3(getWindowWidth(), getWindowHeight(), 1.0f));
@@ -514,7 +581,7 @@ void MicrowaveGameScene::SetupMicrowaveGameObjects() {
 	smokeFilterRenderComp = smokeFilter->addComponent<RenderComponent>(basicShader);
 	smokeFilterRenderComp->setMesh(smokeFilterMeshComp->getMesh());
 	smokeFilterRenderComp->setObjectColor(smokeFilterColor);
-	smokeFilterRenderComp->setTexture(nullptr);
+	smokeFilterRenderComp->setSprite(solidSprite);
 	smokeFilter->getTransform()->setLocalPosition(glm::vec3(getWindowWidth() / 2.0f, getWindowHeight() / 2.0f, 0.0f));
 	smokeFilter->getTransform()->setLocalScale(glm::vec3(getWindowWidth(), getWindowHeight(), 1.0f));
 	m_smokeFilterRenderComponent = smokeFilterRenderComp;
@@ -525,7 +592,7 @@ void MicrowaveGameScene::SetupMicrowaveGameObjects() {
 	mwBodyRenderComp = microwaveBody->addComponent<RenderComponent>(basicShader);
 	mwBodyRenderComp->setMesh(mwBodyMeshComp->getMesh());
 	mwBodyRenderComp->setObjectColor(microwaveBodyColor);
-	mwBodyRenderComp->setTexture(nullptr);
+	mwBodyRenderComp->setSprite(solidSprite);
 	m_microwaveGameObject = AddGameObject(std::move(microwaveBody));
 	m_microwaveGameObject->getTransform()->setLocalPosition(glm::vec3(microwavePosX, microwavePosY, 0.0f));
 	m_microwaveGameObject->getTransform()->setLocalScale(glm::vec3(microwaveWidth, microwaveHeight, 1.0f));
@@ -551,7 +618,7 @@ void MicrowaveGameScene::SetupMicrowaveGameObjects() {
 	RenderComponent* mwInteriorRenderComp = interiorContainer->addComponent<RenderComponent>(basicShader);
 	mwInteriorRenderComp->setMesh(mwInteriorComp->getMesh());
 	mwInteriorRenderComp->setObjectColor(glm::vec4(0.8f, 0.8f, 0.8f, 1.0f));
-	mwInteriorRenderComp->setTexture(nullptr);
+	mwInteriorRenderComp->setSprite(solidSprite);
 	m_interiorContainerGameObject = m_microwaveGameObject->addChild(std::move(interiorContainer));
 	
 
@@ -561,7 +628,7 @@ void MicrowaveGameScene::SetupMicrowaveGameObjects() {
 	lightRenderComp->setMesh(lightMeshComp->getMesh());
 	m_baseLightColor.a = 0.7f; 
 	lightRenderComp->setObjectColor(m_baseLightColor);
-	lightRenderComp->setTexture(nullptr);
+	lightRenderComp->setSprite(solidSprite);
 	lightContainer->getTransform()->setLocalPosition(glm::vec3(0.0f, 0.0f, 0.0f));
 	lightContainer->getTransform()->setLocalScale(glm::vec3(1.0f, 1.0f, 1.0f));
 	m_lightContainerGameObject = m_interiorContainerGameObject->addChild(std::move(lightContainer));
@@ -570,7 +637,7 @@ void MicrowaveGameScene::SetupMicrowaveGameObjects() {
 	foodMeshComp->getMesh()->generateQuad2D();
 	foodRenderComp = foodContainer->addComponent<RenderComponent>(basicShader);
 	foodRenderComp->setMesh(foodMeshComp->getMesh());
-	foodRenderComp->setTexture(wallTexture);
+	foodRenderComp->setSprite(wallSprite);
 	foodRenderComp->setObjectColor(glm::vec4(0.6f, 0.4f, 0.2f, 1.0f));
 	foodContainer->getTransform()->setLocalPosition(glm::vec3(0.0f, foodLocalY, 0.0f));
 	foodContainer->getTransform()->setLocalScale(glm::vec3(foodWidthRatio, foodHeightRatio, 1.0f));
@@ -589,7 +656,7 @@ void MicrowaveGameScene::SetupMicrowaveGameObjects() {
 	RenderComponent* windowActualRenderComp = windowActual->addComponent<RenderComponent>(basicShader);
 	windowActualRenderComp->setMesh(windowActualMeshComp->getMesh());
 	windowActualRenderComp->setObjectColor(windowGlassColor);
-	windowActualRenderComp->setTexture(nullptr);
+	windowActualRenderComp->setSprite(solidSprite);
 
 	windowActual->getTransform()->setLocalPosition(glm::vec3(
 		(windowLocalRelativeWidth / 2.0f),
@@ -656,7 +723,7 @@ void MicrowaveGameScene::SetupMicrowaveGameObjects() {
 	hexRenderComp = hexContainer->addComponent<RenderComponent>(basicShader);
 	hexRenderComp->setMesh(hexMeshComp->getMesh());
 	hexRenderComp->setObjectColor(glm::vec4(0.35f, 0.55f, 1.0f, 0.5f));
-	hexRenderComp->setTexture(nullptr);
+	hexRenderComp->setSprite(solidSprite);
 	hexContainer->getTransform()->setLocalPosition(glm::vec3(0.0f, 0.0f, 0.0f));
 	hexContainer->getTransform()->setLocalScale(glm::vec3(innerContentRelativeWidth_in_hole, innerContentRelativeHeight_in_hole, 1.0f));
 	m_hexContainerGameObject = m_windowGameObject->addChild(std::move(hexContainer));
@@ -674,7 +741,7 @@ void MicrowaveGameScene::SetupMicrowaveGameObjects() {
 	displayRenderComp = m_displayContainer_GameObject->addComponent<RenderComponent>(basicShader);
 	displayRenderComp->setMesh(displayMeshComp->getMesh());
 	displayRenderComp->setObjectColor(displayColor);
-	displayRenderComp->setTexture(nullptr);
+	displayRenderComp->setSprite(solidSprite);
 
 	float displayLocalX_relative = windowHingeLocalX_relative_to_microwave_center + windowLocalRelativeWidth + relativeSeparationX + (displayLocalRelativeWidth / 2.0f);
 	float displayLocalY_relative = windowHingeLocalY_relative_to_microwave_center;
@@ -699,7 +766,7 @@ void MicrowaveGameScene::SetupMicrowaveGameObjects() {
 	timerRenderComp = timerContainer->addComponent<RenderComponent>(basicShader);
 	timerRenderComp->setMesh(timerMeshComp->getMesh());
 	timerRenderComp->setObjectColor(timerBackgroundColor);
-	timerRenderComp->setTexture(nullptr);
+	timerRenderComp->setSprite(solidSprite);
 
 	float timerRelativeHeight = 0.20f;
 	float timerLocalY = (effectiveDisplayHeight / 2.0f) - (timerRelativeHeight / 2.0f) - (displayVerticalPaddingRelative / 2.0f);
@@ -725,7 +792,8 @@ void MicrowaveGameScene::SetupMicrowaveGameObjects() {
 	);
 
 	if (initialTimerTextTexture) {
-		m_timerTextRenderComponent->setTexture(std::shared_ptr<Texture>(std::move(initialTimerTextTexture)));
+		m_timerTextTexture = std::move(initialTimerTextTexture);
+		m_timerTextRenderComponent->setTexture(m_timerTextTexture);
 		m_timerTextRenderComponent->setObjectColor(glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
 	}
 	else {
@@ -768,7 +836,7 @@ void MicrowaveGameScene::SetupMicrowaveGameObjects() {
 	keyboardLayoutRenderComp = keyboardLayoutContainer->addComponent<RenderComponent>(basicShader);
 	keyboardLayoutRenderComp->setMesh(keyboardLayoutMeshComp->getMesh());
 	keyboardLayoutRenderComp->setObjectColor(keyboardLayoutBackgroundColor);
-	keyboardLayoutRenderComp->setTexture(nullptr);
+	keyboardLayoutRenderComp->setSprite(solidSprite);
 
 	float keyboardRelativeHeight = 0.50f;
 	float keyboardLocalY = -(effectiveDisplayHeight / 2.0f) + (keyboardRelativeHeight / 2.0f) + (displayVerticalPaddingRelative / 2.0f);
@@ -815,8 +883,6 @@ void MicrowaveGameScene::SetupMicrowaveGameObjects() {
 		{"Keypad_StopButton", "STOP", [this]() { m_microwave.stopCooking(); updateTimerDisplay(); }}
 	};
 
-	float keypadTextPixelSize = 48.0f;
-
 	for (size_t i = 0; i < keypadButtons.size(); ++i) {
 		KeypadButtonData& buttonData = keypadButtons[i];
 
@@ -827,7 +893,7 @@ void MicrowaveGameScene::SetupMicrowaveGameObjects() {
 		keyContainerMeshComp->getMesh()->generateQuad2D();
 		keyContainerRenderComp->setMesh(keyContainerMeshComp->getMesh());
 		keyContainerRenderComp->setObjectColor(keypadButtonBackgroundColor);
-		keyContainerRenderComp->setTexture(nullptr);
+		keyContainerRenderComp->setSprite(solidSprite);
 
 
 		int row = i / (int)numCols;
@@ -864,13 +930,17 @@ void MicrowaveGameScene::SetupMicrowaveGameObjects() {
 		keyTextMeshComp->getMesh()->generateQuad2D();
 		keyTextRenderComp->setMesh(keyTextMeshComp->getMesh());
 
-		std::unique_ptr<Texture> keyTextTexture = m_fontRenderer->GenerateTextTexture(
+		std::string labelSprite = keypadLabelSpriteName(buttonData.text);
+		std::unique_ptr<Texture> keyTextTexture;
+		if (spriteAtlas && spriteAtlas->hasSprite(labelSprite)) {
+			keyTextRenderComp->setSprite(spriteAtlas->getSprite(labelSprite));
+			keyTextRenderComp->setObjectColor(glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
+		}
+		else if ((keyTextTexture = m_fontRenderer->GenerateTextTexture(
 			"res/fonts/Roboto-Regular.ttf",
 			buttonData.text, 
 			static_cast<int>(keypadTextPixelSize)
-		);
-
-		if (keyTextTexture) {
+		))) {
 			keyTextRenderComp->setTexture(std::shared_ptr<Texture>(std::move(keyTextTexture)));
 			keyTextRenderComp->setObjectColor(glm::vec4(1.0f, 1.0f, 1.0f, 1.0f));
 		}
@@ -892,7 +962,7 @@ void MicrowaveGameScene::SetupMicrowaveGameObjects() {
 	indicatorRenderComp = runningIndicator->addComponent<RenderComponent>(basicShader);
 	indicatorRenderComp->setMesh(indicatorMeshComp->getMesh());
 	indicatorRenderComp->setObjectColor(glm::vec4(0.0f, 0.0f, 0.0f, 1.0f));
-	indicatorRenderComp->setTexture(nullptr);
+	indicatorRenderComp->setSprite(solidSprite);
 
 	float indicatorDesiredHeightRatioOfDisplay = 0.15f;
 	float paddingBelowTimer = 0.015f;
@@ -1,6 +1,8 @@
 #pragma once
 #include "Core/Scene.h"
 #include "Microwave.h"
+#include "Core/StateMachine.h"
+#include "Input/InputManager.h"
 #include <memory>
 #include <string>
 #include <functional>
@@ -15,16 +17,54 @@ public:
 
     void Init() override;
     void Update(float deltaTime) override;
+    void FixedUpdate(float fixedDeltaTime) override;
     void Render() override;
     void Shutdown() override;
 
 private:
     void SetupMicrowaveGameObjects();
     void updateTimerDisplay();
+    void handleAction(InputActionId action);
 
     glm::vec4 calculateFlicker(float time, float speed);
 
+    // What the scene shows. It follows the microwave's state through a
+    // transition table, so one-off visual changes run from enter/exit hooks
+    // and Update only animates the current state.
+    enum class VisualState : uint8_t {
+        Off,
+        Running,
+        Broken,
+        Count
+    };
+    // One per Microwave::State; toVisualEvent maps between them.
+    enum class VisualEvent : uint8_t {
+        Idle,
+        Cooking,
+        CookingComplete,
+        Broken,
+        Count
+    };
+    using VisualStateTable = StateTable<VisualState, VisualEvent, MicrowaveGameScene>;
+
+    static VisualEvent toVisualEvent(Microwave::State state);
+    static void enterOff(MicrowaveGameScene& scene);
+    static void exitBroken(MicrowaveGameScene& scene);
+
+    static constexpr VisualStateTable s_visualStates = [] {
+        VisualStateTable table;
+        table.onAnyState(VisualEvent::Idle, VisualState::Off)
+            .onAnyState(VisualEvent::CookingComplete, VisualState::Off)
+            .onAnyState(VisualEvent::Cooking, VisualState::Running)
+            .onAnyState(VisualEvent::Broken, VisualState::Broken)
+            .onEnter(VisualState::Off, &MicrowaveGameScene::enterOff)
+            .onExit(VisualState::Broken, &MicrowaveGameScene::exitBroken);
+        return table;
+    }();
+
     Microwave m_microwave; 
+    float m_tickAccumulator;
+    StateMachine<VisualState, VisualEvent, MicrowaveGameScene> m_visualState;
 
     GameObject* m_microwaveGameObject;
     GameObject* m_windowGameObject;
@@ -36,6 +76,8 @@ private:
     GameObject* m_smokeFilterGameObject;
 
     RenderComponent* m_timerTextRenderComponent;
+    // Re-rendered in place by updateTimerDisplay so ticking allocates nothing.
+    std::shared_ptr<Texture> m_timerTextTexture;
     RenderComponent* m_hexRenderComponent;
     RenderComponent* m_smokeFilterRenderComponent;
 
@@ -62,4 +104,13 @@ private:
     float m_runningBlinkTimer;
     float m_runningBlinkInterval;
     bool m_isIndicatorVisible; 
+
+    InputActionId m_digitActions[10];
+    InputActionId m_startAction;
+    InputActionId m_stopAction;
+    InputActionId m_clearAction;
+    InputActionId m_repairAction;
+    InputActionId m_toggleHexAction;
+    InputActionId m_doorAction;
+    InputActionId m_breakAction;
 };
\ No newline at end of file
@@ -0,0 +1,167 @@
+#include "Core/MicrowaveSystem.h"
+#include <algorithm>
+
+size_t MicrowaveSystem::add() {
+    m_states.push_back(Microwave::IDLE);
+    m_doorsClosed.push_back(1);
+    m_remainingSeconds.push_back(0);
+    m_inputValues.push_back(0);
+    m_inputCounts.push_back(0);
+    return m_states.size() - 1;
+}
+
+void MicrowaveSystem::reserve(size_t count) {
+    m_states.reserve(count);
+    m_doorsClosed.reserve(count);
+    m_remainingSeconds.reserve(count);
+    m_inputValues.reserve(count);
+    m_inputCounts.reserve(count);
+}
+
+void MicrowaveSystem::clear() {
+    m_states.clear();
+    m_doorsClosed.clear();
+    m_remainingSeconds.clear();
+    m_inputValues.clear();
+    m_inputCounts.clear();
+    m_pendingInputs.clear();
+}
+
+Microwave::Time MicrowaveSystem::getRemainingTime(size_t index) const {
+    switch (m_states[index]) {
+    case Microwave::BROKEN: return Microwave::Time(-1, -1);
+    case Microwave::COOKING_COMPLETE: return Microwave::Time(0, 0);
+    default: return Microwave::Time::fromTotalSeconds(m_remainingSeconds[index]);
+    }
+}
+
+void MicrowaveSystem::queueInput(size_t index, Input input, int digit) {
+    m_pendingInputs.push_back({ static_cast<uint32_t>(index), static_cast<uint32_t>(m_pendingInputs.size()), input, static_cast<uint8_t>(digit) });
+}
+
+// Appliances don't affect each other, so the queue is grouped by appliance
+// (keeping each one's inputs in queue order) and every appliance touched is
+// loaded and stored once, walking the columns front to back.
+void MicrowaveSystem::applyInputs() {
+    std::sort(m_pendingInputs.begin(), m_pendingInputs.end(), [](const QueuedInput& a, const QueuedInput& b) {
+        return a.index != b.index ? a.index < b.index : a.order < b.order;
+    });
+
+    const size_t pendingCount = m_pendingInputs.size();
+    for (size_t begin = 0; begin < pendingCount;) {
+        const uint32_t index = m_pendingInputs[begin].index;
+        Lane lane = loadLane(index);
+        size_t end = begin;
+        for (; end < pendingCount && m_pendingInputs[end].index == index; ++end) {
+            applyInput(lane, m_pendingInputs[end]);
+        }
+        storeLane(index, lane);
+        begin = end;
+    }
+    m_pendingInputs.clear();
+}
+
+// Writes every lane unconditionally so the compiler can vectorize the loop.
+// A cooking microwave always has time left, so one second is taken off and
+// the state flips to COOKING_COMPLETE when it reaches zero.
+void MicrowaveSystem::tick() {
+    const size_t count = m_states.size();
+    uint8_t* states = m_states.data();
+    int32_t* remainingSeconds = m_remainingSeconds.data();
+    for (size_t i = 0; i < count; ++i) {
+        int32_t cooking = states[i] == Microwave::COOKING;
+        int32_t remaining = remainingSeconds[i] - cooking;
+        remainingSeconds[i] = remaining;
+        states[i] = (cooking & (remaining == 0)) ? static_cast<uint8_t>(Microwave::COOKING_COMPLETE) : states[i];
+    }
+}
+
+MicrowaveSystem::Lane MicrowaveSystem::loadLane(size_t index) const {
+    return { m_states[index], m_doorsClosed[index], m_remainingSeconds[index], m_inputValues[index], m_inputCounts[index] };
+}
+
+void MicrowaveSystem::storeLane(size_t index, const Lane& lane) {
+    m_states[index] = lane.state;
+    m_doorsClosed[index] = lane.doorClosed;
+    m_remainingSeconds[index] = lane.remainingSeconds;
+    m_inputValues[index] = lane.inputValue;
+    m_inputCounts[index] = lane.inputCount;
+}
+
+void MicrowaveSystem::resetTimer(Lane& lane) {
+    lane.remainingSeconds = 0;
+    lane.inputValue = 0;
+    lane.inputCount = 0;
+}
+
+void MicrowaveSystem::applyInput(Lane& lane, const QueuedInput& queued) {
+    uint8_t& state = lane.state;
+    uint8_t& doorClosed = lane.doorClosed;
+
+    switch (queued.input) {
+    case Input::Digit:
+        if (state == Microwave::COOKING || state == Microwave::BROKEN || !doorClosed) {
+            return;
+        }
+        if (state == Microwave::COOKING_COMPLETE) {
+            resetTimer(lane);
+        }
+        state = Microwave::IDLE;
+        if (lane.inputCount < kMaxInputDigits) {
+            // The last two digits are seconds and may exceed 59; the rest are minutes.
+            uint16_t value = static_cast<uint16_t>(lane.inputValue * 10 + queued.digit);
+            lane.inputValue = value;
+            ++lane.inputCount;
+            lane.remainingSeconds = (value / 100) * 60 + value % 100;
+        }
+        return;
+    case Input::Start:
+        if (state == Microwave::IDLE && doorClosed && lane.remainingSeconds > 0) {
+            state = Microwave::COOKING;
+            lane.inputValue = 0;
+            lane.inputCount = 0;
+        }
+        return;
+    case Input::Stop:
+        if (state == Microwave::COOKING) {
+            state = Microwave::IDLE;
+            return;
+        }
+        resetTimer(lane);
+        if (state != Microwave::BROKEN) {
+            state = Microwave::IDLE;
+        }
+        return;
+    case Input::Clear:
+        if (state == Microwave::COOKING || state == Microwave::BROKEN) {
+            return;
+        }
+        resetTimer(lane);
+        state = Microwave::IDLE;
+        return;
+    case Input::OpenDoor:
+        if (!doorClosed) {
+            return;
+        }
+        doorClosed = 0;
+        if (state == Microwave::COOKING_COMPLETE) {
+            resetTimer(lane);
+        }
+        if (state == Microwave::COOKING || state == Microwave::COOKING_COMPLETE) {
+            state = Microwave::IDLE;
+        }
+        return;
+    case Input::CloseDoor:
+        doorClosed = 1;
+        return;
+    case Input::Break:
+    case Input::Repair:
+        if ((state == Microwave::BROKEN) == (queued.input == Input::Break)) {
+            return;
+        }
+        state = queued.input == Input::Break ? Microwave::BROKEN : Microwave::IDLE;
+        doorClosed = 1;
+        resetTimer(lane);
+        return;
+    }
+}
\ No newline at end of file
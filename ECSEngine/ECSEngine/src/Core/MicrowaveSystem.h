@@ -0,0 +1,73 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "Core/Microwave.h"
+
+// Many microwaves stored as parallel arrays. Behaviour matches Microwave call
+// for call; Microwave stays the reference implementation. Inputs are queued
+// and applied in one pass, and tick() is a branch-free loop over the arrays.
+class MicrowaveSystem {
+public:
+    enum class Input : uint8_t {
+        Digit,
+        Start,
+        Stop,
+        Clear,
+        OpenDoor,
+        CloseDoor,
+        Break,
+        Repair
+    };
+
+    static constexpr int kMaxInputDigits = 4;
+
+    // Adds an appliance in Microwave's initial state and returns its index.
+    size_t add();
+    void reserve(size_t count);
+    void clear();
+    size_t size() const { return m_states.size(); }
+
+    void queueInput(size_t index, Input input, int digit = 0);
+    // Applies queued inputs. Each appliance sees its own inputs in the order
+    // they were queued.
+    void applyInputs();
+    void tick();
+
+    Microwave::State getState(size_t index) const { return static_cast<Microwave::State>(m_states[index]); }
+    Microwave::DoorState getDoorState(size_t index) const { return m_doorsClosed[index] ? Microwave::CLOSED : Microwave::OPEN; }
+    Microwave::Time getRemainingTime(size_t index) const;
+    bool isLightOn(size_t index) const { return m_states[index] == Microwave::COOKING; }
+
+private:
+    struct QueuedInput {
+        uint32_t index;
+        uint32_t order;
+        Input input;
+        uint8_t digit;
+    };
+
+    // One appliance's columns, held in locals while its inputs are applied.
+    struct Lane {
+        uint8_t state;
+        uint8_t doorClosed;
+        int32_t remainingSeconds;
+        uint16_t inputValue;
+        uint8_t inputCount;
+    };
+
+    std::vector<uint8_t> m_states;
+    std::vector<uint8_t> m_doorsClosed;
+    std::vector<int32_t> m_remainingSeconds;
+    // The typed digits as one decimal number plus how many were typed, so
+    // leading zeros still count towards kMaxInputDigits.
+    std::vector<uint16_t> m_inputValues;
+    std::vector<uint8_t> m_inputCounts;
+    std::vector<QueuedInput> m_pendingInputs;
+
+    Lane loadLane(size_t index) const;
+    void storeLane(size_t index, const Lane& lane);
+    static void applyInput(Lane& lane, const QueuedInput& queued);
+    static void resetTimer(Lane& lane);
+};
\ No newline at end of file
@@ -0,0 +1,106 @@
+#include "Core/PerfHud.h"
+#include "Core/DebugDraw2D.h"
+#include "Core/FrameArena.h"
+#include "Core/FrameStats.h"
+#include "Core/GameObject.h"
+#include "Core/MemoryTracker.h"
+#include <algorithm>
+
+static constexpr float kHudPadding = 6.0f;
+static constexpr float kGraphHeight = 60.0f;
+// Full graph height; the guide line marks 60 fps.
+static constexpr float kGraphMilliseconds = 33.3f;
+static constexpr float kBudgetMilliseconds = 16.7f;
+
+static double millisecondsBetween(std::chrono::steady_clock::time_point start, std::chrono::steady_clock::time_point end) {
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+PerfHud::PerfHud()
+    : m_cpuHistory(), m_gpuHistory(), m_historyIndex(0), m_frameMilliseconds(0.0),
+    m_hudMilliseconds(0.0), m_rendered(false), m_visible(false) {
+}
+
+bool PerfHud::init() {
+    m_previousFrameStart = Clock::now();
+    return m_gpuTimer.init();
+}
+
+void PerfHud::beginFrame() {
+    m_frameStart = Clock::now();
+    m_frameMilliseconds = millisecondsBetween(m_previousFrameStart, m_frameStart);
+    m_previousFrameStart = m_frameStart;
+    m_gpuTimer.begin();
+}
+
+// Called after the last draw but before the buffer swap, so the CPU time
+// excludes waiting for vsync.
+void PerfHud::endFrame() {
+    m_gpuTimer.end();
+    Clock::time_point now = Clock::now();
+    m_cpuHistory[m_historyIndex] = static_cast<float>(millisecondsBetween(m_frameStart, now));
+    m_gpuHistory[m_historyIndex] = static_cast<float>(std::max(m_gpuTimer.getLastMilliseconds(), 0.0));
+    m_historyIndex = (m_historyIndex + 1) % kHistorySize;
+    if (m_rendered) {
+        m_hudMilliseconds = millisecondsBetween(m_renderStart, now);
+        m_rendered = false;
+    }
+}
+
+float PerfHud::render(DebugDraw2D& draw, float x, float y) {
+    if (!m_visible) {
+        return y;
+    }
+    m_renderStart = Clock::now();
+    m_rendered = true;
+
+    const glm::vec4 textColor(0.9f, 0.9f, 0.9f, 1.0f);
+    const glm::vec4 cpuColor(0.3f, 0.85f, 0.4f, 1.0f);
+    const glm::vec4 gpuColor(1.0f, 0.6f, 0.2f, 0.7f);
+    const float lineHeight = draw.getLineHeight();
+    const int lines = 8;
+    const float width = kHistorySize + 2.0f * kHudPadding;
+
+    draw.rect(x, y, width, kGraphHeight + lines * lineHeight + 3.0f * kHudPadding, glm::vec4(0.0f, 0.0f, 0.0f, 0.6f));
+    x += kHudPadding;
+    y += kHudPadding;
+
+    // Oldest sample on the left; GPU bars are drawn over the CPU bars.
+    const float scale = kGraphHeight / kGraphMilliseconds;
+    for (int i = 0; i < kHistorySize; ++i) {
+        int sample = (m_historyIndex + i) % kHistorySize;
+        float cpuHeight = std::min(m_cpuHistory[sample] * scale, kGraphHeight);
+        float gpuHeight = std::min(m_gpuHistory[sample] * scale, kGraphHeight);
+        draw.rect(x + i, y + kGraphHeight - cpuHeight, 1.0f, cpuHeight, cpuColor);
+        draw.rect(x + i, y + kGraphHeight - gpuHeight, 1.0f, gpuHeight, gpuColor);
+    }
+    draw.rect(x, y + kGraphHeight - kBudgetMilliseconds * scale, static_cast<float>(kHistorySize), 1.0f, glm::vec4(1.0f, 1.0f, 1.0f, 0.5f));
+    y += kGraphHeight + kHudPadding;
+
+    const int last = (m_historyIndex + kHistorySize - 1) % kHistorySize;
+    const double gpuMilliseconds = m_gpuTimer.getLastMilliseconds();
+    const FrameStatsValues& stats = FrameStats::getInstance().getLastFrame();
+    const MemoryTracker& tracker = MemoryTracker::getInstance();
+
+    draw.text(x, y, formatFrameString("Frame %.2f ms (%.0f fps)", m_frameMilliseconds,
+        m_frameMilliseconds > 0.0 ? 1000.0 / m_frameMilliseconds : 0.0), textColor);
+    y += lineHeight;
+    float cpuWidth = draw.text(x, y, formatFrameString("CPU %.2f ms", m_cpuHistory[last]), cpuColor);
+    draw.text(x + cpuWidth + 12.0f, y, gpuMilliseconds < 0.0 ? FrameString("GPU n/a")
+        : formatFrameString("GPU %.2f ms", gpuMilliseconds), gpuColor);
+    y += lineHeight;
+    draw.text(x, y, formatFrameString("Draw calls %u  State changes %u", stats.drawCalls, stats.stateChanges), textColor);
+    y += lineHeight;
+    draw.text(x, y, formatFrameString("Triangles %llu", static_cast<unsigned long long>(stats.triangles)), textColor);
+    y += lineHeight;
+    draw.text(x, y, formatFrameString("Entities %zu  Visible %u", GameObject::getLiveCount(), stats.visibleEntities), textColor);
+    y += lineHeight;
+    draw.text(x, y, formatFrameString("Clickables tested %u", stats.clickablesTested), textColor);
+    y += lineHeight;
+    draw.text(x, y, formatFrameString("Allocs/frame CPU %llu  GPU %llu",
+        static_cast<unsigned long long>(tracker.getTotals(MemoryDomain::Cpu).frameAllocations),
+        static_cast<unsigned long long>(tracker.getTotals(MemoryDomain::Gpu).frameAllocations)), textColor);
+    y += lineHeight;
+    draw.text(x, y, formatFrameString("HUD %.3f ms", m_hudMilliseconds), textColor);
+    return y + lineHeight + kHudPadding;
+}
\ No newline at end of file
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <chrono>
+#include "Core/GpuFrameTimer.h"
+
+class DebugDraw2D;
+
+// Frame-time graph and per-frame counters. beginFrame()/endFrame() bracket
+// the frame's work on the GL thread; samples are kept while the HUD is hidden
+// so the graph is already filled when it is toggled on.
+class PerfHud {
+public:
+    PerfHud();
+
+    bool init();
+    // Releases the GPU queries; call while the context is still current.
+    void shutdown() { m_gpuTimer.shutdown(); }
+
+    void toggle() { m_visible = !m_visible; }
+    bool isVisible() const { return m_visible; }
+
+    void beginFrame();
+    void endFrame();
+
+    // Queues the HUD at (x, y), top left, and returns the y below it.
+    float render(DebugDraw2D& draw, float x, float y);
+
+private:
+    using Clock = std::chrono::steady_clock;
+    static constexpr int kHistorySize = 240;
+
+    GpuFrameTimer m_gpuTimer;
+    Clock::time_point m_frameStart;
+    Clock::time_point m_previousFrameStart;
+    Clock::time_point m_renderStart;
+    float m_cpuHistory[kHistorySize];
+    float m_gpuHistory[kHistorySize];
+    int m_historyIndex;
+    double m_frameMilliseconds;
+    double m_hudMilliseconds;
+    bool m_rendered;
+    bool m_visible;
+};
\ No newline at end of file
@@ -3,11 +3,13 @@
 #include "Components/ClickableComponent.h" 
 #include "Components/TransformComponent.h" 
 #include "Components/MeshComponent.h"      
+#include "Components/RenderComponent.h"
 #include "Components/CameraBaseComponent.h"    
 #include "Components/Camera2DComponent.h" 
 #include "Components/Camera3DComponent.h"  
 #include "Core/GameObject.h"               
 #include "Core/Scene.h"                    
+#include "Core/FrameStats.h"
 
 #include <iostream>
 #include <algorithm>
@@ -26,15 +28,51 @@ PickingManager::PickingManager() {
 }
 
 PickingManager::~PickingManager() {
-    m_clickableComponents.clear(); 
+    m_proxies.clear(); 
+    m_proxyIndex.clear();
 }
 
 void PickingManager::Init(int windowWidth, int windowHeight) {
     m_windowWidth = windowWidth;
     m_windowHeight = windowHeight;
+    m_framebufferWidth = windowWidth;
+    m_framebufferHeight = windowHeight;
+    m_pickDirty = true;
     std::cout << "PickingManager initialized with window size " << windowWidth << "x" << windowHeight << std::endl;
 }
 
+void PickingManager::setWindowSize(int windowWidth, int windowHeight) {
+    if (windowWidth == m_windowWidth && windowHeight == m_windowHeight) {
+        return;
+    }
+    m_windowWidth = windowWidth;
+    m_windowHeight = windowHeight;
+    m_pickDirty = true;
+}
+
+void PickingManager::setFramebufferSize(int framebufferWidth, int framebufferHeight) {
+    if (framebufferWidth == m_framebufferWidth && framebufferHeight == m_framebufferHeight) {
+        return;
+    }
+    m_framebufferWidth = framebufferWidth;
+    m_framebufferHeight = framebufferHeight;
+    m_idBufferPicker.resize(framebufferWidth, framebufferHeight);
+}
+
+void PickingManager::setPickingMode(PickingMode mode) {
+    if (mode == m_pickingMode) {
+        return;
+    }
+    m_pickingMode = mode;
+    m_gpuResultPending = false;
+    m_pickDirty = true;
+}
+
+void PickingManager::Shutdown() {
+    m_idBufferPicker.shutdown();
+    m_fallbackQuad = nullptr;
+}
+
 void PickingManager::Update(float deltaTime, Scene* activeScene) {
     if (!activeScene) {
         std::cerr << "PickingManager: No active scene to pick from." << std::endl;
@@ -46,108 +84,333 @@ void PickingManager::Update(float deltaTime, Scene* activeScene) {
         return;
     }
 
+    if (activeScene != m_lastScene) {
+        m_lastScene = activeScene;
+        m_pickDirty = true;
+    }
+
+    refreshDirtyProxies();
+
+    if (refreshCameraCache(activeCamera)) {
+        m_pickDirty = true;
+    }
+
     glm::vec2 mouseScreenPos = glm::vec2(InputManager::getInstance().getMouseX(), InputManager::getInstance().getMouseY());
+    if (mouseScreenPos != m_lastMouseScreenPos) {
+        m_lastMouseScreenPos = mouseScreenPos;
+        m_pickDirty = true;
+    }
 
-    ClickableComponent* newHoveredComponent = nullptr;
-    float closest3D_T = std::numeric_limits<float>::max();
+    bool useIdBuffer = m_pickingMode == PickingMode::IDBuffer && m_idBufferPicker.isInitialized();
 
-    
-    for (auto it = m_clickableComponents.rbegin(); it != m_clickableComponents.rend(); ++it) {
-        ClickableComponent* clickable = *it;
-        if (!clickable || !clickable->getOwner() || !clickable->getOwner()->getTransform()) {
-            continue;
+    if (useIdBuffer ? m_gpuResultPending : m_pickDirty) {
+        m_pickDirty = false;
+        m_gpuResultPending = false;
+
+        ClickableComponent* newHoveredComponent = nullptr;
+
+        if (useIdBuffer) {
+            newHoveredComponent = pickFromIdBuffer();
         }
+        else {
+            if (Camera2DComponent* cam2d = dynamic_cast<Camera2DComponent*>(activeCamera)) {
+                newHoveredComponent = pick2D(screenToWorld2D(mouseScreenPos, cam2d));
+            }
 
-        if (clickable->getPickingMethod() == PickingMethod::Method2D) {
-            Camera2DComponent* cam2d = dynamic_cast<Camera2DComponent*>(activeCamera);
-            if (cam2d) { 
-                glm::vec2 mouseWorldPos2D = screenToWorld2D(mouseScreenPos, cam2d);
-                if (isMouseOver2D(clickable->getOwner(), mouseWorldPos2D)) {
-                    newHoveredComponent = clickable; 
-                    break; 
+            if (newHoveredComponent == nullptr) {
+                if (Camera3DComponent* cam3d = dynamic_cast<Camera3DComponent*>(activeCamera)) {
+                    newHoveredComponent = pick3D(screenToWorldRay3D(mouseScreenPos, cam3d));
                 }
             }
         }
+
+        if (m_hoveredComponent != newHoveredComponent) {
+            if (m_hoveredComponent) {
+                m_hoveredComponent->onHoverExit();
+            }
+            if (newHoveredComponent) {
+                newHoveredComponent->onHoverEnter();
+            }
+            m_hoveredComponent = newHoveredComponent;
+        }
     }
 
-    if (newHoveredComponent == nullptr) {
-        Camera3DComponent* cam3d = dynamic_cast<Camera3DComponent*>(activeCamera);
-        if (cam3d) {
-            Ray pickRay = screenToWorldRay3D(mouseScreenPos, cam3d);
+    if (InputManager::getInstance().isMouseButtonJustPressed(GLFW_MOUSE_BUTTON_LEFT)) {
+        if (m_hoveredComponent) { 
+            m_hoveredComponent->onClick();
 
-            for (ClickableComponent* clickable : m_clickableComponents) {
-                if (!clickable || !clickable->getOwner() || !clickable->getOwner()->getTransform()) {
-                    continue;
-                }
+        }
+    }
+}
 
-                if (clickable->getPickingMethod() == PickingMethod::Method3D) {
-                    float current_t;
-                    if (rayIntersectsAABB(pickRay, clickable->getOwner(), current_t)) {
-                        if (current_t < closest3D_T) {
-                            closest3D_T = current_t;
-                            newHoveredComponent = clickable; 
-                        }
-                    }
-                }
+// Later registrations are drawn on top, so among overlapping 2D clickables the
+// most recently added one wins.
+ClickableComponent* PickingManager::pick2D(const glm::vec2& mouseWorldPos2D) {
+    m_queryCandidates.clear();
+    m_grid2D.queryPoint(mouseWorldPos2D, m_queryCandidates);
+    FrameStats::getInstance().countClickablesTested(static_cast<uint32_t>(m_queryCandidates.size()));
+
+    const PickingProxy* best = nullptr;
+    for (int proxyId : m_queryCandidates) {
+        const PickingProxy& proxy = m_proxies[proxyId];
+        if (best && proxy.order < best->order) {
+            continue;
+        }
+        if (isMouseOver2D(proxy, mouseWorldPos2D)) {
+            best = &proxy;
+        }
+    }
+    return best ? best->clickable : nullptr;
+}
+
+ClickableComponent* PickingManager::pick3D(const Ray& ray) {
+    ClickableComponent* closest = nullptr;
+    uint32_t tested = 0;
+    m_tree3D.raycast(ray.origin, ray.direction, std::numeric_limits<float>::max(),
+        [this, &ray, &closest, &tested](int proxyId, float maxT) {
+            ++tested;
+            const PickingProxy& proxy = m_proxies[proxyId];
+            float t;
+            if (rayIntersectsAABB(ray, proxy.boundsMin, proxy.boundsMax, t) && t < maxT) {
+                closest = proxy.clickable;
+                return t;
             }
+            return maxT;
+        });
+    FrameStats::getInstance().countClickablesTested(tested);
+    return closest;
+}
+
+ClickableComponent* PickingManager::pickFromIdBuffer() {
+    if (m_gpuHoveredId == IdBufferPicker::kNoId) {
+        return nullptr;
+    }
+    int proxyId = static_cast<int>(m_gpuHoveredId & kPickIdIndexMask) - 1;
+    if (proxyId < 0 || proxyId >= static_cast<int>(m_proxies.size())) {
+        return nullptr;
+    }
+    const PickingProxy& proxy = m_proxies[proxyId];
+    if ((m_gpuHoveredId >> kPickIdIndexBits) != proxy.generation) {
+        return nullptr;
+    }
+    return proxy.clickable;
+}
+
+// Proxy index + 1 in the low bits (0 means nothing), generation above it.
+unsigned int PickingManager::encodePickId(int proxyId) const {
+    return (m_proxies[proxyId].generation << kPickIdIndexBits) | (static_cast<unsigned int>(proxyId) + 1);
+}
+
+// Draws every registered clickable with its encoded pick id and collects the
+// readback issued on an earlier frame. Must run on the thread that owns the GL
+// context.
+void PickingManager::RenderIdBuffer(Scene* activeScene) {
+    if (m_pickingMode != PickingMode::IDBuffer || !activeScene) {
+        return;
+    }
+    CameraBaseComponent* activeCamera = activeScene->getActiveCamera();
+    if (!activeCamera) {
+        return;
+    }
+    if (!m_idBufferPicker.isInitialized() && !m_idBufferPicker.init(m_framebufferWidth, m_framebufferHeight)) {
+        std::cerr << "PickingManager: ID buffer picking unavailable, falling back to CPU picking." << std::endl;
+        m_pickingMode = PickingMode::CPU;
+        return;
+    }
+
+    unsigned int readbackId;
+    if (m_idBufferPicker.pollResult(readbackId) && readbackId != m_gpuHoveredId) {
+        m_gpuHoveredId = readbackId;
+        m_gpuResultPending = true;
+    }
+
+    m_idPassOrder.clear();
+    for (int i = 0; i < static_cast<int>(m_proxies.size()); ++i) {
+        if (m_proxies[i].clickable) {
+            m_idPassOrder.push_back(i);
         }
     }
+    std::sort(m_idPassOrder.begin(), m_idPassOrder.end(), [this](int a, int b) {
+        return m_proxies[a].order < m_proxies[b].order;
+    });
 
+    m_idBufferPicker.beginPass(activeCamera->getViewMatrix(), activeCamera->getProjectionMatrix());
+    for (int proxyId : m_idPassOrder) {
+        GameObject* owner = m_proxies[proxyId].clickable->getOwner();
 
-    if (m_hoveredComponent != newHoveredComponent) {
-        if (m_hoveredComponent) {
-            m_hoveredComponent->onHoverExit();
+        std::shared_ptr<Mesh> mesh;
+        if (RenderComponent* renderComp = owner->getComponent<RenderComponent>()) {
+            mesh = renderComp->m_mesh;
         }
-        if (newHoveredComponent) {
-            newHoveredComponent->onHoverEnter();
+        if (!mesh) {
+            if (MeshComponent* meshComp = owner->getComponent<MeshComponent>()) {
+                mesh = meshComp->getMesh();
+            }
+        }
+        if (!mesh) {
+            // Clickables without geometry are treated as the unit quad the CPU
+            // picker assumes for them.
+            if (!m_fallbackQuad) {
+                m_fallbackQuad = std::make_shared<Mesh>("PickingQuad");
+                m_fallbackQuad->generateQuad2D();
+            }
+            mesh = m_fallbackQuad;
         }
-        m_hoveredComponent = newHoveredComponent;
+
+        m_idBufferPicker.drawObject(*mesh, owner->getTransform()->getWorldMatrix(), encodePickId(proxyId));
     }
 
-    if (InputManager::getInstance().isMouseButtonJustPressed(GLFW_MOUSE_BUTTON_LEFT)) {
-        if (m_hoveredComponent) { 
-            m_hoveredComponent->onClick();
+    // The cursor is in window coordinates; the id target is framebuffer sized.
+    float scaleX = m_windowWidth > 0 ? static_cast<float>(m_framebufferWidth) / static_cast<float>(m_windowWidth) : 1.0f;
+    float scaleY = m_windowHeight > 0 ? static_cast<float>(m_framebufferHeight) / static_cast<float>(m_windowHeight) : 1.0f;
+    m_idBufferPicker.endPass(static_cast<int>(InputManager::getInstance().getMouseX() * scaleX),
+        static_cast<int>(InputManager::getInstance().getMouseY() * scaleY));
+}
+
+void PickingManager::AddClickable(ClickableComponent* clickable) {
+    if (!clickable || !clickable->getOwner() || m_proxyIndex.count(clickable)) {
+        return;
+    }
 
+    int proxyId;
+    if (!m_freeProxies.empty()) {
+        proxyId = m_freeProxies.back();
+        m_freeProxies.pop_back();
+    }
+    else {
+        proxyId = static_cast<int>(m_proxies.size());
+        if (static_cast<unsigned int>(proxyId) + 1 > kPickIdIndexMask) {
+            std::cerr << "PickingManager ERROR: Too many clickables registered." << std::endl;
+            return;
         }
+        m_proxies.emplace_back();
     }
+
+    PickingProxy& proxy = m_proxies[proxyId];
+    unsigned int generation = proxy.generation;
+    proxy = PickingProxy();
+    proxy.generation = generation;
+    proxy.clickable = clickable;
+    proxy.is3D = clickable->getPickingMethod() == PickingMethod::Method3D;
+    proxy.order = m_nextOrder++;
+    m_proxyIndex[clickable] = proxyId;
+
+    // Bounds are computed on the next Update so components added after the
+    // clickable (e.g. the mesh) are taken into account.
+    clickable->getOwner()->getTransform()->setPickingProxy(proxyId);
+    onTransformChanged(proxyId);
 }
 
-void PickingManager::AddClickable(ClickableComponent* clickable) {
-    if (clickable) {
-        if (std::find(m_clickableComponents.begin(), m_clickableComponents.end(), clickable) == m_clickableComponents.end()) {
-            m_clickableComponents.push_back(clickable);
+void PickingManager::RemoveClickable(ClickableComponent* clickable) {
+    auto it = m_proxyIndex.find(clickable);
+    if (it == m_proxyIndex.end()) {
+        return;
+    }
+
+    int proxyId = it->second;
+    PickingProxy& proxy = m_proxies[proxyId];
+    if (proxy.is3D) {
+        if (proxy.treeNode != DynamicAABBTree::kNullNode) {
+            m_tree3D.destroyProxy(proxy.treeNode);
         }
-        else {
+    }
+    else {
+        m_grid2D.remove(proxyId);
+    }
+    if (clickable->getOwner() && clickable->getOwner()->getTransform()->getPickingProxy() == proxyId) {
+        clickable->getOwner()->getTransform()->setPickingProxy(-1);
+    }
+
+    unsigned int generation = (proxy.generation + 1) & kPickIdGenerationMask;
+    proxy = PickingProxy();
+    proxy.generation = generation;
+    m_freeProxies.push_back(proxyId);
+    m_proxyIndex.erase(it);
+    m_pickDirty = true;
+
+    if (m_hoveredComponent == clickable) {
+        m_hoveredComponent->onHoverExit(); 
+        m_hoveredComponent = nullptr;
+    }
+}
+
+void PickingManager::onTransformChanged(int proxyId) {
+    if (proxyId < 0 || proxyId >= static_cast<int>(m_proxies.size())) {
+        return;
+    }
+    PickingProxy& proxy = m_proxies[proxyId];
+    if (proxy.clickable && !proxy.dirty) {
+        proxy.dirty = true;
+        m_dirtyProxies.push_back(proxyId);
+    }
+}
+
+void PickingManager::refreshDirtyProxies() {
+    if (m_dirtyProxies.empty()) {
+        return;
+    }
+    m_pickDirty = true;
+
+    for (int proxyId : m_dirtyProxies) {
+        if (m_proxies[proxyId].clickable && m_proxies[proxyId].dirty) {
+            refreshProxy(proxyId);
         }
     }
+    m_dirtyProxies.clear();
 }
 
-void PickingManager::RemoveClickable(ClickableComponent* clickable) {
-    if (clickable) {
-        auto it = std::remove(m_clickableComponents.begin(), m_clickableComponents.end(), clickable);
-        if (it != m_clickableComponents.end()) {
-            m_clickableComponents.erase(it, m_clickableComponents.end());
-            if (m_hoveredComponent == clickable) {
-                m_hoveredComponent->onHoverExit(); 
-                m_hoveredComponent = nullptr;
-            }
+void PickingManager::refreshProxy(int proxyId) {
+    PickingProxy& proxy = m_proxies[proxyId];
+    proxy.dirty = false;
+    GameObject* owner = proxy.clickable->getOwner();
+
+    if (proxy.is3D) {
+        getGameObjectWorldAABB(owner, proxy.boundsMin, proxy.boundsMax);
+        if (proxy.treeNode == DynamicAABBTree::kNullNode) {
+            proxy.treeNode = m_tree3D.createProxy(proxy.boundsMin, proxy.boundsMax, proxyId);
         }
         else {
+            m_tree3D.moveProxy(proxy.treeNode, proxy.boundsMin, proxy.boundsMax);
         }
     }
+    else {
+        glm::vec2 rectMin, rectMax;
+        getGameObjectWorldRect2D(owner, rectMin, rectMax);
+        proxy.boundsMin = glm::vec3(rectMin, 0.0f);
+        proxy.boundsMax = glm::vec3(rectMax, 0.0f);
+        m_grid2D.update(proxyId, rectMin, rectMax);
+    }
 }
 
 
+// Recomputes the cached inverse matrices when the camera, its parameters or its
+// transform changed since the last call. Returns true if the cache was rebuilt.
+bool PickingManager::refreshCameraCache(CameraBaseComponent* camera) {
+    TransformComponent* cameraTransform = camera->getOwner() ? camera->getOwner()->getTransform() : nullptr;
+    unsigned int transformVersion = cameraTransform ? cameraTransform->getVersion() : 0;
+
+    if (m_cameraCache.camera == camera &&
+        m_cameraCache.cameraVersion == camera->getVersion() &&
+        m_cameraCache.transformVersion == transformVersion) {
+        return false;
+    }
+
+    m_cameraCache.camera = camera;
+    m_cameraCache.cameraVersion = camera->getVersion();
+    m_cameraCache.transformVersion = transformVersion;
+    m_cameraCache.inverseProjection = glm::inverse(camera->getProjectionMatrix());
+    m_cameraCache.inverseViewProjection = glm::inverse(camera->getProjectionMatrix() * camera->getViewMatrix());
+    m_cameraCache.cameraWorldMatrix = cameraTransform ? cameraTransform->getWorldMatrix() : glm::mat4(1.0f);
+    return true;
+}
+
 glm::vec2 PickingManager::screenToWorld2D(const glm::vec2& screenCoords, Camera2DComponent* camera) {
     if (!camera || !camera->getOwner() || !camera->getOwner()->getTransform()) {
         std::cerr << "PickingManager ERROR: Camera2DComponent or its transform is null in screenToWorld2D." << std::endl;
         return screenCoords; 
     }
 
-    glm::mat4 viewMatrix = camera->getViewMatrix();
-    glm::mat4 projectionMatrix = camera->getProjectionMatrix(); 
-
-    glm::mat4 inverseVP = glm::inverse(projectionMatrix * viewMatrix);
+    const glm::mat4& inverseVP = m_cameraCache.inverseViewProjection;
 
     float ndcX = (screenCoords.x / static_cast<float>(m_windowWidth)) * 2.0f - 1.0f;
     float ndcY = 1.0f - (screenCoords.y / static_cast<float>(m_windowHeight)) * 2.0f;
@@ -156,11 +419,7 @@ glm::vec2 PickingManager::screenToWorld2D(const glm::vec2& screenCoords, Camera2
     return glm::vec2(worldPos.x / worldPos.w, worldPos.y / worldPos.w);
 }
 
-bool PickingManager::isMouseOver2D(GameObject* gameObject, const glm::vec2& mouseWorldPos2D) {
-    if (!gameObject || !gameObject->getTransform()) {
-        return false;
-    }
-
+void PickingManager::getGameObjectWorldRect2D(GameObject* gameObject, glm::vec2& outMin, glm::vec2& outMax) {
     glm::mat4 worldMatrix = gameObject->getTransform()->getWorldMatrix();
 
     glm::vec2 objectWorldPos = glm::vec2(worldMatrix[3].x, worldMatrix[3].y);
@@ -168,16 +427,15 @@ bool PickingManager::isMouseOver2D(GameObject* gameObject, const glm::vec2& mous
     float objectWorldWidth = glm::length(glm::vec2(worldMatrix[0])); 
     float objectWorldHeight = glm::length(glm::vec2(worldMatrix[1])); 
 
-    float halfWidth = objectWorldWidth * 0.5f;
-    float halfHeight = objectWorldHeight * 0.5f;
+    glm::vec2 halfExtents = glm::vec2(objectWorldWidth, objectWorldHeight) * 0.5f;
 
-    float minX = objectWorldPos.x - halfWidth;
-    float maxX = objectWorldPos.x + halfWidth;
-    float minY = objectWorldPos.y - halfHeight;
-    float maxY = objectWorldPos.y + halfHeight;
+    outMin = objectWorldPos - halfExtents;
+    outMax = objectWorldPos + halfExtents;
+}
 
-    return (mouseWorldPos2D.x >= minX && mouseWorldPos2D.x <= maxX &&
-        mouseWorldPos2D.y >= minY && mouseWorldPos2D.y <= maxY);
+bool PickingManager::isMouseOver2D(const PickingProxy& proxy, const glm::vec2& mouseWorldPos2D) {
+    return (mouseWorldPos2D.x >= proxy.boundsMin.x && mouseWorldPos2D.x <= proxy.boundsMax.x &&
+        mouseWorldPos2D.y >= proxy.boundsMin.y && mouseWorldPos2D.y <= proxy.boundsMax.y);
 }
 
 
@@ -193,14 +451,14 @@ PickingManager::Ray PickingManager::screenToWorldRay3D(const glm::vec2& screenCo
     glm::vec4 rayClipNear(ndcX, ndcY, -1.0f, 1.0f); 
     glm::vec4 rayClipFar(ndcX, ndcY, 1.0f, 1.0f);   
 
-    glm::mat4 inverseProjection = glm::inverse(camera->getProjectionMatrix());
+    const glm::mat4& inverseProjection = m_cameraCache.inverseProjection;
     glm::vec4 rayEyeNear = inverseProjection * rayClipNear;
     glm::vec4 rayEyeFar = inverseProjection * rayClipFar;
 
     if (rayEyeNear.w != 0.0f) rayEyeNear /= rayEyeNear.w;
     if (rayEyeFar.w != 0.0f) rayEyeFar /= rayEyeFar.w;
 
-    glm::mat4 cameraWorldMatrix = camera->getOwner()->getTransform()->getWorldMatrix();
+    const glm::mat4& cameraWorldMatrix = m_cameraCache.cameraWorldMatrix;
     glm::vec3 rayWorldNear = glm::vec3(cameraWorldMatrix * rayEyeNear);
     glm::vec3 rayWorldFar = glm::vec3(cameraWorldMatrix * rayEyeFar);
 
@@ -220,14 +478,7 @@ void PickingManager::getGameObjectWorldAABB(GameObject* obj, glm::vec3& outMin,
     obj->getTransform()->calculateWorldAABB(outMin, outMax);
 }
 
-bool PickingManager::rayIntersectsAABB(const Ray& ray, GameObject* gameObject, float& outT) {
-    if (!gameObject || !gameObject->getTransform()) {
-        return false;
-    }
-
-    glm::vec3 aabbMin, aabbMax;
-    getGameObjectWorldAABB(gameObject, aabbMin, aabbMax); 
-
+bool PickingManager::rayIntersectsAABB(const Ray& ray, const glm::vec3& aabbMin, const glm::vec3& aabbMax, float& outT) {
     glm::vec3 invDir = 1.0f / ray.direction;
     glm::vec3 tMin = (aabbMin - ray.origin) * invDir;
     glm::vec3 tMax = (aabbMax - ray.origin) * invDir;
@@ -5,15 +5,25 @@
 #include <unordered_map>
 #include <glm/glm.hpp>
 #include <limits> 
+#include "SpatialHashGrid2D.h"
+#include "DynamicAABBTree.h"
+#include "IdBufferPicker.h"
 
 class ClickableComponent;
 class CameraComponent;  
+class CameraBaseComponent;
 class Camera2DComponent; 
 class Camera3DComponent;
 class TransformComponent;
 class MeshComponent;
 class GameObject;
 class Scene;             
+class Mesh;
+
+enum class PickingMode {
+    CPU,
+    IDBuffer
+};
 
 class PickingManager {
 public:
@@ -30,29 +40,105 @@ public:
 
     void RemoveClickable(ClickableComponent* clickable);
 
+    // Window size is in the screen coordinates mouse positions use; the
+    // framebuffer size is in pixels and differs from it on HiDPI displays.
+    void setWindowSize(int windowWidth, int windowHeight);
+    void setFramebufferSize(int framebufferWidth, int framebufferHeight);
+
+    // IDBuffer mode renders clickables into an offscreen id target; the hover
+    // result lags one frame behind. Until RenderIdBuffer has run on the render
+    // thread the CPU path is used.
+    void setPickingMode(PickingMode mode);
+    PickingMode getPickingMode() const { return m_pickingMode; }
+    void RenderIdBuffer(Scene* activeScene);
+    void Shutdown();
+
+    void onTransformChanged(int proxyId);
+    void setGridCellSize(float cellSize) { m_grid2D.setCellSize(cellSize); }
+
 private:
     PickingManager();
     ~PickingManager();
 
-    std::vector<ClickableComponent*> m_clickableComponents;
+    // Pick ids written to the id buffer carry the proxy generation in the high
+    // bits, so a readback that lands after its proxy slot was reused is ignored.
+    static constexpr unsigned int kPickIdIndexBits = 20;
+    static constexpr unsigned int kPickIdIndexMask = (1u << kPickIdIndexBits) - 1;
+    static constexpr unsigned int kPickIdGenerationMask = (1u << (32 - kPickIdIndexBits)) - 1;
+
+    struct PickingProxy {
+        ClickableComponent* clickable = nullptr;
+        unsigned int generation = 0;
+        bool is3D = false;
+        bool dirty = false;
+        unsigned int order = 0;
+        glm::vec3 boundsMin = glm::vec3(0.0f);
+        glm::vec3 boundsMax = glm::vec3(0.0f);
+        int treeNode = DynamicAABBTree::kNullNode;
+    };
+
+    std::vector<PickingProxy> m_proxies;
+    std::vector<int> m_freeProxies;
+    std::unordered_map<ClickableComponent*, int> m_proxyIndex;
+    std::vector<int> m_dirtyProxies;
+    unsigned int m_nextOrder = 0;
+
+    SpatialHashGrid2D m_grid2D;
+    DynamicAABBTree m_tree3D;
+    std::vector<int> m_queryCandidates;
 
     int m_windowWidth = 0;
     int m_windowHeight = 0;
+    int m_framebufferWidth = 0;
+    int m_framebufferHeight = 0;
 
     ClickableComponent* m_hoveredComponent = nullptr;
 
+    // Hover is only re-evaluated when one of these inputs changes.
+    bool m_pickDirty = true;
+    Scene* m_lastScene = nullptr;
+    glm::vec2 m_lastMouseScreenPos = glm::vec2(-1.0f);
+
+    struct CameraCache {
+        const CameraBaseComponent* camera = nullptr;
+        unsigned int cameraVersion = 0;
+        unsigned int transformVersion = 0;
+        glm::mat4 inverseViewProjection = glm::mat4(1.0f);
+        glm::mat4 inverseProjection = glm::mat4(1.0f);
+        glm::mat4 cameraWorldMatrix = glm::mat4(1.0f);
+    };
+    CameraCache m_cameraCache;
+
+    PickingMode m_pickingMode = PickingMode::CPU;
+    IdBufferPicker m_idBufferPicker;
+    std::shared_ptr<Mesh> m_fallbackQuad;
+    std::vector<int> m_idPassOrder;
+    unsigned int m_gpuHoveredId = IdBufferPicker::kNoId;
+    bool m_gpuResultPending = false;
+
     struct Ray {
         glm::vec3 origin;
         glm::vec3 direction;
     };
 
+    void refreshProxy(int proxyId);
+    void refreshDirtyProxies();
+    bool refreshCameraCache(CameraBaseComponent* camera);
+    ClickableComponent* pickFromIdBuffer();
+    unsigned int encodePickId(int proxyId) const;
+
+    ClickableComponent* pick2D(const glm::vec2& mouseWorldPos2D);
+    ClickableComponent* pick3D(const Ray& ray);
+
     glm::vec2 screenToWorld2D(const glm::vec2& screenCoords, Camera2DComponent* camera);
 
-    bool isMouseOver2D(GameObject* gameObject, const glm::vec2& mouseWorldPos2D);
+    void getGameObjectWorldRect2D(GameObject* gameObject, glm::vec2& outMin, glm::vec2& outMax);
+
+    bool isMouseOver2D(const PickingProxy& proxy, const glm::vec2& mouseWorldPos2D);
 
     Ray screenToWorldRay3D(const glm::vec2& screenCoords, Camera3DComponent* camera);
 
-    bool rayIntersectsAABB(const Ray& ray, GameObject* gameObject, float& outT);
+    bool rayIntersectsAABB(const Ray& ray, const glm::vec3& aabbMin, const glm::vec3& aabbMax, float& outT);
 
     void getGameObjectWorldAABB(GameObject* obj, glm::vec3& outMin, glm::vec3& outMax);
 };
\ No newline at end of file
@@ -0,0 +1,133 @@
+#include "Core/ProgramBinaryCache.h"
+#include "Core/AssetId.h"
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+std::string ProgramBinaryCache::s_directory = "cache/shaders";
+bool ProgramBinaryCache::s_enabled = true;
+
+namespace {
+    const char kEntryMagic[4] = { 'E', 'P', 'B', 'C' };
+
+    struct EntryHeader {
+        char magic[4];
+        uint32_t binaryFormat;
+        uint64_t key;
+        uint64_t binaryLength;
+    };
+
+    std::string getGLString(GLenum name) {
+        const GLubyte* value = glGetString(name);
+        return value ? reinterpret_cast<const char*>(value) : "";
+    }
+}
+
+bool ProgramBinaryCache::isAvailable() {
+    if (!s_enabled || !(GLEW_VERSION_4_1 || GLEW_ARB_get_program_binary)) {
+        return false;
+    }
+    GLint formatCount = 0;
+    glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formatCount);
+    return formatCount > 0;
+}
+
+uint64_t ProgramBinaryCache::makeKey(const std::string& vertexCode, const std::string& fragmentCode, const std::string& geometryCode) {
+    AssetId key = hashAssetName(vertexCode);
+    key = appendAssetName(key, fragmentCode);
+    key = appendAssetName(key, geometryCode);
+    key = appendAssetName(key, getGLString(GL_VENDOR));
+    key = appendAssetName(key, getGLString(GL_RENDERER));
+    key = appendAssetName(key, getGLString(GL_VERSION));
+    return key;
+}
+
+std::string ProgramBinaryCache::getEntryPath(uint64_t key) {
+    char name[32];
+    std::snprintf(name, sizeof(name), "%016llx.bin", static_cast<unsigned long long>(key));
+    return (std::filesystem::path(s_directory) / name).string();
+}
+
+GLuint ProgramBinaryCache::load(uint64_t key) {
+    std::string path = getEntryPath(key);
+    std::ifstream file(path, std::ios::binary);
+    if (!file) {
+        return 0;
+    }
+
+    EntryHeader header;
+    std::vector<char> binary;
+    bool valid = static_cast<bool>(file.read(reinterpret_cast<char*>(&header), sizeof(header)))
+        && std::memcmp(header.magic, kEntryMagic, sizeof(kEntryMagic)) == 0
+        && header.key == key
+        && header.binaryLength > 0 && header.binaryLength < (64ull << 20);
+    if (valid) {
+        binary.resize(static_cast<size_t>(header.binaryLength));
+        valid = static_cast<bool>(file.read(binary.data(), static_cast<std::streamsize>(binary.size())));
+    }
+    file.close();
+
+    GLuint program = 0;
+    if (valid) {
+        program = glCreateProgram();
+        glProgramBinary(program, header.binaryFormat, binary.data(), static_cast<GLsizei>(binary.size()));
+        GLint success = GL_FALSE;
+        glGetProgramiv(program, GL_LINK_STATUS, &success);
+        if (!success) {
+            glDeleteProgram(program);
+            program = 0;
+        }
+    }
+
+    if (program == 0) {
+        std::cout << "ProgramBinaryCache: discarding stale entry " << path << std::endl;
+        std::error_code error;
+        std::filesystem::remove(path, error);
+    }
+    return program;
+}
+
+bool ProgramBinaryCache::store(uint64_t key, GLuint program) {
+    GLint length = 0;
+    glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+    if (length <= 0) {
+        return false;
+    }
+
+    std::vector<char> binary(static_cast<size_t>(length));
+    GLenum format = 0;
+    GLsizei written = 0;
+    glGetProgramBinary(program, length, &written, &format, binary.data());
+    if (written <= 0) {
+        return false;
+    }
+
+    std::error_code error;
+    std::filesystem::create_directories(s_directory, error);
+
+    // Write to a temporary name first so a crash never leaves a truncated entry.
+    std::string path = getEntryPath(key);
+    std::string temporaryPath = path + ".tmp";
+    {
+        std::ofstream file(temporaryPath, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            std::cerr << "ERROR::PROGRAMBINARYCACHE: Could not write " << temporaryPath << std::endl;
+            return false;
+        }
+        EntryHeader header;
+        std::memcpy(header.magic, kEntryMagic, sizeof(kEntryMagic));
+        header.binaryFormat = format;
+        header.key = key;
+        header.binaryLength = static_cast<uint64_t>(written);
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(binary.data(), written);
+        if (!file) {
+            return false;
+        }
+    }
+    std::filesystem::rename(temporaryPath, path, error);
+    return !error;
+}
\ No newline at end of file
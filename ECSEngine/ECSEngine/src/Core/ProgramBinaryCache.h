@@ -0,0 +1,29 @@
+#pragma once
+
+#include <GL/glew.h>
+#include <cstdint>
+#include <string>
+
+// On-disk cache of linked shader programs (ARB_get_program_binary). Entries
+// are keyed by a hash of the GLSL sources and the driver's vendor, renderer
+// and version strings, so a driver update or a shader edit simply misses.
+class ProgramBinaryCache {
+public:
+    static void setDirectory(const std::string& directory) { s_directory = directory; }
+    static void setEnabled(bool enabled) { s_enabled = enabled; }
+
+    static bool isAvailable();
+    static uint64_t makeKey(const std::string& vertexCode, const std::string& fragmentCode, const std::string& geometryCode);
+
+    // Returns a linked program, or 0 if there is no entry or the driver
+    // rejected it. Rejected entries are deleted.
+    static GLuint load(uint64_t key);
+    // The program must have been linked with GL_PROGRAM_BINARY_RETRIEVABLE_HINT set.
+    static bool store(uint64_t key, GLuint program);
+
+private:
+    static std::string s_directory;
+    static bool s_enabled;
+
+    static std::string getEntryPath(uint64_t key);
+};
\ No newline at end of file
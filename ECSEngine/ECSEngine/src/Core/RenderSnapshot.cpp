@@ -0,0 +1,37 @@
+#include "Core/RenderSnapshot.h"
+#include "Core/Mesh.h"
+#include "Core/Shader.h"
+#include "Core/Texture.h"
+
+RenderSnapshotBuffer::RenderSnapshotBuffer()
+    : m_writeIndex(0),
+    m_readIndex(1),
+    m_shared(2),
+    m_hasRead(false),
+    m_nextFrameIndex(0)
+{
+}
+
+RenderSnapshot& RenderSnapshotBuffer::beginWrite() {
+    RenderSnapshot& snapshot = m_snapshots[m_writeIndex];
+    snapshot.clear();
+    snapshot.frameIndex = m_nextFrameIndex++;
+    return snapshot;
+}
+
+void RenderSnapshotBuffer::publish() {
+    unsigned int previous = m_shared.exchange(m_writeIndex | kFreshBit, std::memory_order_acq_rel);
+    m_writeIndex = previous & kIndexMask;
+}
+
+const RenderSnapshot* RenderSnapshotBuffer::acquireLatest() {
+    if (m_shared.load(std::memory_order_relaxed) & kFreshBit) {
+        // Drop the old snapshot's asset references here, on the consuming (GL)
+        // thread, so meshes and textures are released where the context lives.
+        m_snapshots[m_readIndex].clear();
+        unsigned int previous = m_shared.exchange(m_readIndex, std::memory_order_acq_rel);
+        m_readIndex = previous & kIndexMask;
+        m_hasRead = true;
+    }
+    return m_hasRead ? &m_snapshots[m_readIndex] : nullptr;
+}
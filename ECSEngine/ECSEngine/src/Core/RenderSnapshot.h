@@ -0,0 +1,100 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+#include <atomic>
+#include <cstdint>
+#include "Core/FrameArena.h"
+
+class Mesh;
+class Shader;
+class Texture;
+
+struct DrawPacket {
+    glm::mat4 model;
+    std::shared_ptr<Mesh> mesh;
+    std::shared_ptr<Shader> shader;
+    std::shared_ptr<Texture> texture;
+    glm::vec4 color;
+    glm::vec4 uvRect;
+    // Base shader plus the ShaderFeature bits; the renderer resolves the
+    // variant on the GL thread.
+    uint32_t shaderFeatures;
+    float alphaCutoff;
+};
+
+// Screen-space text drawn after the packets. The characters live in
+// RenderSnapshot::text so a frame's labels share one buffer.
+struct TextPacket {
+    uint32_t offset;
+    uint32_t length;
+    glm::vec2 position;
+    float scale;
+    glm::vec3 color;
+};
+
+// The lists live in the snapshot's own arena. clear() rewinds it and
+// reserves what the last frame used, so a steady frame allocates nothing.
+struct RenderSnapshot {
+private:
+    static constexpr size_t kArenaBlockSize = 64 * 1024;
+    // Declared before the lists that allocate from it.
+    FrameArena m_arena{ kArenaBlockSize };
+
+public:
+    uint64_t frameIndex = 0;
+    glm::mat4 view = glm::mat4(1.0f);
+    glm::mat4 projection = glm::mat4(1.0f);
+    FrameVector<DrawPacket> packets{ &m_arena };
+    FrameString text{ &m_arena };
+    FrameVector<TextPacket> texts{ &m_arena };
+
+    RenderSnapshot() = default;
+    RenderSnapshot(const RenderSnapshot&) = delete;
+    RenderSnapshot& operator=(const RenderSnapshot&) = delete;
+
+    void addText(std::string_view label, float x, float y, float scale, const glm::vec3& color) {
+        texts.push_back({ static_cast<uint32_t>(text.size()), static_cast<uint32_t>(label.size()), glm::vec2(x, y), scale, color });
+        text.append(label);
+    }
+
+    void clear() {
+        size_t packetCapacity = packets.capacity();
+        size_t textCapacity = text.capacity();
+        size_t textsCapacity = texts.capacity();
+        // Drop the old storage before the arena is rewound under it.
+        FrameVector<DrawPacket>(&m_arena).swap(packets);
+        FrameString(&m_arena).swap(text);
+        FrameVector<TextPacket>(&m_arena).swap(texts);
+        m_arena.reset();
+        packets.reserve(packetCapacity);
+        text.reserve(textCapacity);
+        texts.reserve(textsCapacity);
+    }
+};
+
+// Lock-free triple buffer: the producer always owns one slot, the consumer
+// owns another and the third is handed over through m_shared.
+class RenderSnapshotBuffer {
+public:
+    RenderSnapshotBuffer();
+
+    RenderSnapshot& beginWrite();
+    void publish();
+
+    const RenderSnapshot* acquireLatest();
+
+private:
+    static constexpr unsigned int kIndexMask = 0x3;
+    static constexpr unsigned int kFreshBit = 0x4;
+
+    RenderSnapshot m_snapshots[3];
+    unsigned int m_writeIndex;
+    unsigned int m_readIndex;
+    std::atomic<unsigned int> m_shared;
+    bool m_hasRead;
+    uint64_t m_nextFrameIndex;
+};
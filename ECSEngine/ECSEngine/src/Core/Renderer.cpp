@@ -0,0 +1,96 @@
+#include "Core/Renderer.h"
+#include "Core/Mesh.h"
+#include "Core/Shader.h"
+#include "Core/Texture.h"
+#include "Core/AssetManager.h"
+#include "Core/FrameStats.h"
+#include "Core/FontRenderer.h"
+#include "Core/SpriteBatch.h"
+#include <GL/glew.h>
+#include <iostream>
+
+Renderer::Renderer() {
+}
+
+Renderer::~Renderer() {
+}
+
+void Renderer::Submit(const RenderSnapshot& snapshot) {
+    Shader* boundShader = nullptr;
+    // Sprites packed into one atlas share a texture, so consecutive packets
+    // usually skip the rebind entirely.
+    const Texture* boundTexture = nullptr;
+    bool textureStateKnown = false;
+    // Consecutive packets usually ask for the same variant; skip the lookup.
+    const Shader* lastBaseShader = nullptr;
+    uint32_t lastFeatures = SHADER_FEATURE_NONE;
+    std::shared_ptr<Shader> variant;
+    SpriteBatch& spriteBatch = SpriteBatch::getInstance();
+    spriteBatch.setCamera(snapshot.view, snapshot.projection);
+
+    for (const DrawPacket& packet : snapshot.packets) {
+        if (!packet.shader || !packet.mesh) {
+            continue;
+        }
+
+        // Quads go through the sprite batch, which binds its own program and
+        // texture when a run is flushed.
+        if (spriteBatch.add(packet)) {
+            boundShader = nullptr;
+            textureStateKnown = false;
+            FrameStats::getInstance().countVisibleEntity();
+            continue;
+        }
+        spriteBatch.flush();
+
+        if (packet.shader.get() != lastBaseShader || packet.shaderFeatures != lastFeatures || !variant) {
+            variant = AssetManager::getInstance().getShaderVariant(packet.shader, packet.shaderFeatures);
+            lastBaseShader = packet.shader.get();
+            lastFeatures = packet.shaderFeatures;
+        }
+
+        if (variant.get() != boundShader) {
+            boundShader = variant.get();
+            boundShader->use();
+            boundShader->setMat4("view", snapshot.view);
+            boundShader->setMat4("projection", snapshot.projection);
+            boundShader->setInt("texture_diffuse1", 0);
+            textureStateKnown = false;
+        }
+
+        boundShader->setMat4("model", packet.model);
+        boundShader->setVec4("objectColor", packet.color);
+        boundShader->setVec4("uvRect", packet.uvRect);
+        if (packet.shaderFeatures & SHADER_FEATURE_ALPHA_TEST) {
+            boundShader->setFloat("alphaCutoff", packet.alphaCutoff);
+        }
+
+        if (!textureStateKnown || packet.texture.get() != boundTexture) {
+            if (packet.texture) {
+                packet.texture->bind();
+            }
+            else {
+                glActiveTexture(GL_TEXTURE0);
+                glBindTexture(GL_TEXTURE_2D, 0);
+            }
+            boundTexture = packet.texture.get();
+            textureStateKnown = true;
+        }
+
+        packet.mesh->draw();
+        FrameStats::getInstance().countVisibleEntity();
+    }
+    spriteBatch.flush();
+
+    if (boundShader) {
+        boundShader->detach();
+    }
+}
+
+
+void Renderer::SubmitText(const RenderSnapshot& snapshot, FontRenderer& fontRenderer) {
+    const std::string_view text = snapshot.text;
+    for (const TextPacket& packet : snapshot.texts) {
+        fontRenderer.renderText(text.substr(packet.offset, packet.length), packet.position.x, packet.position.y, packet.scale, packet.color);
+    }
+}
\ No newline at end of file
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "Core/RenderSnapshot.h"
+
+class FontRenderer;
+
+class Renderer {
+public:
+    Renderer();
+    ~Renderer();
+
+    void Submit(const RenderSnapshot& snapshot);
+    static void SubmitText(const RenderSnapshot& snapshot, FontRenderer& fontRenderer);
+};
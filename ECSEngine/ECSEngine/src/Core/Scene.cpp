@@ -5,6 +5,7 @@
 #include "Core/FontRenderer.h"
 #include "Core/Shader.h"
 #include "Core/AssetManager.h"
+#include "Core/SpriteBatch.h"
 #include <iostream>
 #include <algorithm>
 #include <filesystem> 
@@ -14,7 +15,8 @@ Scene::Scene(const std::string& name)
     : m_name(name),
     m_activeCamera(nullptr),
     m_windowWidth(800),
-    m_windowHeight(600)
+    m_windowHeight(600),
+    m_interpolationAlpha(1.0f)
 {
     std::cout << "Scene '" << m_name << "' created." << std::endl;
 }
@@ -47,6 +49,14 @@ void Scene::Update(float deltaTime) {
     PickingManager::getInstance().Update(deltaTime, this);
 }
 
+void Scene::FixedUpdate(float fixedDeltaTime) {
+    for (const auto& gameObject : m_gameObjects) {
+        if (gameObject) {
+            gameObject->FixedUpdate(fixedDeltaTime);
+        }
+    }
+}
+
 void Scene::Render() {
     glm::mat4 projectionMatrix = glm::mat4(1.0f);
     glm::mat4 viewMatrix = glm::mat4(1.0f);
@@ -61,7 +71,21 @@ void Scene::Render() {
 
     for (const auto& gameObject : m_gameObjects) {
         if (gameObject) {
-            gameObject->Render(viewMatrix, projectionMatrix); 
+            gameObject->Render(viewMatrix, projectionMatrix, m_interpolationAlpha); 
+        }
+    }
+    SpriteBatch::getInstance().flush();
+}
+
+void Scene::BuildRenderSnapshot(RenderSnapshot& outSnapshot) {
+    if (m_activeCamera) {
+        outSnapshot.projection = m_activeCamera->getProjectionMatrix();
+        outSnapshot.view = m_activeCamera->getViewMatrix();
+    }
+
+    for (const auto& gameObject : m_gameObjects) {
+        if (gameObject) {
+            gameObject->CollectDrawPackets(outSnapshot.packets, m_interpolationAlpha);
         }
     }
 }
@@ -82,6 +106,10 @@ GameObject* Scene::AddGameObject(std::unique_ptr<GameObject> gameObject) {
     return rawPtr;
 }
 
+void Scene::reserveGameObjects(size_t count) {
+    m_gameObjects.reserve(count);
+}
+
 void Scene::RemoveGameObject(GameObject* gameObject) {
     auto it = std::remove_if(m_gameObjects.begin(), m_gameObjects.end(),
         [gameObject](const std::unique_ptr<GameObject>& ptr) {
@@ -5,6 +5,7 @@
 #include <memory>
 #include <map>
 #include "PickingManager.h"
+#include "RenderSnapshot.h"
 
 class GameObject;
 class Shader;
@@ -18,12 +19,18 @@ public:
 
     virtual void Init();
     virtual void Update(float deltaTime);
+    virtual void FixedUpdate(float fixedDeltaTime);
     virtual void Render();
+    virtual void BuildRenderSnapshot(RenderSnapshot& outSnapshot);
+    virtual bool supportsPipelinedSimulation() const { return false; }
     virtual void Shutdown();
 
     const std::string& getName() const { return m_name; }
+    FontRenderer* getFontRenderer() const { return m_fontRenderer.get(); }
 
     GameObject* AddGameObject(std::unique_ptr<GameObject> gameObject);
+    const std::vector<std::unique_ptr<GameObject>>& getGameObjects() const { return m_gameObjects; }
+    void reserveGameObjects(size_t count);
     void RemoveGameObject(GameObject* gameObject);
     void RemoveGameObjectByName(const std::string& name);
 
@@ -34,6 +41,9 @@ public:
     int getWindowHeight() const { return m_windowHeight; }
     void setWindowDimensions(int width, int height);
 
+    void setInterpolationAlpha(float alpha) { m_interpolationAlpha = alpha; }
+    float getInterpolationAlpha() const { return m_interpolationAlpha; }
+
 
 protected:
     std::string m_name;
@@ -43,6 +53,8 @@ protected:
     int m_windowWidth;
     int m_windowHeight;
 
+    float m_interpolationAlpha;
+
     std::shared_ptr<FontRenderer> m_fontRenderer;
 
 
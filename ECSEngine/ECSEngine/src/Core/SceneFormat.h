@@ -0,0 +1,124 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+
+// On-disk layout of binary scenes (.escn), written by SceneSerializer. Every
+// record is a fixed-size POD, so the loader walks the arrays in place. Entities
+// are stored depth first, which puts every parent before its children.
+// Component records point at entities and assets by index.
+//
+//   SceneFileHeader
+//   SceneAssetRecord[assetCount]
+//   SceneEntityRecord[entityCount]
+//   SceneRenderRecord[renderCount]
+//   SceneMeshRecord[meshCount]
+//   SceneClickableRecord[clickableCount]
+//   SceneCameraRecord[cameraCount]
+//   strings (not terminated)
+
+constexpr char kSceneFileMagic[4] = { 'E', 'S', 'C', 'N' };
+constexpr uint32_t kSceneFileVersion = 1;
+constexpr const char* kSceneFileExtension = ".escn";
+constexpr uint32_t kSceneNoIndex = 0xFFFFFFFFu;
+
+enum class SceneAssetType : uint32_t {
+    Shader = 1,
+    Texture = 2,
+    // The texture of a TextureAtlas, referenced by atlas name.
+    AtlasTexture = 3,
+    Mesh = 4
+};
+
+enum class SceneCameraType : uint32_t {
+    Camera2D = 1,
+    Camera3D = 2
+};
+
+enum SceneEntityFlags : uint32_t {
+    SCENE_ENTITY_INTERPOLATED = 1 << 0
+};
+
+struct SceneString {
+    uint32_t offset;
+    uint32_t length;
+};
+
+struct SceneFileHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t assetCount;
+    uint32_t entityCount;
+    uint32_t renderCount;
+    uint32_t meshCount;
+    uint32_t clickableCount;
+    uint32_t cameraCount;
+    // Entity whose camera is active, or kSceneNoIndex.
+    uint32_t activeCameraEntity;
+    uint32_t stringsSize;
+};
+
+// Shader: vertex, fragment and geometry path. Texture: path and type.
+// AtlasTexture: atlas name. Mesh: no strings; value is the MeshPrimitive and
+// parameter its tile factor.
+struct SceneAssetRecord {
+    uint32_t type;
+    uint32_t value;
+    float parameter;
+    SceneString strings[3];
+};
+
+struct SceneEntityRecord {
+    uint32_t parent;
+    uint32_t flags;
+    SceneString name;
+    float position[3];
+    float rotation[4];
+    float scale[3];
+};
+
+struct SceneRenderRecord {
+    uint32_t entity;
+    uint32_t shader;
+    uint32_t texture;
+    uint32_t mesh;
+    float color[4];
+    float uvRect[4];
+    float alphaCutoff;
+};
+
+struct SceneMeshRecord {
+    uint32_t entity;
+    uint32_t mesh;
+};
+
+struct SceneClickableRecord {
+    uint32_t entity;
+    uint32_t pickingMethod;
+};
+
+// Camera2D: width, height, zoom. Camera3D: fov, aspect ratio, look-at target.
+struct SceneCameraRecord {
+    uint32_t entity;
+    uint32_t type;
+    float nearPlane;
+    float farPlane;
+    float parameters[5];
+};
+
+// Non-owning view over a scene file held in memory.
+struct SceneFileView {
+    const SceneFileHeader* header = nullptr;
+    const SceneAssetRecord* assets = nullptr;
+    const SceneEntityRecord* entities = nullptr;
+    const SceneRenderRecord* renders = nullptr;
+    const SceneMeshRecord* meshes = nullptr;
+    const SceneClickableRecord* clickables = nullptr;
+    const SceneCameraRecord* cameras = nullptr;
+    const char* strings = nullptr;
+
+    // Validates the header, every string and every entity and asset index.
+    bool parse(const void* data, size_t size);
+    std::string_view getString(const SceneString& string) const { return std::string_view(strings + string.offset, string.length); }
+};
\ No newline at end of file
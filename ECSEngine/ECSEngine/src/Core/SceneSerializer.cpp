@@ -0,0 +1,620 @@
+#include "Core/SceneSerializer.h"
+#include "Core/SceneFormat.h"
+#include "Core/Scene.h"
+#include "Core/GameObject.h"
+#include "Core/AssetManager.h"
+#include "Core/VirtualFileSystem.h"
+#include "Core/Mesh.h"
+#include "Core/MemoryTracker.h"
+#include "Core/Shader.h"
+#include "Core/Texture.h"
+#include "Core/TextureAtlas.h"
+#include "Components/TransformComponent.h"
+#include "Components/RenderComponent.h"
+#include "Components/MeshComponent.h"
+#include "Components/ClickableComponent.h"
+#include "Components/Camera2DComponent.h"
+#include "Components/Camera3DComponent.h"
+
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+    const char* kAtlasTexturePrefix = "Atlas:";
+
+    // Everything save() writes, gathered in one pass over the scene.
+    struct SceneData {
+        std::vector<SceneAssetRecord> assets;
+        std::vector<SceneEntityRecord> entities;
+        std::vector<SceneRenderRecord> renders;
+        std::vector<SceneMeshRecord> meshes;
+        std::vector<SceneClickableRecord> clickables;
+        std::vector<SceneCameraRecord> cameras;
+        std::string strings;
+        uint32_t activeCameraEntity = kSceneNoIndex;
+        size_t skippedComponents = 0;
+
+        std::unordered_map<std::string, SceneString> stringLookup;
+        std::unordered_map<const void*, uint32_t> assetLookup;
+        std::unordered_map<std::string, uint32_t> assetKeyLookup;
+
+        SceneString addString(const std::string& value) {
+            auto it = stringLookup.find(value);
+            if (it != stringLookup.end()) {
+                return it->second;
+            }
+            SceneString string = { static_cast<uint32_t>(strings.size()), static_cast<uint32_t>(value.size()) };
+            strings += value;
+            stringLookup.emplace(value, string);
+            return string;
+        }
+
+        std::string_view getString(const SceneString& string) const {
+            return std::string_view(strings.data() + string.offset, string.length);
+        }
+
+        // Assets are deduplicated by pointer first and then by key, so two
+        // meshes generated the same way are written once.
+        uint32_t addAsset(const void* pointer, const std::string& key, SceneAssetRecord record) {
+            auto byPointer = assetLookup.find(pointer);
+            if (byPointer != assetLookup.end()) {
+                return byPointer->second;
+            }
+            auto byKey = assetKeyLookup.find(key);
+            uint32_t index = byKey != assetKeyLookup.end() ? byKey->second : static_cast<uint32_t>(assets.size());
+            if (byKey == assetKeyLookup.end()) {
+                assets.push_back(record);
+                assetKeyLookup.emplace(key, index);
+            }
+            assetLookup.emplace(pointer, index);
+            return index;
+        }
+
+        uint32_t addShader(const std::shared_ptr<Shader>& shader) {
+            if (!shader) {
+                return kSceneNoIndex;
+            }
+            SceneAssetRecord record = {};
+            record.type = static_cast<uint32_t>(SceneAssetType::Shader);
+            record.strings[0] = addString(shader->getVertexPath());
+            record.strings[1] = addString(shader->getFragmentPath());
+            record.strings[2] = addString(shader->getGeometryPath());
+            return addAsset(shader.get(), "shader|" + shader->getVertexPath() + "|" + shader->getFragmentPath() + "|" + shader->getGeometryPath(), record);
+        }
+
+        uint32_t addTexture(const std::shared_ptr<Texture>& texture) {
+            if (!texture) {
+                return kSceneNoIndex;
+            }
+            SceneAssetRecord record = {};
+            const std::string& path = texture->getPath();
+            if (path.compare(0, std::strlen(kAtlasTexturePrefix), kAtlasTexturePrefix) == 0) {
+                record.type = static_cast<uint32_t>(SceneAssetType::AtlasTexture);
+                record.strings[0] = addString(path.substr(std::strlen(kAtlasTexturePrefix)));
+            }
+            else if (VirtualFileSystem::getInstance().exists(path)) {
+                record.type = static_cast<uint32_t>(SceneAssetType::Texture);
+                record.strings[0] = addString(path);
+                record.strings[1] = addString(texture->getType());
+            }
+            else {
+                // Generated at runtime (text, render targets); the scene recreates those.
+                ++skippedComponents;
+                return kSceneNoIndex;
+            }
+            return addAsset(texture.get(), "texture|" + path + "|" + texture->getType(), record);
+        }
+
+        uint32_t addMesh(const std::shared_ptr<Mesh>& mesh) {
+            if (!mesh) {
+                return kSceneNoIndex;
+            }
+            if (mesh->getPrimitive() == MeshPrimitive::Custom) {
+                ++skippedComponents;
+                return kSceneNoIndex;
+            }
+            SceneAssetRecord record = {};
+            record.type = static_cast<uint32_t>(SceneAssetType::Mesh);
+            record.value = static_cast<uint32_t>(mesh->getPrimitive());
+            record.parameter = mesh->getPrimitiveParameter();
+            return addAsset(mesh.get(), "mesh|" + std::to_string(record.value) + "|" + std::to_string(record.parameter), record);
+        }
+    };
+
+    void copyVector(float* out, const glm::vec3& value) {
+        out[0] = value.x;
+        out[1] = value.y;
+        out[2] = value.z;
+    }
+
+    void copyVector(float* out, const glm::vec4& value) {
+        out[0] = value.x;
+        out[1] = value.y;
+        out[2] = value.z;
+        out[3] = value.w;
+    }
+
+    void collectObject(const GameObject& object, uint32_t parent, const CameraBaseComponent* activeCamera, SceneData& data) {
+        const uint32_t entity = static_cast<uint32_t>(data.entities.size());
+        const TransformComponent* transform = object.getTransform();
+
+        SceneEntityRecord record = {};
+        record.parent = parent;
+        record.flags = transform->isInterpolationEnabled() ? static_cast<uint32_t>(SCENE_ENTITY_INTERPOLATED) : 0u;
+        record.name = data.addString(object.getName());
+        copyVector(record.position, transform->getLocalPosition());
+        const glm::quat& rotation = transform->getLocalRotation();
+        copyVector(record.rotation, glm::vec4(rotation.x, rotation.y, rotation.z, rotation.w));
+        copyVector(record.scale, transform->getLocalScale());
+        data.entities.push_back(record);
+
+        for (const auto& component : object.getComponents()) {
+            if (const RenderComponent* render = dynamic_cast<const RenderComponent*>(component.get())) {
+                SceneRenderRecord renderRecord = {};
+                renderRecord.entity = entity;
+                renderRecord.shader = data.addShader(render->getShader());
+                renderRecord.texture = data.addTexture(render->m_texture);
+                renderRecord.mesh = data.addMesh(render->m_mesh);
+                copyVector(renderRecord.color, render->m_objectColor);
+                copyVector(renderRecord.uvRect, render->m_uvRect);
+                renderRecord.alphaCutoff = render->getAlphaCutoff();
+                data.renders.push_back(renderRecord);
+            }
+            else if (const MeshComponent* mesh = dynamic_cast<const MeshComponent*>(component.get())) {
+                data.meshes.push_back({ entity, data.addMesh(mesh->getMesh()) });
+            }
+            else if (const ClickableComponent* clickable = dynamic_cast<const ClickableComponent*>(component.get())) {
+                data.clickables.push_back({ entity, static_cast<uint32_t>(clickable->getPickingMethod()) });
+            }
+            else if (const Camera2DComponent* camera2D = dynamic_cast<const Camera2DComponent*>(component.get())) {
+                SceneCameraRecord camera = {};
+                camera.entity = entity;
+                camera.type = static_cast<uint32_t>(SceneCameraType::Camera2D);
+                camera.nearPlane = camera2D->getNearPlane();
+                camera.farPlane = camera2D->getFarPlane();
+                camera.parameters[0] = camera2D->getScreenWidth();
+                camera.parameters[1] = camera2D->getScreenHeight();
+                camera.parameters[2] = camera2D->getZoom();
+                data.cameras.push_back(camera);
+                if (camera2D == activeCamera) {
+                    data.activeCameraEntity = entity;
+                }
+            }
+            else if (const Camera3DComponent* camera3D = dynamic_cast<const Camera3DComponent*>(component.get())) {
+                SceneCameraRecord camera = {};
+                camera.entity = entity;
+                camera.type = static_cast<uint32_t>(SceneCameraType::Camera3D);
+                camera.nearPlane = camera3D->getNearPlane();
+                camera.farPlane = camera3D->getFarPlane();
+                camera.parameters[0] = camera3D->getFov();
+                camera.parameters[1] = camera3D->getAspectRatio();
+                copyVector(&camera.parameters[2], camera3D->getLookAtTarget());
+                data.cameras.push_back(camera);
+                if (camera3D == activeCamera) {
+                    data.activeCameraEntity = entity;
+                }
+            }
+            else if (component) {
+                ++data.skippedComponents;
+            }
+        }
+
+        for (const auto& child : object.getChildren()) {
+            if (child) {
+                collectObject(*child, entity, activeCamera, data);
+            }
+        }
+    }
+
+    void collectScene(const Scene& scene, SceneData& data) {
+        for (const auto& object : scene.getGameObjects()) {
+            if (object) {
+                collectObject(*object, kSceneNoIndex, scene.getActiveCamera(), data);
+            }
+        }
+        if (data.skippedComponents > 0) {
+            std::cout << "SceneSerializer: skipped " << data.skippedComponents << " unsupported component(s) or asset reference(s)." << std::endl;
+        }
+    }
+
+    template<typename T>
+    void writeArray(std::ofstream& file, const std::vector<T>& values) {
+        file.write(reinterpret_cast<const char*>(values.data()), static_cast<std::streamsize>(sizeof(T) * values.size()));
+    }
+
+    template<typename T>
+    bool takeArray(const unsigned char*& cursor, const unsigned char* end, uint32_t count, const T*& out) {
+        if (static_cast<size_t>(end - cursor) / sizeof(T) < count) {
+            return false;
+        }
+        out = reinterpret_cast<const T*>(cursor);
+        cursor += sizeof(T) * count;
+        return true;
+    }
+
+    // JSON output helpers; only used by the debug dump.
+    void writeJsonString(std::ostream& out, std::string_view value) {
+        out << '"';
+        for (char c : value) {
+            switch (c) {
+            case '"': out << "\\\""; break;
+            case '\\': out << "\\\\"; break;
+            case '\n': out << "\\n"; break;
+            case '\t': out << "\\t"; break;
+            default:
+                if (static_cast<unsigned char>(c) < 0x20) {
+                    char escaped[8];
+                    std::snprintf(escaped, sizeof(escaped), "\\u%04x", c);
+                    out << escaped;
+                }
+                else {
+                    out << c;
+                }
+            }
+        }
+        out << '"';
+    }
+
+    void writeJsonFloats(std::ostream& out, const float* values, int count) {
+        out << '[';
+        for (int i = 0; i < count; ++i) {
+            out << (i > 0 ? ", " : "") << values[i];
+        }
+        out << ']';
+    }
+
+    void writeJsonIndex(std::ostream& out, uint32_t index) {
+        if (index == kSceneNoIndex) {
+            out << -1;
+        }
+        else {
+            out << index;
+        }
+    }
+
+    std::shared_ptr<Mesh> createPrimitiveMesh(MeshPrimitive primitive, float parameter) {
+        std::shared_ptr<Mesh> mesh = std::make_shared<Mesh>("ScenePrimitive");
+        if (primitive == MeshPrimitive::Plane) {
+            mesh->generatePlane(parameter);
+        }
+        else if (primitive == MeshPrimitive::Quad2D) {
+            mesh->generateQuad2D();
+        }
+        return mesh;
+    }
+}
+
+bool SceneFileView::parse(const void* data, size_t size) {
+    header = nullptr;
+    if (!data || size < sizeof(SceneFileHeader)) {
+        std::cerr << "ERROR::SCENEFILE: File too small for header." << std::endl;
+        return false;
+    }
+
+    const SceneFileHeader* candidate = static_cast<const SceneFileHeader*>(data);
+    if (std::memcmp(candidate->magic, kSceneFileMagic, sizeof(kSceneFileMagic)) != 0) {
+        std::cerr << "ERROR::SCENEFILE: Bad magic." << std::endl;
+        return false;
+    }
+    if (candidate->version != kSceneFileVersion) {
+        std::cerr << "ERROR::SCENEFILE: Unsupported version " << candidate->version << "." << std::endl;
+        return false;
+    }
+
+    const unsigned char* cursor = static_cast<const unsigned char*>(data) + sizeof(SceneFileHeader);
+    const unsigned char* end = static_cast<const unsigned char*>(data) + size;
+    const char* stringData = nullptr;
+    if (!takeArray(cursor, end, candidate->assetCount, assets)
+        || !takeArray(cursor, end, candidate->entityCount, entities)
+        || !takeArray(cursor, end, candidate->renderCount, renders)
+        || !takeArray(cursor, end, candidate->meshCount, meshes)
+        || !takeArray(cursor, end, candidate->clickableCount, clickables)
+        || !takeArray(cursor, end, candidate->cameraCount, cameras)
+        || !takeArray(cursor, end, candidate->stringsSize, stringData)) {
+        std::cerr << "ERROR::SCENEFILE: Truncated file." << std::endl;
+        return false;
+    }
+
+    const uint32_t entityCount = candidate->entityCount;
+    const uint32_t assetCount = candidate->assetCount;
+    auto validString = [candidate](const SceneString& string) {
+        return string.offset <= candidate->stringsSize && string.length <= candidate->stringsSize - string.offset;
+    };
+    auto validAsset = [assetCount](uint32_t index) { return index == kSceneNoIndex || index < assetCount; };
+
+    bool valid = candidate->activeCameraEntity == kSceneNoIndex || candidate->activeCameraEntity < entityCount;
+    for (uint32_t i = 0; valid && i < assetCount; ++i) {
+        valid = validString(assets[i].strings[0]) && validString(assets[i].strings[1]) && validString(assets[i].strings[2]);
+    }
+    for (uint32_t i = 0; valid && i < entityCount; ++i) {
+        valid = (entities[i].parent == kSceneNoIndex || entities[i].parent < i) && validString(entities[i].name);
+    }
+    for (uint32_t i = 0; valid && i < candidate->renderCount; ++i) {
+        valid = renders[i].entity < entityCount && validAsset(renders[i].shader) && validAsset(renders[i].texture) && validAsset(renders[i].mesh);
+    }
+    for (uint32_t i = 0; valid && i < candidate->meshCount; ++i) {
+        valid = meshes[i].entity < entityCount && validAsset(meshes[i].mesh);
+    }
+    for (uint32_t i = 0; valid && i < candidate->clickableCount; ++i) {
+        valid = clickables[i].entity < entityCount;
+    }
+    for (uint32_t i = 0; valid && i < candidate->cameraCount; ++i) {
+        valid = cameras[i].entity < entityCount;
+    }
+    if (!valid) {
+        std::cerr << "ERROR::SCENEFILE: Index or string out of range." << std::endl;
+        return false;
+    }
+
+    header = candidate;
+    strings = stringData;
+    return true;
+}
+
+bool SceneSerializer::save(const Scene& scene, const std::string& path) {
+    SceneData data;
+    collectScene(scene, data);
+
+    SceneFileHeader header = {};
+    std::memcpy(header.magic, kSceneFileMagic, sizeof(kSceneFileMagic));
+    header.version = kSceneFileVersion;
+    header.assetCount = static_cast<uint32_t>(data.assets.size());
+    header.entityCount = static_cast<uint32_t>(data.entities.size());
+    header.renderCount = static_cast<uint32_t>(data.renders.size());
+    header.meshCount = static_cast<uint32_t>(data.meshes.size());
+    header.clickableCount = static_cast<uint32_t>(data.clickables.size());
+    header.cameraCount = static_cast<uint32_t>(data.cameras.size());
+    header.activeCameraEntity = data.activeCameraEntity;
+    header.stringsSize = static_cast<uint32_t>(data.strings.size());
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        std::cerr << "ERROR::SCENESERIALIZER: Could not open " << path << " for writing." << std::endl;
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    writeArray(file, data.assets);
+    writeArray(file, data.entities);
+    writeArray(file, data.renders);
+    writeArray(file, data.meshes);
+    writeArray(file, data.clickables);
+    writeArray(file, data.cameras);
+    file.write(data.strings.data(), static_cast<std::streamsize>(data.strings.size()));
+    if (!file) {
+        std::cerr << "ERROR::SCENESERIALIZER: Failed writing " << path << std::endl;
+        return false;
+    }
+
+    std::cout << "Scene '" << scene.getName() << "' saved to " << path << " (" << data.entities.size() << " objects, " << data.assets.size() << " assets)." << std::endl;
+    return true;
+}
+
+bool SceneSerializer::saveJson(const Scene& scene, const std::string& path) {
+    SceneData data;
+    collectScene(scene, data);
+
+    std::ofstream out(path, std::ios::trunc);
+    if (!out) {
+        std::cerr << "ERROR::SCENESERIALIZER: Could not open " << path << " for writing." << std::endl;
+        return false;
+    }
+
+    out << "{\n  \"version\": " << kSceneFileVersion << ",\n  \"activeCamera\": ";
+    writeJsonIndex(out, data.activeCameraEntity);
+
+    out << ",\n  \"assets\": [";
+    for (size_t i = 0; i < data.assets.size(); ++i) {
+        const SceneAssetRecord& asset = data.assets[i];
+        out << (i > 0 ? "," : "") << "\n    { ";
+        switch (static_cast<SceneAssetType>(asset.type)) {
+        case SceneAssetType::Shader:
+            out << "\"type\": \"shader\", \"vertex\": ";
+            writeJsonString(out, data.getString(asset.strings[0]));
+            out << ", \"fragment\": ";
+            writeJsonString(out, data.getString(asset.strings[1]));
+            out << ", \"geometry\": ";
+            writeJsonString(out, data.getString(asset.strings[2]));
+            break;
+        case SceneAssetType::Texture:
+            out << "\"type\": \"texture\", \"path\": ";
+            writeJsonString(out, data.getString(asset.strings[0]));
+            out << ", \"textureType\": ";
+            writeJsonString(out, data.getString(asset.strings[1]));
+            break;
+        case SceneAssetType::AtlasTexture:
+            out << "\"type\": \"atlasTexture\", \"atlas\": ";
+            writeJsonString(out, data.getString(asset.strings[0]));
+            break;
+        case SceneAssetType::Mesh:
+            out << "\"type\": \"mesh\", \"primitive\": " << asset.value << ", \"parameter\": " << asset.parameter;
+            break;
+        }
+        out << " }";
+    }
+
+    out << "\n  ],\n  \"entities\": [";
+    for (size_t i = 0; i < data.entities.size(); ++i) {
+        const SceneEntityRecord& entity = data.entities[i];
+        out << (i > 0 ? "," : "") << "\n    { \"name\": ";
+        writeJsonString(out, data.getString(entity.name));
+        out << ", \"parent\": ";
+        writeJsonIndex(out, entity.parent);
+        out << ", \"interpolated\": " << ((entity.flags & SCENE_ENTITY_INTERPOLATED) ? "true" : "false");
+        out << ", \"position\": ";
+        writeJsonFloats(out, entity.position, 3);
+        out << ", \"rotation\": ";
+        writeJsonFloats(out, entity.rotation, 4);
+        out << ", \"scale\": ";
+        writeJsonFloats(out, entity.scale, 3);
+        out << " }";
+    }
+
+    out << "\n  ],\n  \"render\": [";
+    for (size_t i = 0; i < data.renders.size(); ++i) {
+        const SceneRenderRecord& render = data.renders[i];
+        out << (i > 0 ? "," : "") << "\n    { \"entity\": " << render.entity << ", \"shader\": ";
+        writeJsonIndex(out, render.shader);
+        out << ", \"texture\": ";
+        writeJsonIndex(out, render.texture);
+        out << ", \"mesh\": ";
+        writeJsonIndex(out, render.mesh);
+        out << ", \"color\": ";
+        writeJsonFloats(out, render.color, 4);
+        out << ", \"uvRect\": ";
+        writeJsonFloats(out, render.uvRect, 4);
+        out << ", \"alphaCutoff\": " << render.alphaCutoff << " }";
+    }
+
+    out << "\n  ],\n  \"meshes\": [";
+    for (size_t i = 0; i < data.meshes.size(); ++i) {
+        out << (i > 0 ? "," : "") << "\n    { \"entity\": " << data.meshes[i].entity << ", \"mesh\": ";
+        writeJsonIndex(out, data.meshes[i].mesh);
+        out << " }";
+    }
+
+    out << "\n  ],\n  \"clickables\": [";
+    for (size_t i = 0; i < data.clickables.size(); ++i) {
+        out << (i > 0 ? "," : "") << "\n    { \"entity\": " << data.clickables[i].entity << ", \"pickingMethod\": " << data.clickables[i].pickingMethod << " }";
+    }
+
+    out << "\n  ],\n  \"cameras\": [";
+    for (size_t i = 0; i < data.cameras.size(); ++i) {
+        const SceneCameraRecord& camera = data.cameras[i];
+        out << (i > 0 ? "," : "") << "\n    { \"entity\": " << camera.entity
+            << ", \"type\": \"" << (camera.type == static_cast<uint32_t>(SceneCameraType::Camera2D) ? "2d" : "3d") << "\""
+            << ", \"near\": " << camera.nearPlane << ", \"far\": " << camera.farPlane << ", \"parameters\": ";
+        writeJsonFloats(out, camera.parameters, 5);
+        out << " }";
+    }
+    out << "\n  ]\n}\n";
+
+    return static_cast<bool>(out);
+}
+
+bool SceneSerializer::load(Scene& scene, const std::string& path) {
+    MemoryTagScope memoryScope(MemoryTag::Scene);
+    FileView file = VirtualFileSystem::getInstance().open(path);
+    SceneFileView view;
+    if (!file.isValid() || !view.parse(file.data, file.size)) {
+        std::cerr << "ERROR::SCENESERIALIZER: Could not load scene " << path << std::endl;
+        return false;
+    }
+    const SceneFileHeader& header = *view.header;
+
+    // Resolve every referenced asset once; records below only index into these.
+    AssetManager& assets = AssetManager::getInstance();
+    std::vector<std::shared_ptr<Shader>> shaders(header.assetCount);
+    std::vector<std::shared_ptr<Texture>> textures(header.assetCount);
+    std::vector<std::shared_ptr<Mesh>> meshes(header.assetCount);
+    for (uint32_t i = 0; i < header.assetCount; ++i) {
+        const SceneAssetRecord& asset = view.assets[i];
+        switch (static_cast<SceneAssetType>(asset.type)) {
+        case SceneAssetType::Shader:
+            shaders[i] = assets.getShader(view.getString(asset.strings[0]), view.getString(asset.strings[1]), view.getString(asset.strings[2]));
+            break;
+        case SceneAssetType::Texture:
+            textures[i] = assets.getTexture(view.getString(asset.strings[0]), view.getString(asset.strings[1]));
+            break;
+        case SceneAssetType::AtlasTexture:
+            if (std::shared_ptr<TextureAtlas> atlas = assets.getTextureAtlas(view.getString(asset.strings[0]))) {
+                textures[i] = atlas->getTexture();
+            }
+            break;
+        case SceneAssetType::Mesh: {
+            MeshPrimitive primitive = static_cast<MeshPrimitive>(asset.value);
+            float parameter = asset.parameter;
+            std::string key = "ScenePrimitive|" + std::to_string(asset.value) + "|" + std::to_string(parameter);
+            meshes[i] = assets.getMesh(key, [primitive, parameter]() { return createPrimitiveMesh(primitive, parameter); });
+            break;
+        }
+        default:
+            std::cerr << "WARNING: SceneSerializer: Unknown asset type " << asset.type << " in " << path << std::endl;
+            break;
+        }
+    }
+    auto assetAt = [](const auto& table, uint32_t index) {
+        return index == kSceneNoIndex ? nullptr : table[index];
+    };
+
+    std::vector<std::unique_ptr<GameObject>> owned(header.entityCount);
+    std::vector<GameObject*> objects(header.entityCount);
+    std::vector<uint32_t> childCounts(header.entityCount, 0);
+    size_t rootCount = 0;
+    for (uint32_t i = 0; i < header.entityCount; ++i) {
+        const SceneEntityRecord& record = view.entities[i];
+        owned[i] = std::make_unique<GameObject>(std::string(view.getString(record.name)));
+        objects[i] = owned[i].get();
+
+        TransformComponent* transform = objects[i]->getTransform();
+        transform->setLocalPosition(glm::vec3(record.position[0], record.position[1], record.position[2]));
+        transform->setLocalRotation(glm::quat(record.rotation[3], record.rotation[0], record.rotation[1], record.rotation[2]));
+        transform->setLocalScale(glm::vec3(record.scale[0], record.scale[1], record.scale[2]));
+        if (record.flags & SCENE_ENTITY_INTERPOLATED) {
+            transform->setInterpolationEnabled(true);
+        }
+
+        if (record.parent == kSceneNoIndex) {
+            ++rootCount;
+        }
+        else {
+            ++childCounts[record.parent];
+        }
+    }
+
+    for (uint32_t i = 0; i < header.cameraCount; ++i) {
+        const SceneCameraRecord& record = view.cameras[i];
+        GameObject* owner = objects[record.entity];
+        CameraBaseComponent* camera = nullptr;
+        if (record.type == static_cast<uint32_t>(SceneCameraType::Camera2D)) {
+            Camera2DComponent* camera2D = owner->addComponent<Camera2DComponent>(record.parameters[0], record.parameters[1], record.nearPlane, record.farPlane);
+            camera2D->setZoom(record.parameters[2]);
+            camera = camera2D;
+        }
+        else if (record.type == static_cast<uint32_t>(SceneCameraType::Camera3D)) {
+            Camera3DComponent* camera3D = owner->addComponent<Camera3DComponent>(record.parameters[0], record.parameters[1], record.nearPlane, record.farPlane);
+            camera3D->setLookAtTarget(glm::vec3(record.parameters[2], record.parameters[3], record.parameters[4]));
+            camera = camera3D;
+        }
+        if (camera && record.entity == header.activeCameraEntity) {
+            scene.setActiveCamera(camera);
+        }
+    }
+
+    for (uint32_t i = 0; i < header.meshCount; ++i) {
+        const SceneMeshRecord& record = view.meshes[i];
+        objects[record.entity]->addComponent<MeshComponent>(assetAt(meshes, record.mesh));
+    }
+
+    for (uint32_t i = 0; i < header.renderCount; ++i) {
+        const SceneRenderRecord& record = view.renders[i];
+        RenderComponent* render = objects[record.entity]->addComponent<RenderComponent>(assetAt(shaders, record.shader));
+        render->setMesh(assetAt(meshes, record.mesh));
+        render->setSprite({ assetAt(textures, record.texture), glm::vec4(record.uvRect[0], record.uvRect[1], record.uvRect[2], record.uvRect[3]) });
+        render->setObjectColor(glm::vec4(record.color[0], record.color[1], record.color[2], record.color[3]));
+        render->setAlphaCutoff(record.alphaCutoff);
+    }
+
+    for (uint32_t i = 0; i < header.clickableCount; ++i) {
+        const SceneClickableRecord& record = view.clickables[i];
+        objects[record.entity]->addComponent<ClickableComponent>(static_cast<PickingMethod>(record.pickingMethod));
+    }
+
+    // Parents come first, so every object is attached before its own children.
+    scene.reserveGameObjects(scene.getGameObjects().size() + rootCount);
+    for (uint32_t i = 0; i < header.entityCount; ++i) {
+        objects[i]->reserveChildren(childCounts[i]);
+        uint32_t parent = view.entities[i].parent;
+        if (parent == kSceneNoIndex) {
+            scene.AddGameObject(std::move(owned[i]));
+        }
+        else {
+            objects[parent]->addChild(std::move(owned[i]));
+        }
+    }
+
+    std::cout << "Scene '" << scene.getName() << "' loaded " << header.entityCount << " objects from " << path << std::endl;
+    return true;
+}
\ No newline at end of file
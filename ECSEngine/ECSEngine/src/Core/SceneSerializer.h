@@ -0,0 +1,22 @@
+#pragma once
+
+#include <string>
+
+class Scene;
+
+// Saves the objects of a scene (hierarchy, transforms, render, mesh,
+// clickable and camera components, and the assets they reference) to a
+// binary .escn file, and loads them back. Components of other types and
+// textures that do not come from a file are skipped, and so are click
+// callbacks, which the scene has to attach again after loading.
+class SceneSerializer {
+public:
+    static bool save(const Scene& scene, const std::string& path);
+    // Human-readable dump of what save() would write, for debugging.
+    static bool saveJson(const Scene& scene, const std::string& path);
+
+    // Adds the stored objects to the scene. Every referenced asset is
+    // resolved once up front, and objects are created with their child lists
+    // already sized. Reads through the VirtualFileSystem.
+    static bool load(Scene& scene, const std::string& path);
+};
\ No newline at end of file
@@ -1,77 +1,176 @@
 #include "Shader.h"
+#include "Core/ProgramBinaryCache.h"
+#include "Core/MemoryTracker.h"
+#include "Core/FrameStats.h"
+#include "Core/VirtualFileSystem.h"
+#include <algorithm>
+#include <filesystem>
 
-Shader::Shader(const std::string& vertexPath, const std::string& fragmentPath, const std::string& geometryPath) {
+Shader::Shader(const std::string& vertexPath, const std::string& fragmentPath, const std::string& geometryPath, uint32_t features)
+    : ID(0), m_vertexPath(vertexPath), m_fragmentPath(fragmentPath), m_geometryPath(geometryPath), m_features(features)
+{
+    MemoryTagScope memoryScope(MemoryTag::Shader);
     std::string vertexCode;
     std::string fragmentCode;
     std::string geometryCode;
-    std::ifstream vShaderFile;
-    std::ifstream fShaderFile;
-    std::ifstream gShaderFile;
-
-    vShaderFile.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-    fShaderFile.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-    gShaderFile.exceptions(std::ifstream::failbit | std::ifstream::badbit);
-
-    try {
-        vShaderFile.open(vertexPath);
-        fShaderFile.open(fragmentPath);
-        std::stringstream vShaderStream, fShaderStream;
-        vShaderStream << vShaderFile.rdbuf();
-        fShaderStream << fShaderFile.rdbuf();
-        vShaderFile.close();
-        fShaderFile.close();
-        vertexCode = vShaderStream.str();
-        fragmentCode = fShaderStream.str();
-        if (!geometryPath.empty()) {
-            gShaderFile.open(geometryPath);
-            std::stringstream gShaderStream;
-            gShaderStream << gShaderFile.rdbuf();
-            gShaderFile.close();
-            geometryCode = gShaderStream.str();
-        }
-    }
-    catch (std::ifstream::failure& e) {
-        std::cerr << "ERROR::SHADER::FILE_NOT_SUCCESFULLY_READ: " << e.what() << std::endl;
+    std::string defines = getFeatureDefines(features);
+
+    if (!preprocess(vertexPath, defines, vertexCode, &m_dependencies)
+        || !preprocess(fragmentPath, defines, fragmentCode, &m_dependencies)
+        || (!geometryPath.empty() && !preprocess(geometryPath, defines, geometryCode, &m_dependencies))) {
         ID = 0;
         return;
     }
+
+    const bool useBinaryCache = ProgramBinaryCache::isAvailable();
+    uint64_t cacheKey = 0;
+    if (useBinaryCache) {
+        cacheKey = ProgramBinaryCache::makeKey(vertexCode, fragmentCode, geometryCode);
+        ID = ProgramBinaryCache::load(cacheKey);
+        if (ID != 0) {
+            return;
+        }
+    }
+
     const char* vShaderCode = vertexCode.c_str();
     const char* fShaderCode = fragmentCode.c_str();
     const char* gShaderCode = geometryCode.c_str();
 
-    GLuint vertex, fragment, geometry;
+    GLuint vertex = 0, fragment = 0, geometry = 0;
+    auto deleteShaders = [&]() {
+        glDeleteShader(vertex);
+        glDeleteShader(fragment);
+        if (geometry != 0) {
+            glDeleteShader(geometry);
+        }
+    };
 
     vertex = glCreateShader(GL_VERTEX_SHADER);
     glShaderSource(vertex, 1, &vShaderCode, NULL);
     glCompileShader(vertex);
-    checkCompileErrors(vertex, "VERTEX");
+    bool compiled = checkCompileErrors(vertex, "VERTEX");
 
     fragment = glCreateShader(GL_FRAGMENT_SHADER);
     glShaderSource(fragment, 1, &fShaderCode, NULL);
     glCompileShader(fragment);
-    checkCompileErrors(fragment, "FRAGMENT");
+    compiled = checkCompileErrors(fragment, "FRAGMENT") && compiled;
 
     if (!geometryPath.empty()) {
         geometry = glCreateShader(GL_GEOMETRY_SHADER);
         glShaderSource(geometry, 1, &gShaderCode, NULL);
         glCompileShader(geometry);
-        checkCompileErrors(geometry, "GEOMETRY");
+        compiled = checkCompileErrors(geometry, "GEOMETRY") && compiled;
+    }
+
+    // Hot reload retries broken shaders, so failures must not leak GL objects.
+    if (!compiled) {
+        deleteShaders();
+        ID = 0;
+        return;
     }
 
     ID = glCreateProgram();
+    if (useBinaryCache) {
+        glProgramParameteri(ID, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+    }
     glAttachShader(ID, vertex);
     glAttachShader(ID, fragment);
     if (!geometryPath.empty()) {
         glAttachShader(ID, geometry);
     }
     glLinkProgram(ID);
-    checkLinkErrors(ID);
+    if (checkLinkErrors(ID) && useBinaryCache) {
+        ProgramBinaryCache::store(cacheKey, ID);
+    }
 
-    glDeleteShader(vertex);
-    glDeleteShader(fragment);
-    if (!geometryPath.empty()) {
-        glDeleteShader(geometry);
+    deleteShaders();
+}
+
+std::string Shader::getFeatureDefines(uint32_t features) {
+    std::string defines;
+    if (features & SHADER_FEATURE_HAS_TEXTURE) defines += "#define HAS_TEXTURE\n";
+    if (features & SHADER_FEATURE_INSTANCED) defines += "#define INSTANCED\n";
+    if (features & SHADER_FEATURE_ALPHA_TEST) defines += "#define ALPHA_TEST\n";
+    return defines;
+}
+
+bool Shader::preprocess(const std::string& path, const std::string& defines, std::string& outSource, std::vector<std::string>* outDependencies) {
+    outSource.clear();
+    std::vector<std::string> includeStack;
+    return preprocessFile(path, defines, outSource, includeStack, outDependencies);
+}
+
+bool Shader::dependsOn(const std::string& path) const {
+    return std::find(m_dependencies.begin(), m_dependencies.end(), path) != m_dependencies.end();
+}
+
+void Shader::swapProgram(Shader& other) {
+    std::swap(ID, other.ID);
+}
+
+// Expands #include "file" recursively and injects the defines right after
+// #version, which GLSL requires to come first. #line directives keep compiler
+// messages pointing at the right line of each file.
+bool Shader::preprocessFile(const std::string& path, const std::string& defines, std::string& outSource, std::vector<std::string>& includeStack, std::vector<std::string>* outDependencies) {
+    std::string normalizedPath = std::filesystem::path(path).lexically_normal().generic_string();
+    if (std::find(includeStack.begin(), includeStack.end(), normalizedPath) != includeStack.end()) {
+        std::cerr << "ERROR::SHADER::RECURSIVE_INCLUDE: " << normalizedPath << std::endl;
+        return false;
+    }
+
+    FileView file = VirtualFileSystem::getInstance().open(normalizedPath);
+    if (!file.isValid()) {
+        std::cerr << "ERROR::SHADER::FILE_NOT_SUCCESFULLY_READ: " << normalizedPath << std::endl;
+        return false;
+    }
+
+    includeStack.push_back(normalizedPath);
+    if (outDependencies && std::find(outDependencies->begin(), outDependencies->end(), normalizedPath) == outDependencies->end()) {
+        outDependencies->push_back(normalizedPath);
     }
+    const std::filesystem::path directory = std::filesystem::path(normalizedPath).parent_path();
+    const bool isRoot = includeStack.size() == 1;
+
+    const std::string_view source = file.text();
+    size_t lineStart = 0;
+    int lineNumber = 0;
+    while (lineStart < source.size()) {
+        size_t lineEnd = source.find('\n', lineStart);
+        if (lineEnd == std::string_view::npos) {
+            lineEnd = source.size();
+        }
+        const std::string_view line = source.substr(lineStart, lineEnd - lineStart);
+        lineStart = lineEnd + 1;
+        ++lineNumber;
+        size_t start = line.find_first_not_of(" \t");
+        if (start != std::string_view::npos && line.compare(start, 8, "#include") == 0) {
+            size_t open = line.find('"', start + 8);
+            size_t close = open == std::string_view::npos ? std::string_view::npos : line.find('"', open + 1);
+            if (close == std::string_view::npos) {
+                std::cerr << "ERROR::SHADER::MALFORMED_INCLUDE: " << normalizedPath << ":" << lineNumber << std::endl;
+                includeStack.pop_back();
+                return false;
+            }
+            std::string includePath = (directory / line.substr(open + 1, close - open - 1)).generic_string();
+            outSource += "#line 1\n";
+            if (!preprocessFile(includePath, defines, outSource, includeStack, outDependencies)) {
+                includeStack.pop_back();
+                return false;
+            }
+            outSource += "#line " + std::to_string(lineNumber + 1) + "\n";
+            continue;
+        }
+
+        outSource += line;
+        outSource += '\n';
+        if (isRoot && start != std::string_view::npos && line.compare(start, 8, "#version") == 0) {
+            outSource += defines;
+            outSource += "#line " + std::to_string(lineNumber + 1) + "\n";
+        }
+    }
+
+    includeStack.pop_back();
+    return true;
 }
 
 Shader::~Shader() {
@@ -83,74 +182,84 @@ Shader::~Shader() {
 
 void Shader::use() const {
     glUseProgram(ID);
+    FrameStats::getInstance().countStateChange();
 }
 
 void Shader::detach() const {
     glUseProgram(0);
 }
 
-void Shader::setBool(const std::string& name, bool value) const {
-    glUniform1i(glGetUniformLocation(ID, name.c_str()), (int)value);
+void Shader::setBool(const char* name, bool value) const {
+    glUniform1i(glGetUniformLocation(ID, name), (int)value);
+}
+
+void Shader::setInt(const char* name, int value) const {
+    glUniform1i(glGetUniformLocation(ID, name), value);
 }
 
-void Shader::setInt(const std::string& name, int value) const {
-    glUniform1i(glGetUniformLocation(ID, name.c_str()), value);
+void Shader::setUInt(const char* name, unsigned int value) const {
+    glUniform1ui(glGetUniformLocation(ID, name), value);
 }
 
-void Shader::setFloat(const std::string& name, float value) const {
-    glUniform1f(glGetUniformLocation(ID, name.c_str()), value);
+void Shader::setFloat(const char* name, float value) const {
+    glUniform1f(glGetUniformLocation(ID, name), value);
 }
 
-void Shader::setVec2(const std::string& name, const glm::vec2& value) const {
-    glUniform2fv(glGetUniformLocation(ID, name.c_str()), 1, glm::value_ptr(value));
+void Shader::setVec2(const char* name, const glm::vec2& value) const {
+    glUniform2fv(glGetUniformLocation(ID, name), 1, glm::value_ptr(value));
 }
-void Shader::setVec2(const std::string& name, float x, float y) const {
-    glUniform2f(glGetUniformLocation(ID, name.c_str()), x, y);
+void Shader::setVec2(const char* name, float x, float y) const {
+    glUniform2f(glGetUniformLocation(ID, name), x, y);
 }
 
-void Shader::setVec3(const std::string& name, const glm::vec3& value) const {
-    glUniform3fv(glGetUniformLocation(ID, name.c_str()), 1, glm::value_ptr(value));
+void Shader::setVec3(const char* name, const glm::vec3& value) const {
+    glUniform3fv(glGetUniformLocation(ID, name), 1, glm::value_ptr(value));
 }
-void Shader::setVec3(const std::string& name, float x, float y, float z) const {
-    glUniform3f(glGetUniformLocation(ID, name.c_str()), x, y, z);
+void Shader::setVec3(const char* name, float x, float y, float z) const {
+    glUniform3f(glGetUniformLocation(ID, name), x, y, z);
 }
 
-void Shader::setVec4(const std::string& name, const glm::vec4& value) const {
-    glUniform4fv(glGetUniformLocation(ID, name.c_str()), 1, glm::value_ptr(value));
+void Shader::setVec4(const char* name, const glm::vec4& value) const {
+    glUniform4fv(glGetUniformLocation(ID, name), 1, glm::value_ptr(value));
 }
-void Shader::setVec4(const std::string& name, float x, float y, float z, float w) const {
-    glUniform4f(glGetUniformLocation(ID, name.c_str()), x, y, z, w);
+void Shader::setVec4(const char* name, float x, float y, float z, float w) const {
+    glUniform4f(glGetUniformLocation(ID, name), x, y, z, w);
 }
 
-void Shader::setMat2(const std::string& name, const glm::mat2& mat) const {
-    glUniformMatrix2fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, glm::value_ptr(mat));
+void Shader::setMat2(const char* name, const glm::mat2& mat) const {
+    glUniformMatrix2fv(glGetUniformLocation(ID, name), 1, GL_FALSE, glm::value_ptr(mat));
 }
 
-void Shader::setMat3(const std::string& name, const glm::mat3& mat) const {
-    glUniformMatrix3fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, glm::value_ptr(mat));
+void Shader::setMat3(const char* name, const glm::mat3& mat) const {
+    glUniformMatrix3fv(glGetUniformLocation(ID, name), 1, GL_FALSE, glm::value_ptr(mat));
 }
 
-void Shader::setMat4(const std::string& name, const glm::mat4& mat) const {
-    glUniformMatrix4fv(glGetUniformLocation(ID, name.c_str()), 1, GL_FALSE, glm::value_ptr(mat));
+void Shader::setMat4(const char* name, const glm::mat4& mat) const {
+    glUniformMatrix4fv(glGetUniformLocation(ID, name), 1, GL_FALSE, glm::value_ptr(mat));
 }
 
-void Shader::checkCompileErrors(GLuint shader, const std::string& type) {
+bool Shader::checkCompileErrors(GLuint shader, const std::string& type) {
     GLint success;
     GLchar infoLog[1024];
     glGetShaderiv(shader, GL_COMPILE_STATUS, &success);
     if (!success) {
         glGetShaderInfoLog(shader, 1024, NULL, infoLog);
         std::cerr << "ERROR::SHADER_COMPILATION_ERROR of type: " << type << "\n" << infoLog << "\n -- --------------------------------------------------- -- " << std::endl;
+        return false;
     }
+    return true;
 }
 
-void Shader::checkLinkErrors(GLuint program) {
+bool Shader::checkLinkErrors(GLuint program) {
     GLint success;
     GLchar infoLog[1024];
     glGetProgramiv(program, GL_LINK_STATUS, &success);
     if (!success) {
         glGetProgramInfoLog(program, 1024, NULL, infoLog);
         std::cerr << "ERROR::PROGRAM_LINKING_ERROR of type: PROGRAM\n" << infoLog << "\n -- --------------------------------------------------- -- " << std::endl;
+        glDeleteProgram(program);
         ID = 0;
+        return false;
     }
+    return true;
 }
\ No newline at end of file
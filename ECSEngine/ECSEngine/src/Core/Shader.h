@@ -5,38 +5,74 @@
 #include <sstream>
 #include <iostream>
 #include <GL/glew.h>
+#include <cstdint>
+#include <vector>
 
 #include <glm/glm.hpp>                  
 #include <glm/gtc/matrix_transform.hpp>
 #include <glm/gtc/type_ptr.hpp>
 
+// Compile-time permutation keys. Each set bit becomes a #define injected after
+// the #version line, so one source file yields specialized programs.
+enum ShaderFeature : uint32_t {
+    SHADER_FEATURE_NONE = 0,
+    SHADER_FEATURE_HAS_TEXTURE = 1 << 0,
+    SHADER_FEATURE_INSTANCED = 1 << 1,
+    SHADER_FEATURE_ALPHA_TEST = 1 << 2,
+};
 
 class Shader {
 public:
     GLuint ID;
 
-    Shader(const std::string& vertexPath, const std::string& fragmentPath, const std::string& geometryPath = "");
+    // Sources may #include "file" relative to the including file.
+    Shader(const std::string& vertexPath, const std::string& fragmentPath, const std::string& geometryPath = "", uint32_t features = SHADER_FEATURE_NONE);
     ~Shader();
 
     void use() const;
     void detach() const;
 
-    void setBool(const std::string& name, bool value) const;
-    void setInt(const std::string& name, int value) const;
-    void setFloat(const std::string& name, float value) const;
-    void setVec2(const std::string& name, const glm::vec2& value) const;
-    void setVec2(const std::string& name, float x, float y) const;
-    void setVec3(const std::string& name, const glm::vec3& value) const;
-    void setVec3(const std::string& name, float x, float y, float z) const;
-    void setVec4(const std::string& name, const glm::vec4& value) const;
-    void setVec4(const std::string& name, float x, float y, float z, float w) const;
-    void setMat2(const std::string& name, const glm::mat2& mat) const;
-    void setMat3(const std::string& name, const glm::mat3& mat) const;
-    void setMat4(const std::string& name, const glm::mat4& mat) const;
+    // Uniform names are C strings so that setting a uniform never builds a
+    // temporary std::string.
+    void setBool(const char* name, bool value) const;
+    void setInt(const char* name, int value) const;
+    void setUInt(const char* name, unsigned int value) const;
+    void setFloat(const char* name, float value) const;
+    void setVec2(const char* name, const glm::vec2& value) const;
+    void setVec2(const char* name, float x, float y) const;
+    void setVec3(const char* name, const glm::vec3& value) const;
+    void setVec3(const char* name, float x, float y, float z) const;
+    void setVec4(const char* name, const glm::vec4& value) const;
+    void setVec4(const char* name, float x, float y, float z, float w) const;
+    void setMat2(const char* name, const glm::mat2& mat) const;
+    void setMat3(const char* name, const glm::mat3& mat) const;
+    void setMat4(const char* name, const glm::mat4& mat) const;
 
     GLuint getID() const { return ID; }
+    uint32_t getFeatures() const { return m_features; }
+    const std::string& getVertexPath() const { return m_vertexPath; }
+    const std::string& getFragmentPath() const { return m_fragmentPath; }
+    const std::string& getGeometryPath() const { return m_geometryPath; }
+
+    // Every file the program was built from, includes included.
+    const std::vector<std::string>& getDependencies() const { return m_dependencies; }
+    bool dependsOn(const std::string& path) const;
+    // Takes over other's GL program and hands this one's to other, so every
+    // holder of this Shader picks up the new program.
+    void swapProgram(Shader& other);
+
+    static std::string getFeatureDefines(uint32_t features);
+    static bool preprocess(const std::string& path, const std::string& defines, std::string& outSource, std::vector<std::string>* outDependencies = nullptr);
 
 private:
-    void checkCompileErrors(GLuint shader, const std::string& type);
-    void checkLinkErrors(GLuint program);
+    std::string m_vertexPath;
+    std::string m_fragmentPath;
+    std::string m_geometryPath;
+    uint32_t m_features;
+    std::vector<std::string> m_dependencies;
+
+    static bool preprocessFile(const std::string& path, const std::string& defines, std::string& outSource, std::vector<std::string>& includeStack, std::vector<std::string>* outDependencies);
+
+    bool checkCompileErrors(GLuint shader, const std::string& type);
+    bool checkLinkErrors(GLuint program);
 };
\ No newline at end of file
@@ -0,0 +1,60 @@
+#include "Core/ShelfPacker.h"
+#include <algorithm>
+#include <cstdint>
+
+bool ShelfPacker::pack(std::vector<ShelfRect*>& rects, unsigned int maxSize, unsigned int padding, unsigned int& outWidth, unsigned int& outHeight) {
+    uint64_t area = 0;
+    for (const ShelfRect* rect : rects) {
+        area += static_cast<uint64_t>(rect->width + 2 * padding) * (rect->height + 2 * padding);
+    }
+    std::sort(rects.begin(), rects.end(), [](const ShelfRect* a, const ShelfRect* b) {
+        return a->height != b->height ? a->height > b->height : a->width > b->width;
+    });
+
+    // Start at the smallest power of two that could hold the total area and
+    // grow one side at a time until the shelves fit.
+    unsigned int width = std::min(64u, maxSize);
+    unsigned int height = width;
+    while (static_cast<uint64_t>(width) * height < area) {
+        if (width <= height) width *= 2; else height *= 2;
+        if (width > maxSize || height > maxSize) {
+            return false;
+        }
+    }
+    while (!packShelves(rects, width, height, padding)) {
+        if (width <= height) width *= 2; else height *= 2;
+        if (width > maxSize || height > maxSize) {
+            return false;
+        }
+    }
+    outWidth = width;
+    outHeight = height;
+    return true;
+}
+
+bool ShelfPacker::packShelves(std::vector<ShelfRect*>& rects, unsigned int width, unsigned int height, unsigned int padding) {
+    unsigned int shelfX = 0;
+    unsigned int shelfY = 0;
+    unsigned int shelfHeight = 0;
+
+    for (ShelfRect* rect : rects) {
+        unsigned int paddedWidth = rect->width + 2 * padding;
+        unsigned int paddedHeight = rect->height + 2 * padding;
+        if (paddedWidth > width) {
+            return false;
+        }
+        if (shelfX + paddedWidth > width) {
+            shelfY += shelfHeight;
+            shelfX = 0;
+            shelfHeight = 0;
+        }
+        if (shelfY + paddedHeight > height) {
+            return false;
+        }
+        rect->x = shelfX + padding;
+        rect->y = shelfY + padding;
+        shelfX += paddedWidth;
+        shelfHeight = std::max(shelfHeight, paddedHeight);
+    }
+    return true;
+}
\ No newline at end of file
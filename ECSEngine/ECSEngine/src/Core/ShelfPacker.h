@@ -0,0 +1,24 @@
+#pragma once
+
+#include <vector>
+
+// A rectangle to place; x and y are its top-left corner inside the padding.
+struct ShelfRect {
+    int width = 0;
+    int height = 0;
+    unsigned int x = 0;
+    unsigned int y = 0;
+};
+
+// Shelf packing for TextureAtlas. It has no GL dependency so the sizing can
+// be tested headless.
+class ShelfPacker {
+public:
+    // Sorts rects tallest first and places them in the smallest power-of-two
+    // area, at most maxSize on either side, that holds them with padding on
+    // every side. Returns false if they don't fit.
+    static bool pack(std::vector<ShelfRect*>& rects, unsigned int maxSize, unsigned int padding, unsigned int& outWidth, unsigned int& outHeight);
+
+private:
+    static bool packShelves(std::vector<ShelfRect*>& rects, unsigned int width, unsigned int height, unsigned int padding);
+};
\ No newline at end of file
@@ -0,0 +1,131 @@
+#include "Core/SpatialHashGrid2D.h"
+#include <algorithm>
+#include <cmath>
+
+SpatialHashGrid2D::SpatialHashGrid2D(float cellSize, int maxCellsPerEntry)
+    : m_cellSize(cellSize), m_invCellSize(1.0f / cellSize), m_maxCellsPerEntry(maxCellsPerEntry)
+{
+}
+
+glm::ivec2 SpatialHashGrid2D::cellOf(const glm::vec2& point) const {
+    return glm::ivec2(static_cast<int>(std::floor(point.x * m_invCellSize)),
+        static_cast<int>(std::floor(point.y * m_invCellSize)));
+}
+
+uint64_t SpatialHashGrid2D::cellKey(int x, int y) {
+    return (static_cast<uint64_t>(static_cast<uint32_t>(x)) << 32) | static_cast<uint32_t>(y);
+}
+
+SpatialHashGrid2D::CellRange SpatialHashGrid2D::computeRange(const glm::vec2& min, const glm::vec2& max) const {
+    CellRange range;
+    range.min = cellOf(min);
+    range.max = cellOf(max);
+    long long cellCount = static_cast<long long>(range.max.x - range.min.x + 1) * (range.max.y - range.min.y + 1);
+    range.overflow = cellCount > m_maxCellsPerEntry;
+    return range;
+}
+
+void SpatialHashGrid2D::addToCells(int id, const CellRange& range) {
+    if (range.overflow) {
+        m_overflow.push_back(id);
+        return;
+    }
+    for (int x = range.min.x; x <= range.max.x; ++x) {
+        for (int y = range.min.y; y <= range.max.y; ++y) {
+            m_cells[cellKey(x, y)].push_back(id);
+        }
+    }
+}
+
+void SpatialHashGrid2D::removeFromCells(int id, const CellRange& range) {
+    if (range.overflow) {
+        m_overflow.erase(std::remove(m_overflow.begin(), m_overflow.end(), id), m_overflow.end());
+        return;
+    }
+    for (int x = range.min.x; x <= range.max.x; ++x) {
+        for (int y = range.min.y; y <= range.max.y; ++y) {
+            auto it = m_cells.find(cellKey(x, y));
+            if (it == m_cells.end()) continue;
+
+            std::vector<int>& ids = it->second;
+            auto found = std::find(ids.begin(), ids.end(), id);
+            if (found != ids.end()) {
+                *found = ids.back();
+                ids.pop_back();
+            }
+            if (ids.empty()) {
+                m_cells.erase(it);
+            }
+        }
+    }
+}
+
+void SpatialHashGrid2D::insert(int id, const glm::vec2& min, const glm::vec2& max) {
+    if (m_entries.count(id)) {
+        update(id, min, max);
+        return;
+    }
+    CellRange range = computeRange(min, max);
+    addToCells(id, range);
+    m_entries[id] = range;
+    m_bounds[id] = { min, max };
+}
+
+void SpatialHashGrid2D::update(int id, const glm::vec2& min, const glm::vec2& max) {
+    auto it = m_entries.find(id);
+    if (it == m_entries.end()) {
+        insert(id, min, max);
+        return;
+    }
+
+    m_bounds[id] = { min, max };
+    CellRange range = computeRange(min, max);
+    if (range.min == it->second.min && range.max == it->second.max && range.overflow == it->second.overflow) {
+        return;
+    }
+    removeFromCells(id, it->second);
+    addToCells(id, range);
+    it->second = range;
+}
+
+void SpatialHashGrid2D::remove(int id) {
+    auto it = m_entries.find(id);
+    if (it == m_entries.end()) {
+        return;
+    }
+    removeFromCells(id, it->second);
+    m_entries.erase(it);
+    m_bounds.erase(id);
+}
+
+void SpatialHashGrid2D::clear() {
+    m_cells.clear();
+    m_entries.clear();
+    m_bounds.clear();
+    m_overflow.clear();
+}
+
+void SpatialHashGrid2D::setCellSize(float cellSize) {
+    if (cellSize <= 0.0f || cellSize == m_cellSize) {
+        return;
+    }
+    m_cellSize = cellSize;
+    m_invCellSize = 1.0f / cellSize;
+
+    m_cells.clear();
+    m_overflow.clear();
+    for (auto& entry : m_entries) {
+        const auto& bounds = m_bounds[entry.first];
+        entry.second = computeRange(bounds.first, bounds.second);
+        addToCells(entry.first, entry.second);
+    }
+}
+
+void SpatialHashGrid2D::queryPoint(const glm::vec2& point, std::vector<int>& outCandidates) const {
+    glm::ivec2 cell = cellOf(point);
+    auto it = m_cells.find(cellKey(cell.x, cell.y));
+    if (it != m_cells.end()) {
+        outCandidates.insert(outCandidates.end(), it->second.begin(), it->second.end());
+    }
+    outCandidates.insert(outCandidates.end(), m_overflow.begin(), m_overflow.end());
+}
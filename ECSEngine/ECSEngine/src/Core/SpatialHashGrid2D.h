@@ -0,0 +1,48 @@
+#pragma once
+
+#include <glm/glm.hpp>
+#include <unordered_map>
+#include <vector>
+#include <cstdint>
+
+// Uniform grid over world-space rectangles, hashed by cell so the covered area
+// is unbounded. Rectangles that would span too many cells go to an overflow
+// list that is always tested.
+class SpatialHashGrid2D {
+public:
+    SpatialHashGrid2D(float cellSize = 64.0f, int maxCellsPerEntry = 64);
+
+    void insert(int id, const glm::vec2& min, const glm::vec2& max);
+    void update(int id, const glm::vec2& min, const glm::vec2& max);
+    void remove(int id);
+    void clear();
+
+    void setCellSize(float cellSize);
+    float getCellSize() const { return m_cellSize; }
+
+    // Appends the ids of all entries whose cells contain the point. Callers
+    // still run their own exact test against the candidates.
+    void queryPoint(const glm::vec2& point, std::vector<int>& outCandidates) const;
+
+private:
+    struct CellRange {
+        glm::ivec2 min;
+        glm::ivec2 max;
+        bool overflow;
+    };
+
+    float m_cellSize;
+    float m_invCellSize;
+    int m_maxCellsPerEntry;
+
+    std::unordered_map<uint64_t, std::vector<int>> m_cells;
+    std::unordered_map<int, CellRange> m_entries;
+    std::unordered_map<int, std::pair<glm::vec2, glm::vec2>> m_bounds;
+    std::vector<int> m_overflow;
+
+    glm::ivec2 cellOf(const glm::vec2& point) const;
+    static uint64_t cellKey(int x, int y);
+    CellRange computeRange(const glm::vec2& min, const glm::vec2& max) const;
+    void addToCells(int id, const CellRange& range);
+    void removeFromCells(int id, const CellRange& range);
+};
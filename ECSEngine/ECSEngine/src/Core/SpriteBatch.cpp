@@ -0,0 +1,151 @@
+#include "Core/SpriteBatch.h"
+#include "Core/AssetManager.h"
+#include "Core/FrameStats.h"
+#include "Core/MemoryTracker.h"
+#include "Core/Mesh.h"
+#include "Core/Shader.h"
+#include "Core/Texture.h"
+#include <cstddef>
+#include <iostream>
+
+SpriteBatch& SpriteBatch::getInstance() {
+    static SpriteBatch instance;
+    return instance;
+}
+
+SpriteBatch::SpriteBatch()
+    : m_instanceVBO(0), m_instanceCapacity(0), m_view(1.0f), m_projection(1.0f),
+    m_runShader(nullptr), m_runTexture(nullptr), m_runAlphaCutoff(0.0f),
+    m_lastBaseShader(nullptr), m_lastFeatures(SHADER_FEATURE_NONE)
+{
+}
+
+SpriteBatch::~SpriteBatch() {
+}
+
+void SpriteBatch::Shutdown() {
+    m_instances.clear();
+    m_runShader = nullptr;
+    m_lastBaseShader = nullptr;
+    m_lastVariant = nullptr;
+    if (m_instanceVBO != 0) {
+        glDeleteBuffers(1, &m_instanceVBO);
+        m_instanceVBO = 0;
+        MemoryTracker::getInstance().recordFree(MemoryDomain::Gpu, MemoryTag::Renderer, m_instanceCapacity * sizeof(Instance));
+        m_instanceCapacity = 0;
+    }
+    m_quad = nullptr;
+}
+
+bool SpriteBatch::createBuffers() {
+    m_quad = std::make_unique<Mesh>("Sprite Batch Quad");
+    m_quad->generateQuad2D();
+    if (m_quad->getVertexArray() == 0) {
+        std::cerr << "ERROR::SPRITEBATCH: Could not create the quad mesh." << std::endl;
+        m_quad = nullptr;
+        return false;
+    }
+
+    m_instanceCapacity = kInitialCapacity;
+    m_instances.reserve(m_instanceCapacity);
+    glGenBuffers(1, &m_instanceVBO);
+    glBindVertexArray(m_quad->getVertexArray());
+    glBindBuffer(GL_ARRAY_BUFFER, m_instanceVBO);
+    glBufferData(GL_ARRAY_BUFFER, m_instanceCapacity * sizeof(Instance), nullptr, GL_STREAM_DRAW);
+    MemoryTracker::getInstance().recordAllocation(MemoryDomain::Gpu, MemoryTag::Renderer, m_instanceCapacity * sizeof(Instance));
+
+    for (GLuint column = 0; column < 4; ++column) {
+        glEnableVertexAttribArray(3 + column);
+        glVertexAttribPointer(3 + column, 4, GL_FLOAT, GL_FALSE, sizeof(Instance), (void*)(offsetof(Instance, model) + column * sizeof(glm::vec4)));
+        glVertexAttribDivisor(3 + column, 1);
+    }
+    glEnableVertexAttribArray(7);
+    glVertexAttribPointer(7, 4, GL_FLOAT, GL_FALSE, sizeof(Instance), (void*)offsetof(Instance, uvRect));
+    glVertexAttribDivisor(7, 1);
+    glEnableVertexAttribArray(8);
+    glVertexAttribPointer(8, 4, GL_FLOAT, GL_FALSE, sizeof(Instance), (void*)offsetof(Instance, color));
+    glVertexAttribDivisor(8, 1);
+
+    glBindVertexArray(0);
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+    return true;
+}
+
+void SpriteBatch::setCamera(const glm::mat4& view, const glm::mat4& projection) {
+    if (view != m_view || projection != m_projection) {
+        flush();
+        m_view = view;
+        m_projection = projection;
+    }
+}
+
+bool SpriteBatch::add(const std::shared_ptr<Shader>& shader, uint32_t shaderFeatures, const Mesh* mesh, const Texture* texture,
+    const glm::mat4& model, const glm::vec4& color, const glm::vec4& uvRect, float alphaCutoff) {
+    if (!shader || !mesh || mesh->getPrimitive() != MeshPrimitive::Quad2D) {
+        return false;
+    }
+
+    if (shader.get() != m_lastBaseShader || shaderFeatures != m_lastFeatures || !m_lastVariant) {
+        m_lastVariant = AssetManager::getInstance().getShaderVariant(shader, shaderFeatures | SHADER_FEATURE_INSTANCED);
+        m_lastBaseShader = shader.get();
+        m_lastFeatures = shaderFeatures;
+    }
+    // getShaderVariant falls back to the base shader when the variant fails to build.
+    if (!m_lastVariant || !(m_lastVariant->getFeatures() & SHADER_FEATURE_INSTANCED)) {
+        return false;
+    }
+    if (!m_quad && !createBuffers()) {
+        return false;
+    }
+
+    if (m_lastVariant.get() != m_runShader || texture != m_runTexture || alphaCutoff != m_runAlphaCutoff) {
+        flush();
+        m_runShader = m_lastVariant.get();
+        m_runTexture = texture;
+        m_runAlphaCutoff = alphaCutoff;
+    }
+    m_instances.push_back({ model, uvRect, color });
+    return true;
+}
+
+bool SpriteBatch::flush() {
+    if (m_instances.empty()) {
+        return false;
+    }
+
+    m_runShader->use();
+    m_runShader->setMat4("view", m_view);
+    m_runShader->setMat4("projection", m_projection);
+    m_runShader->setInt("texture_diffuse1", 0);
+    if (m_runShader->getFeatures() & SHADER_FEATURE_ALPHA_TEST) {
+        m_runShader->setFloat("alphaCutoff", m_runAlphaCutoff);
+    }
+    if (m_runTexture) {
+        m_runTexture->bind();
+    }
+    else {
+        glActiveTexture(GL_TEXTURE0);
+        glBindTexture(GL_TEXTURE_2D, 0);
+    }
+
+    // Orphan the buffer each flush so the driver never waits on the
+    // previous draw still reading it.
+    glBindBuffer(GL_ARRAY_BUFFER, m_instanceVBO);
+    if (m_instances.size() > m_instanceCapacity) {
+        MemoryTracker::getInstance().recordFree(MemoryDomain::Gpu, MemoryTag::Renderer, m_instanceCapacity * sizeof(Instance));
+        m_instanceCapacity = m_instances.capacity();
+        MemoryTracker::getInstance().recordAllocation(MemoryDomain::Gpu, MemoryTag::Renderer, m_instanceCapacity * sizeof(Instance));
+    }
+    glBufferData(GL_ARRAY_BUFFER, m_instanceCapacity * sizeof(Instance), nullptr, GL_STREAM_DRAW);
+    glBufferSubData(GL_ARRAY_BUFFER, 0, m_instances.size() * sizeof(Instance), m_instances.data());
+    glBindBuffer(GL_ARRAY_BUFFER, 0);
+
+    glBindVertexArray(m_quad->getVertexArray());
+    glDrawElementsInstanced(GL_TRIANGLES, static_cast<GLsizei>(m_quad->getIndexCount()), GL_UNSIGNED_INT, 0, static_cast<GLsizei>(m_instances.size()));
+    glBindVertexArray(0);
+    FrameStats::getInstance().countDrawCall(m_quad->getIndexCount() / 3 * m_instances.size());
+
+    m_runShader->detach();
+    m_instances.clear();
+    return true;
+}
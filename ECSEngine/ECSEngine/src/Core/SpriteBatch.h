@@ -0,0 +1,75 @@
+#pragma once
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <memory>
+#include <vector>
+
+#include "Core/RenderSnapshot.h"
+
+class Mesh;
+class Shader;
+class Texture;
+
+// Draws runs of 2D quads that share a shader variant, texture and alpha
+// cutoff with one instanced call. The model matrix, colour and uvRect of
+// each sprite go into a shared instance buffer, so sprites packed into one
+// atlas cost a single bind and draw. A sprite that can't join the current
+// run flushes it first, which keeps the painter's order intact.
+class SpriteBatch {
+public:
+    static SpriteBatch& getInstance();
+
+    // Flushes pending sprites if the camera changed.
+    void setCamera(const glm::mat4& view, const glm::mat4& projection);
+
+    // Queues a quad. Returns false if it can't be instanced (not a Quad2D
+    // mesh, or its shader has no INSTANCED variant); flush() before drawing
+    // it the usual way.
+    bool add(const std::shared_ptr<Shader>& shader, uint32_t shaderFeatures, const Mesh* mesh, const Texture* texture,
+        const glm::mat4& model, const glm::vec4& color, const glm::vec4& uvRect, float alphaCutoff);
+    bool add(const DrawPacket& packet) {
+        return add(packet.shader, packet.shaderFeatures, packet.mesh.get(), packet.texture.get(), packet.model, packet.color, packet.uvRect, packet.alphaCutoff);
+    }
+
+    // Draws the pending run. Returns true if anything was drawn; the bound
+    // program and texture are then unknown to the caller.
+    bool flush();
+
+    void Shutdown();
+
+private:
+    static constexpr size_t kInitialCapacity = 256;
+
+    // Matches the per-instance attributes of basic.vert (locations 3 to 8).
+    struct Instance {
+        glm::mat4 model;
+        glm::vec4 uvRect;
+        glm::vec4 color;
+    };
+
+    SpriteBatch();
+    ~SpriteBatch();
+    SpriteBatch(const SpriteBatch&) = delete;
+    SpriteBatch& operator=(const SpriteBatch&) = delete;
+
+    std::vector<Instance> m_instances;
+    std::unique_ptr<Mesh> m_quad;
+    GLuint m_instanceVBO;
+    size_t m_instanceCapacity;
+
+    glm::mat4 m_view;
+    glm::mat4 m_projection;
+
+    // The run being collected.
+    Shader* m_runShader;
+    const Texture* m_runTexture;
+    float m_runAlphaCutoff;
+
+    // Consecutive sprites usually ask for the same variant; skip the lookup.
+    const Shader* m_lastBaseShader;
+    uint32_t m_lastFeatures;
+    std::shared_ptr<Shader> m_lastVariant;
+
+    bool createBuffers();
+};
@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstddef>
+
+// Transition table for a finite state machine, meant to be built in a
+// constexpr initializer. State and Event are enums ending in Count. Every
+// (state, event) pair has an entry, so dispatch is one indexed lookup; pairs
+// that were never set keep the state and do nothing. Actions and hooks are
+// plain functions taking the Context the machine drives.
+//
+//   static constexpr StateTable<Door, DoorEvent, Scene> kDoorTable = [] {
+//       StateTable<Door, DoorEvent, Scene> table;
+//       table.on(Door::Closed, DoorEvent::Toggle, Door::Open, &playCreak);
+//       table.on(Door::Open, DoorEvent::Toggle, Door::Closed);
+//       table.onEnter(Door::Open, &showInterior);
+//       return table;
+//   }();
+template <typename State, typename Event, typename Context>
+class StateTable {
+public:
+    using Action = void (*)(Context&);
+
+    static constexpr size_t kStateCount = static_cast<size_t>(State::Count);
+    static constexpr size_t kEventCount = static_cast<size_t>(Event::Count);
+
+    struct Transition {
+        State next;
+        Action action;
+    };
+
+    constexpr StateTable() : m_transitions(), m_enterHooks(), m_exitHooks() {
+        for (size_t state = 0; state < kStateCount; ++state) {
+            for (size_t event = 0; event < kEventCount; ++event) {
+                m_transitions[state][event] = { static_cast<State>(state), &ignore };
+            }
+            m_enterHooks[state] = &ignore;
+            m_exitHooks[state] = &ignore;
+        }
+    }
+
+    constexpr StateTable& on(State from, Event event, State to, Action action = &ignore) {
+        m_transitions[index(from)][index(event)] = { to, action };
+        return *this;
+    }
+
+    // Sets the transition for event from every state.
+    constexpr StateTable& onAnyState(Event event, State to, Action action = &ignore) {
+        for (size_t state = 0; state < kStateCount; ++state) {
+            m_transitions[state][index(event)] = { to, action };
+        }
+        return *this;
+    }
+
+    constexpr StateTable& onEnter(State state, Action hook) {
+        m_enterHooks[index(state)] = hook;
+        return *this;
+    }
+
+    constexpr StateTable& onExit(State state, Action hook) {
+        m_exitHooks[index(state)] = hook;
+        return *this;
+    }
+
+    constexpr const Transition& find(State from, Event event) const {
+        return m_transitions[index(from)][index(event)];
+    }
+
+    // Runs the transition for event: the exit hook of the old state, the
+    // action, then the enter hook of the new one. Hooks only run when the
+    // state actually changes; the action always runs. Returns whether the
+    // state changed.
+    bool dispatch(State& state, Event event, Context& context) const {
+        const Transition& transition = find(state, event);
+        const bool changed = transition.next != state;
+        if (changed) {
+            m_exitHooks[index(state)](context);
+        }
+        transition.action(context);
+        if (changed) {
+            state = transition.next;
+            m_enterHooks[index(state)](context);
+        }
+        return changed;
+    }
+
+    // Runs the enter hook of the initial state.
+    void enter(State state, Context& context) const {
+        m_enterHooks[index(state)](context);
+    }
+
+    // Advances many machines at once without actions or hooks. The loop is
+    // a table lookup per element with no branches on the state.
+    void stepAll(State* states, const Event* events, size_t count) const {
+        for (size_t i = 0; i < count; ++i) {
+            states[i] = m_transitions[index(states[i])][index(events[i])].next;
+        }
+    }
+
+private:
+    Transition m_transitions[kStateCount][kEventCount];
+    Action m_enterHooks[kStateCount];
+    Action m_exitHooks[kStateCount];
+
+    static void ignore(Context&) {}
+
+    template <typename Enum>
+    static constexpr size_t index(Enum value) { return static_cast<size_t>(value); }
+};
+
+// A current state bound to a table; small enough to embed in a component or
+// keep one per entity.
+template <typename State, typename Event, typename Context>
+class StateMachine {
+public:
+    using Table = StateTable<State, Event, Context>;
+
+    constexpr StateMachine(const Table& table, State initialState) : m_table(&table), m_state(initialState) {}
+
+    void enter(Context& context) const { m_table->enter(m_state, context); }
+    bool dispatch(Event event, Context& context) { return m_table->dispatch(m_state, event, context); }
+
+    State getState() const { return m_state; }
+
+private:
+    const Table* m_table;
+    State m_state;
+};
\ No newline at end of file
@@ -1,29 +1,77 @@
-#define _CRT_SECURE_NO_WARNINGS
-
 #include "Texture.h"
+#include "Core/VirtualFileSystem.h"
+#include "Core/MemoryTracker.h"
+#include "Core/FrameStats.h"
 #include "stb_image.h"
-#include <cstdio>
 
 #include <filesystem>
 
 Texture::Texture(const std::string& path, const std::string& type)
-    : m_textureID(0), m_type(type), m_path(path), m_width(0), m_height(0)
+    : m_textureID(0), m_type(type), m_path(path), m_width(0), m_height(0), m_ownsTexture(true), m_isLoaded(false), m_loadFailed(false), m_byteSize(0)
 {
+    MemoryTagScope memoryScope(MemoryTag::Texture);
     loadTexture(path);
+    m_isLoaded = m_textureID != 0;
+    trackAllocation();
     if (m_textureID != 0) {
         std::cout << "Texture loaded: " << m_path << " (Type: " << m_type << ", ID: " << m_textureID << ", Dims: " << m_width << "x" << m_height << ")" << std::endl;
     }
 }
 
-Texture::Texture(GLuint id, const std::string& name, GLuint width, GLuint height, const std::string& type)
-    : m_textureID(id), m_type(type), m_path(name), m_width(width), m_height(height)
+Texture::Texture(GLuint id, const std::string& name, GLuint width, GLuint height, const std::string& type, size_t byteSize)
+    : m_textureID(id), m_type(type), m_path(name), m_width(width), m_height(height), m_ownsTexture(true), m_isLoaded(id != 0), m_loadFailed(false),
+    m_byteSize(byteSize != 0 ? byteSize : estimateByteSize(width, height, 4, false))
 {
+    trackAllocation();
     std::cout << "Texture wrapped: " << m_path << " (Type: " << m_type << ", ID: " << m_textureID << ", Dims: " << m_width << "x" << m_height << ")" << std::endl;
 }
 
+Texture::Texture(const std::string& path, const std::string& type, const Texture& placeholder)
+    : m_textureID(placeholder.m_textureID), m_type(type), m_path(path),
+    m_width(placeholder.m_width), m_height(placeholder.m_height), m_ownsTexture(false), m_isLoaded(false), m_loadFailed(false), m_byteSize(0)
+{
+}
+
+void Texture::finishLoading(GLuint id, GLuint width, GLuint height, size_t byteSize) {
+    if (m_ownsTexture && m_textureID != 0) {
+        glDeleteTextures(1, &m_textureID);
+        trackFree();
+    }
+    m_textureID = id;
+    m_width = width;
+    m_height = height;
+    m_ownsTexture = true;
+    m_isLoaded = true;
+    m_loadFailed = false;
+    m_byteSize = byteSize;
+    trackAllocation();
+    std::cout << "Texture loaded: " << m_path << " (Type: " << m_type << ", ID: " << m_textureID << ", Dims: " << m_width << "x" << m_height << ")" << std::endl;
+}
+
+void Texture::resizeStorage(GLuint width, GLuint height, size_t byteSize) {
+    if (!m_ownsTexture || m_textureID == 0) {
+        return;
+    }
+    trackFree();
+    m_width = width;
+    m_height = height;
+    m_byteSize = byteSize;
+    trackAllocation();
+}
+
+bool Texture::reload() {
+    Texture fresh(m_path, m_type);
+    if (fresh.m_textureID == 0) {
+        return false;
+    }
+    *this = std::move(fresh);
+    return true;
+}
+
 Texture::Texture(Texture&& other) noexcept
     : m_textureID(other.m_textureID), m_type(std::move(other.m_type)),
-    m_path(std::move(other.m_path)), m_width(other.m_width), m_height(other.m_height)
+    m_path(std::move(other.m_path)), m_width(other.m_width), m_height(other.m_height),
+    m_ownsTexture(other.m_ownsTexture), m_isLoaded(other.m_isLoaded), m_loadFailed(other.m_loadFailed), m_byteSize(other.m_byteSize)
 {
     other.m_textureID = 0;
     other.m_width = 0;
@@ -34,8 +82,9 @@ Texture::Texture(Texture&& other) noexcept
 
 Texture& Texture::operator=(Texture&& other) noexcept {
     if (this != &other) {
-        if (m_textureID != 0) {
+        if (m_ownsTexture && m_textureID != 0) {
             glDeleteTextures(1, &m_textureID);
+            trackFree();
         }
 
         m_textureID = other.m_textureID;
@@ -43,6 +92,10 @@ Texture& Texture::operator=(Texture&& other) noexcept {
         m_path = std::move(other.m_path);
         m_width = other.m_width;
         m_height = other.m_height;
+        m_ownsTexture = other.m_ownsTexture;
+        m_isLoaded = other.m_isLoaded;
+        m_loadFailed = other.m_loadFailed;
+        m_byteSize = other.m_byteSize;
 
         other.m_textureID = 0;
         other.m_width = 0;
@@ -53,8 +106,12 @@ Texture& Texture::operator=(Texture&& other) noexcept {
 }
 
 Texture::~Texture() {
+    if (!m_ownsTexture) {
+        return;
+    }
     if (m_textureID != 0) {
         glDeleteTextures(1, &m_textureID);
+        trackFree();
                if (!m_path.empty()) {
             std::cout << "Texture destroyed: " << m_path << " (ID: " << m_textureID << ")" << std::endl;
         }
@@ -67,16 +124,149 @@ Texture::~Texture() {
     }
 }
 
+void Texture::trackAllocation() const {
+    if (m_ownsTexture && m_textureID != 0) {
+        MemoryTracker::getInstance().recordAllocation(MemoryDomain::Gpu, MemoryTag::Texture, m_byteSize);
+    }
+}
+
+void Texture::trackFree() const {
+    MemoryTracker::getInstance().recordFree(MemoryDomain::Gpu, MemoryTag::Texture, m_byteSize);
+}
+
 void Texture::bind(GLuint unit) const {
     glActiveTexture(GL_TEXTURE0 + unit);
     glBindTexture(GL_TEXTURE_2D, m_textureID);
+    FrameStats::getInstance().countStateChange();
 }
 
 void Texture::unbind() const {
     glBindTexture(GL_TEXTURE_2D, 0);
 }
 
+void Texture::getFormatForChannels(int channels, GLenum& outFormat, GLint& outInternalFormat) {
+    outFormat = GL_RGB;
+    if (channels == 1)
+        outFormat = GL_RED;
+    else if (channels == 3)
+        outFormat = GL_RGB;
+    else if (channels == 4)
+        outFormat = GL_RGBA;
+
+    outInternalFormat = GL_RGB8;
+    if (outFormat == GL_RED) outInternalFormat = GL_R8;
+    else if (outFormat == GL_RGBA) outInternalFormat = GL_RGBA8;
+}
+
+// Allocates level 0 without data so it can be filled in pieces with glTexSubImage2D.
+GLuint Texture::createStorage(GLuint width, GLuint height, int channels) {
+    GLenum format;
+    GLint internalFormat;
+    getFormatForChannels(channels, format, internalFormat);
+
+    GLuint id = 0;
+    glGenTextures(1, &id);
+    glBindTexture(GL_TEXTURE_2D, id);
+
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR_MIPMAP_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+
+    glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, format, GL_UNSIGNED_BYTE, nullptr);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    return id;
+}
+
+size_t Texture::estimateByteSize(GLuint width, GLuint height, int channels, bool mipmapped) {
+    size_t bytes = static_cast<size_t>(width) * height * channels;
+    // A full mip chain adds roughly a third on top of level 0.
+    return mipmapped ? bytes + bytes / 3 : bytes;
+}
+
+bool Texture::isCookedTexturePath(const std::string& path) {
+    return std::filesystem::path(path).extension() == kTextureContainerExtension;
+}
+
+static bool getContainerGLFormat(TextureContainerFormat format, GLenum& outInternalFormat, GLenum& outFormat) {
+    switch (format) {
+    case TextureContainerFormat::R8: outInternalFormat = GL_R8; outFormat = GL_RED; return true;
+    case TextureContainerFormat::RGB8: outInternalFormat = GL_RGB8; outFormat = GL_RGB; return true;
+    case TextureContainerFormat::RGBA8: outInternalFormat = GL_RGBA8; outFormat = GL_RGBA; return true;
+    case TextureContainerFormat::BC1: outInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT; outFormat = GL_RGBA; return GLEW_EXT_texture_compression_s3tc != 0;
+    case TextureContainerFormat::BC3: outInternalFormat = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT; outFormat = GL_RGBA; return GLEW_EXT_texture_compression_s3tc != 0;
+    }
+    return false;
+}
+
+GLuint Texture::createContainerStorage(const TextureContainerView& container) {
+    GLenum internalFormat, format;
+    if (!getContainerGLFormat(container.getFormat(), internalFormat, format)) {
+        std::cerr << "ERROR::TEXTURE: Cooked texture format " << container.header->format << " is not supported by this GL context." << std::endl;
+        return 0;
+    }
+
+    GLuint id = 0;
+    glGenTextures(1, &id);
+    glBindTexture(GL_TEXTURE_2D, id);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_REPEAT);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, container.header->mipCount > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_BASE_LEVEL, 0);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, container.header->mipCount - 1);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    return id;
+}
+
+bool Texture::uploadContainerLevel(GLuint id, const TextureContainerView& container, uint32_t level) {
+    GLenum internalFormat, format;
+    if (level >= container.header->mipCount || !getContainerGLFormat(container.getFormat(), internalFormat, format)) {
+        return false;
+    }
+
+    const TextureContainerMip& mip = container.mips[level];
+    glBindTexture(GL_TEXTURE_2D, id);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    if (isCompressedTextureFormat(container.getFormat())) {
+        glCompressedTexImage2D(GL_TEXTURE_2D, level, internalFormat, mip.width, mip.height, 0,
+            static_cast<GLsizei>(mip.size), container.getLevelData(level));
+    }
+    else {
+        glTexImage2D(GL_TEXTURE_2D, level, internalFormat, mip.width, mip.height, 0,
+            format, GL_UNSIGNED_BYTE, container.getLevelData(level));
+    }
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glBindTexture(GL_TEXTURE_2D, 0);
+    return true;
+}
+
+void Texture::loadCookedTexture(const std::string& path) {
+    FileView file = VirtualFileSystem::getInstance().open(path);
+    TextureContainerView container;
+    if (!file.isValid() || !container.parse(file.data, file.size)) {
+        std::cerr << "ERROR::TEXTURE::FAILED_TO_LOAD: " << path << " - invalid cooked texture" << std::endl;
+        return;
+    }
+
+    m_textureID = createContainerStorage(container);
+    if (m_textureID == 0) {
+        return;
+    }
+    for (uint32_t level = 0; level < container.header->mipCount; ++level) {
+        uploadContainerLevel(m_textureID, container, level);
+        m_byteSize += static_cast<size_t>(container.mips[level].size);
+    }
+    m_width = container.header->width;
+    m_height = container.header->height;
+}
+
 void Texture::loadTexture(const std::string& path) {
+    if (isCookedTexturePath(path)) {
+        loadCookedTexture(path);
+        return;
+    }
+
     glGenTextures(1, &m_textureID);
     glBindTexture(GL_TEXTURE_2D, m_textureID);
 
@@ -86,29 +276,23 @@ void Texture::loadTexture(const std::string& path) {
     glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
     int width, height, nrChannels;
-    unsigned char* data = stbi_load(path.c_str(), &width, &height, &nrChannels, 0);
+    FileView file = VirtualFileSystem::getInstance().open(path);
+    unsigned char* data = file.isValid() ? stbi_load_from_memory(file.data, static_cast<int>(file.size), &width, &height, &nrChannels, 0) : nullptr;
 
     if (data) {
-        GLenum format = GL_RGB;
-        if (nrChannels == 1)
-            format = GL_RED;
-        else if (nrChannels == 3)
-            format = GL_RGB;
-        else if (nrChannels == 4)
-            format = GL_RGBA;
-
-        GLint internalFormat = GL_RGB8;
-        if (format == GL_RED) internalFormat = GL_R8;
-        else if (format == GL_RGBA) internalFormat = GL_RGBA8;
+        GLenum format;
+        GLint internalFormat;
+        getFormatForChannels(nrChannels, format, internalFormat);
 
         glTexImage2D(GL_TEXTURE_2D, 0, internalFormat, width, height, 0, format, GL_UNSIGNED_BYTE, data);
         glGenerateMipmap(GL_TEXTURE_2D);
 
         m_width = width;
         m_height = height;
+        m_byteSize = estimateByteSize(width, height, nrChannels, true);
     }
     else {
-        std::cerr << "ERROR::TEXTURE::FAILED_TO_LOAD: " << path << " - " << stbi_failure_reason() << std::endl;
+        std::cerr << "ERROR::TEXTURE::FAILED_TO_LOAD: " << path << " - " << (file.isValid() ? stbi_failure_reason() : "file not found") << std::endl;
         glDeleteTextures(1, &m_textureID);
         m_textureID = 0;
     }
@@ -4,12 +4,18 @@
 #include <string>
 #include <iostream>
 #include <memory>
+#include "Core/TextureContainer.h"
 
 class Texture {
 public:
     Texture(const std::string& path, const std::string& type = "diffuse");
 
-    Texture(GLuint id, const std::string& name, GLuint width, GLuint height, const std::string& type = "generated");
+    // byteSize of 0 assumes RGBA8 without mipmaps.
+    Texture(GLuint id, const std::string& name, GLuint width, GLuint height, const std::string& type = "generated", size_t byteSize = 0);
+
+    // Handle for a texture that is still loading. It samples the placeholder
+    // until finishLoading() hands over the real GL texture.
+    Texture(const std::string& path, const std::string& type, const Texture& placeholder);
 
     ~Texture();
 
@@ -21,6 +27,28 @@ public:
     const std::string& getPath() const { return m_path; } 
     GLuint getWidth() const { return m_width; }          
     GLuint getHeight() const { return m_height; }
+    bool isLoaded() const { return m_isLoaded; }
+    // Set when an asynchronous load gave up; the placeholder stays bound.
+    bool hasLoadFailed() const { return m_loadFailed; }
+    void markLoadFailed() { m_loadFailed = true; }
+    // Approximate GPU memory held by this texture, mip chain included.
+    size_t getByteSize() const { return m_ownsTexture ? m_byteSize : 0; }
+
+    void finishLoading(GLuint id, GLuint width, GLuint height, size_t byteSize);
+    // The owned GL texture was respecified in place (glTexImage2D on getID()).
+    void resizeStorage(GLuint width, GLuint height, size_t byteSize);
+    // Loads m_path again synchronously. The current texture is kept if that fails.
+    bool reload();
+
+    static void getFormatForChannels(int channels, GLenum& outFormat, GLint& outInternalFormat);
+    static GLuint createStorage(GLuint width, GLuint height, int channels);
+    static size_t estimateByteSize(GLuint width, GLuint height, int channels, bool mipmapped);
+
+    // Cooked (.etex) textures: storage is created empty and filled one mip
+    // level at a time straight from the container's memory.
+    static bool isCookedTexturePath(const std::string& path);
+    static GLuint createContainerStorage(const TextureContainerView& container);
+    static bool uploadContainerLevel(GLuint id, const TextureContainerView& container, uint32_t level);
 
 private:
     GLuint m_textureID;
@@ -28,8 +56,15 @@ private:
     std::string m_path;
     GLuint m_width;
     GLuint m_height;
+    bool m_ownsTexture;
+    bool m_isLoaded;
+    bool m_loadFailed;
+    size_t m_byteSize;
 
     void loadTexture(const std::string& path);
+    void trackAllocation() const;
+    void trackFree() const;
+    void loadCookedTexture(const std::string& path);
 
     Texture(const Texture&) = delete;
     Texture& operator=(const Texture&) = delete;
@@ -0,0 +1,144 @@
+#include "Core/TextureAtlas.h"
+#include "Core/Texture.h"
+#include "Core/VirtualFileSystem.h"
+#include "stb_image.h"
+#include <algorithm>
+#include <cstring>
+#include <iostream>
+
+TextureAtlas::TextureAtlas(const std::string& name)
+    : m_name(name)
+{
+}
+
+TextureAtlas::~TextureAtlas() {
+}
+
+bool TextureAtlas::build(const std::vector<std::string>& spritePaths, const std::vector<AtlasImage>& extraImages, GLuint maxSize, GLuint padding) {
+    std::vector<SourceImage> images;
+    images.reserve(spritePaths.size() + extraImages.size() + 1);
+
+    bool decoded = true;
+    for (const std::string& path : spritePaths) {
+        if (std::find_if(images.begin(), images.end(), [&path](const SourceImage& image) { return image.path == path; }) != images.end()) {
+            continue;
+        }
+
+        SourceImage image;
+        image.path = path;
+        int channels;
+        FileView file = VirtualFileSystem::getInstance().open(path);
+        image.decoded = file.isValid() ? stbi_load_from_memory(file.data, static_cast<int>(file.size), &image.width, &image.height, &channels, 4) : nullptr;
+        image.pixels = image.decoded;
+        if (!image.pixels) {
+            std::cerr << "ERROR::TEXTUREATLAS: Failed to load sprite " << path << " for atlas '" << m_name << "' - " << (file.isValid() ? stbi_failure_reason() : "file not found") << std::endl;
+            decoded = false;
+            break;
+        }
+        images.push_back(image);
+    }
+
+    auto freeImages = [&images]() {
+        for (SourceImage& image : images) {
+            stbi_image_free(image.decoded);
+        }
+    };
+
+    if (!decoded) {
+        freeImages();
+        return false;
+    }
+
+    for (const AtlasImage& extra : extraImages) {
+        if (extra.width <= 0 || extra.height <= 0 || extra.pixels.size() < static_cast<size_t>(extra.width) * extra.height * 4) {
+            std::cerr << "ERROR::TEXTUREATLAS: Image " << extra.name << " for atlas '" << m_name << "' has no valid pixels." << std::endl;
+            freeImages();
+            return false;
+        }
+        SourceImage image;
+        image.path = extra.name;
+        image.pixels = extra.pixels.data();
+        image.width = extra.width;
+        image.height = extra.height;
+        images.push_back(image);
+    }
+
+    // Big enough that the extruded border still covers it in the lower mips.
+    unsigned char solidPixels[4 * 4 * 4];
+    std::memset(solidPixels, 255, sizeof(solidPixels));
+    SourceImage solid;
+    solid.path = kSolidSprite;
+    solid.pixels = solidPixels;
+    solid.width = 4;
+    solid.height = 4;
+    images.push_back(solid);
+
+    std::vector<ShelfRect*> rects;
+    for (SourceImage& image : images) {
+        rects.push_back(&image);
+    }
+    GLuint atlasWidth = 0;
+    GLuint atlasHeight = 0;
+    if (!ShelfPacker::pack(rects, maxSize, padding, atlasWidth, atlasHeight)) {
+        std::cerr << "ERROR::TEXTUREATLAS: Sprites for atlas '" << m_name << "' do not fit in " << maxSize << "x" << maxSize << "." << std::endl;
+        freeImages();
+        return false;
+    }
+
+    std::vector<unsigned char> atlasPixels(static_cast<size_t>(atlasWidth) * atlasHeight * 4, 0);
+    m_regions.clear();
+    for (const SourceImage& image : images) {
+        blit(image, atlasPixels, atlasWidth, padding);
+        m_regions[image.path] = glm::vec4(
+            static_cast<float>(image.x) / atlasWidth,
+            static_cast<float>(image.y) / atlasHeight,
+            static_cast<float>(image.width) / atlasWidth,
+            static_cast<float>(image.height) / atlasHeight);
+    }
+    freeImages();
+
+    GLuint id = Texture::createStorage(atlasWidth, atlasHeight, 4);
+    glBindTexture(GL_TEXTURE_2D, id);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+    glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, atlasWidth, atlasHeight, GL_RGBA, GL_UNSIGNED_BYTE, atlasPixels.data());
+    glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    glGenerateMipmap(GL_TEXTURE_2D);
+    glBindTexture(GL_TEXTURE_2D, 0);
+
+    m_texture = std::make_shared<Texture>(id, "Atlas:" + m_name, atlasWidth, atlasHeight, "diffuse",
+        Texture::estimateByteSize(atlasWidth, atlasHeight, 4, true));
+    std::cout << "TextureAtlas '" << m_name << "' built: " << m_regions.size() << " sprite(s) in " << atlasWidth << "x" << atlasHeight << "." << std::endl;
+    return true;
+}
+
+// Copies the image and extrudes its outermost pixels into the padding.
+void TextureAtlas::blit(const SourceImage& image, std::vector<unsigned char>& atlasPixels, GLuint atlasWidth, GLuint padding) {
+    const int pad = static_cast<int>(padding);
+    for (int y = -pad; y < image.height + pad; ++y) {
+        int sourceY = std::clamp(y, 0, image.height - 1);
+        for (int x = -pad; x < image.width + pad; ++x) {
+            int sourceX = std::clamp(x, 0, image.width - 1);
+            const unsigned char* source = image.pixels + (static_cast<size_t>(sourceY) * image.width + sourceX) * 4;
+            unsigned char* destination = atlasPixels.data() + ((static_cast<size_t>(image.y) + y) * atlasWidth + image.x + x) * 4;
+            std::memcpy(destination, source, 4);
+        }
+    }
+}
+
+bool TextureAtlas::hasSprite(const std::string& spritePath) const {
+    return m_regions.find(spritePath) != m_regions.end();
+}
+
+AtlasSprite TextureAtlas::getSprite(const std::string& spritePath) const {
+    AtlasSprite sprite;
+    auto it = m_regions.find(spritePath);
+    if (it == m_regions.end()) {
+        std::cerr << "WARNING: TextureAtlas '" << m_name << "' has no sprite " << spritePath << std::endl;
+        return sprite;
+    }
+    sprite.texture = m_texture;
+    sprite.uvRect = it->second;
+    return sprite;
+}
\ No newline at end of file
@@ -0,0 +1,67 @@
+#pragma once
+
+#include <GL/glew.h>
+#include <glm/glm.hpp>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+#include "Core/ShelfPacker.h"
+
+class Texture;
+
+// A sprite inside an atlas: the shared texture plus the sub-rectangle to
+// sample, as (u offset, v offset, u scale, v scale).
+struct AtlasSprite {
+    std::shared_ptr<Texture> texture;
+    glm::vec4 uvRect = glm::vec4(0.0f, 0.0f, 1.0f, 1.0f);
+};
+
+// An image made in memory (e.g. rasterized text) to pack alongside the files.
+// Pixels are RGBA8, rows top to bottom.
+struct AtlasImage {
+    std::string name;
+    int width = 0;
+    int height = 0;
+    std::vector<unsigned char> pixels;
+};
+
+// Packs a set of small images into one RGBA texture so that everything drawn
+// from it can share a single texture binding. Sprites are expected to use UVs
+// in [0, 1]; wrapping (GL_REPEAT) does not work across an atlas region.
+class TextureAtlas {
+public:
+    // Every atlas has this opaque white sprite, so untextured quads can
+    // sample it, tinted by their colour, and share the atlas binding.
+    static constexpr const char* kSolidSprite = "#solid";
+
+    explicit TextureAtlas(const std::string& name);
+    ~TextureAtlas();
+
+    // Decodes every image and packs them with shelf packing. Each sprite is
+    // surrounded by a padding border filled with its own edge pixels so
+    // filtering and lower mips don't bleed in neighbours.
+    // Images are looked up by their name.
+    bool build(const std::vector<std::string>& spritePaths, const std::vector<AtlasImage>& images = {}, GLuint maxSize = 4096, GLuint padding = 4);
+
+    bool hasSprite(const std::string& spritePath) const;
+    AtlasSprite getSprite(const std::string& spritePath) const;
+
+    const std::string& getName() const { return m_name; }
+    const std::shared_ptr<Texture>& getTexture() const { return m_texture; }
+    size_t getSpriteCount() const { return m_regions.size(); }
+
+private:
+    struct SourceImage : ShelfRect {
+        std::string path;
+        const unsigned char* pixels = nullptr;
+        // Set when stb_image decoded the pixels and must free them.
+        unsigned char* decoded = nullptr;
+    };
+
+    std::string m_name;
+    std::shared_ptr<Texture> m_texture;
+    std::map<std::string, glm::vec4> m_regions;
+
+    static void blit(const SourceImage& image, std::vector<unsigned char>& atlasPixels, GLuint atlasWidth, GLuint padding);
+};
\ No newline at end of file
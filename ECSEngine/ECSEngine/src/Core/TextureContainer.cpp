@@ -0,0 +1,73 @@
+#include "Core/TextureContainer.h"
+#include <cstring>
+#include <iostream>
+
+bool isCompressedTextureFormat(TextureContainerFormat format) {
+    return format == TextureContainerFormat::BC1 || format == TextureContainerFormat::BC3;
+}
+
+int getTextureFormatChannels(TextureContainerFormat format) {
+    switch (format) {
+    case TextureContainerFormat::R8: return 1;
+    case TextureContainerFormat::RGB8: return 3;
+    case TextureContainerFormat::RGBA8: return 4;
+    case TextureContainerFormat::BC1: return 4;
+    case TextureContainerFormat::BC3: return 4;
+    }
+    return 0;
+}
+
+uint64_t getTextureLevelSize(TextureContainerFormat format, uint32_t width, uint32_t height) {
+    if (isCompressedTextureFormat(format)) {
+        uint64_t blocks = static_cast<uint64_t>((width + 3) / 4) * ((height + 3) / 4);
+        return blocks * (format == TextureContainerFormat::BC1 ? 8 : 16);
+    }
+    return static_cast<uint64_t>(width) * height * getTextureFormatChannels(format);
+}
+
+bool TextureContainerView::parse(const void* data, size_t size) {
+    header = nullptr;
+    mips = nullptr;
+    base = static_cast<const unsigned char*>(data);
+
+    if (!data || size < sizeof(TextureContainerHeader)) {
+        std::cerr << "ERROR::TEXTURECONTAINER: File too small for header." << std::endl;
+        return false;
+    }
+
+    const TextureContainerHeader* candidate = static_cast<const TextureContainerHeader*>(data);
+    if (std::memcmp(candidate->magic, kTextureContainerMagic, sizeof(kTextureContainerMagic)) != 0) {
+        std::cerr << "ERROR::TEXTURECONTAINER: Bad magic." << std::endl;
+        return false;
+    }
+    if (candidate->version != kTextureContainerVersion) {
+        std::cerr << "ERROR::TEXTURECONTAINER: Unsupported version " << candidate->version << "." << std::endl;
+        return false;
+    }
+
+    TextureContainerFormat format = static_cast<TextureContainerFormat>(candidate->format);
+    if (getTextureFormatChannels(format) == 0 || candidate->mipCount == 0 || candidate->width == 0 || candidate->height == 0) {
+        std::cerr << "ERROR::TEXTURECONTAINER: Invalid format or dimensions." << std::endl;
+        return false;
+    }
+
+    size_t tableEnd = sizeof(TextureContainerHeader) + sizeof(TextureContainerMip) * candidate->mipCount;
+    if (tableEnd > size) {
+        std::cerr << "ERROR::TEXTURECONTAINER: Truncated mip table." << std::endl;
+        return false;
+    }
+
+    const TextureContainerMip* table = reinterpret_cast<const TextureContainerMip*>(base + sizeof(TextureContainerHeader));
+    for (uint32_t level = 0; level < candidate->mipCount; ++level) {
+        const TextureContainerMip& mip = table[level];
+        if (mip.offset < tableEnd || mip.offset > size || mip.size > size - mip.offset ||
+            mip.size != getTextureLevelSize(format, mip.width, mip.height)) {
+            std::cerr << "ERROR::TEXTURECONTAINER: Mip level " << level << " is out of bounds." << std::endl;
+            return false;
+        }
+    }
+
+    header = candidate;
+    mips = table;
+    return true;
+}
\ No newline at end of file
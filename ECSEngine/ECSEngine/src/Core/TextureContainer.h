@@ -0,0 +1,60 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// On-disk layout of cooked textures (.etex), produced by the TextureCooker
+// tool. All mip levels are stored largest first, each starting on a
+// kTextureContainerAlignment boundary, so a memory-mapped file can be handed
+// to GL level by level without copying or decoding.
+//
+//   TextureContainerHeader
+//   TextureContainerMip[mipCount]
+//   level data...
+
+constexpr char kTextureContainerMagic[4] = { 'E', 'T', 'E', 'X' };
+constexpr uint32_t kTextureContainerVersion = 1;
+constexpr uint32_t kTextureContainerAlignment = 16;
+constexpr const char* kTextureContainerExtension = ".etex";
+
+enum class TextureContainerFormat : uint32_t {
+    R8 = 1,
+    RGB8 = 2,
+    RGBA8 = 3,
+    BC1 = 4,
+    BC3 = 5
+};
+
+struct TextureContainerHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t format;
+    uint32_t width;
+    uint32_t height;
+    uint32_t mipCount;
+    uint32_t reserved[2];
+};
+
+struct TextureContainerMip {
+    uint32_t width;
+    uint32_t height;
+    uint64_t offset;
+    uint64_t size;
+};
+
+// Non-owning view over a container held in memory (usually a MappedFile).
+struct TextureContainerView {
+    const TextureContainerHeader* header = nullptr;
+    const TextureContainerMip* mips = nullptr;
+    const unsigned char* base = nullptr;
+
+    TextureContainerFormat getFormat() const { return static_cast<TextureContainerFormat>(header->format); }
+    const unsigned char* getLevelData(uint32_t level) const { return base + mips[level].offset; }
+
+    // Validates the header and mip table against the buffer size.
+    bool parse(const void* data, size_t size);
+};
+
+bool isCompressedTextureFormat(TextureContainerFormat format);
+int getTextureFormatChannels(TextureContainerFormat format);
+uint64_t getTextureLevelSize(TextureContainerFormat format, uint32_t width, uint32_t height);
\ No newline at end of file
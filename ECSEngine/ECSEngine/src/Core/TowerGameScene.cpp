@@ -7,10 +7,12 @@
 #include "Components/Camera3DComponent.h"
 #include "Components/CameraBaseComponent.h"
 #include "Core/FontRenderer.h"
+#include "Core/FrameArena.h"
 #include "Core/AssetManager.h"
 #include "Core/Shader.h"
 #include "Core/Texture.h"
 #include "Core/Mesh.h"
+#include "Core/Renderer.h"
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
 #include <iostream>
@@ -18,10 +20,21 @@
 #include <glm/gtc/matrix_transform.hpp>
 #include <random>
 
+// Spawning runs every time the key is pressed, so the asset keys are hashed
+// once at compile time.
+static constexpr AssetRef kBasicVertexShader = "res/shaders/basic.vert";
+static constexpr AssetRef kBasicFragmentShader = "res/shaders/basic.frag";
+static constexpr AssetRef kWallTexture = "res/textures/wall.png";
+static constexpr AssetRef kTowerCubeMesh = "TowerCube";
+
 TowerGameScene::TowerGameScene(const std::string& name)
     : Scene(name),
     m_towerGameObject(nullptr),
-    m_currentTowerHeight(0.0f)
+    m_currentTowerHeight(0.0f),
+    m_addCubeAction(kInvalidInputAction),
+    m_removeCubeAction(kInvalidInputAction),
+    m_rotateLeftAction(kInvalidInputAction),
+    m_rotateRightAction(kInvalidInputAction)
 {
     std::cout << "TowerGameScene '" << m_name << "' created." << std::endl;
 }
@@ -37,6 +50,15 @@ void TowerGameScene::Init() {
     Scene::Init();
     std::cout << "Initializing TowerGameScene '" << m_name << "'..." << std::endl;
 
+    InputManager& input = InputManager::getInstance();
+    m_addCubeAction = input.getActionId("tower.addCube");
+    m_removeCubeAction = input.getActionId("tower.removeCube");
+    m_rotateLeftAction = input.getActionId("tower.rotateLeft");
+    m_rotateRightAction = input.getActionId("tower.rotateRight");
+
+    m_cubeMesh = AssetManager::getInstance().getMesh(kTowerCubeMesh, []() { return std::make_shared<Mesh>("TowerCube"); });
+    m_cubeShader = AssetManager::getInstance().getShader(kBasicVertexShader, kBasicFragmentShader);
+    m_cubeTexture = AssetManager::getInstance().getTexture(kWallTexture, "diffuse");
     SetupTowerGameObjects();
 
     std::cout << "TowerGameScene '" << m_name << "' initialized with renderable objects." << std::endl;
@@ -46,7 +68,7 @@ void TowerGameScene::Update(float deltaTime) {
     Scene::Update(deltaTime);
 
 
-    if (InputManager::getInstance().isKeyJustPressed(GLFW_KEY_W)) {
+    if (InputManager::getInstance().isActionJustPressed(m_addCubeAction)) {
         if (m_towerGameObject) {
             static std::random_device rd;
             static std::mt19937 gen(rd());
@@ -60,9 +82,9 @@ void TowerGameScene::Update(float deltaTime) {
             newCube->getTransform()->setLocalScale(glm::vec3(newCubeScale));
             newCube->getTransform()->setLocalPosition(glm::vec3(0.0f, m_currentTowerHeight + (newCubeScale / 2.0f), 0.0f));
 
-            MeshComponent* meshComp = newCube->addComponent<MeshComponent>();
-            std::shared_ptr<Shader> cubeShader = AssetManager::getInstance().getShader("res/shaders/basic.vert", "res/shaders/basic.frag");
-            RenderComponent* renderComp = newCube->addComponent<RenderComponent>(cubeShader);
+            // Every tower cube shares one mesh instead of uploading its own copy.
+            MeshComponent* meshComp = newCube->addComponent<MeshComponent>(m_cubeMesh);
+            RenderComponent* renderComp = newCube->addComponent<RenderComponent>(m_cubeShader);
 
             if (meshComp && meshComp->getMesh()) {
                 renderComp->setMesh(meshComp->getMesh());
@@ -71,8 +93,7 @@ void TowerGameScene::Update(float deltaTime) {
                 std::cerr << "ERROR: Failed to add MeshComponent or get mesh from newCube! RenderComponent might not have a mesh." << std::endl;
             }
 
-            std::shared_ptr<Texture> cubeTexture = AssetManager::getInstance().getTexture("res/textures/wall.png", "diffuse");
-            renderComp->setTexture(cubeTexture);
+            renderComp->setTexture(m_cubeTexture);
             renderComp->setObjectColor(newCubeColor);
 
             m_towerGameObject->addChild(std::move(newCube));
@@ -82,7 +103,7 @@ void TowerGameScene::Update(float deltaTime) {
     }
   
 
-    if (InputManager::getInstance().isKeyJustPressed(GLFW_KEY_S)) {
+    if (InputManager::getInstance().isActionJustPressed(m_removeCubeAction)) {
         if (m_towerGameObject && !m_towerGameObject->getChildren().empty()) {
             const std::unique_ptr<GameObject>& topCube = m_towerGameObject->getChildren().back();
             float topCubeScale = topCube->getTransform()->getLocalScale().y;
@@ -97,18 +118,6 @@ void TowerGameScene::Update(float deltaTime) {
         }
     }
 
-    if (m_towerGameObject && m_towerGameObject->getTransform()) {
-        TransformComponent* towerTransform = m_towerGameObject->getTransform();
-        float rotationSpeed = glm::radians(90.0f) * deltaTime;
-
-        if (InputManager::getInstance().isKeyPressed(GLFW_KEY_Q)) {
-            towerTransform->rotate(glm::vec3(0.0f, rotationSpeed, 0.0f));
-        }
-        if (InputManager::getInstance().isKeyPressed(GLFW_KEY_E)) {
-            towerTransform->rotate(glm::vec3(0.0f, -rotationSpeed, 0.0f));
-        }
-    }
-
     if (m_activeCamera && m_towerGameObject) {
         Camera3DComponent* active3DCamera = dynamic_cast<Camera3DComponent*>(m_activeCamera);
 
@@ -128,56 +137,74 @@ void TowerGameScene::Update(float deltaTime) {
     }
 }
 
-void TowerGameScene::Render() {
-    Scene::Render();
-
-    if (m_fontRenderer) {
-        std::string nameText = "Milan Arežina, SV55/2021";
-        float nameTextScale = 0.3f;
-        float estimatedCharWidth = 48.0f * 0.6f; 
-        float textPixelWidth = nameText.length() * estimatedCharWidth * nameTextScale;
-        float padding = 10.0f;
-        float nameX = 800.0f - textPixelWidth - padding; 
-        float nameY = padding; 
-        m_fontRenderer->renderText(nameText, nameX, nameY, nameTextScale, glm::vec3(1.0f, 0.5f, 0.2f));
-        size_t numCubes = m_towerGameObject ? m_towerGameObject->getChildren().size() : 0;
-        std::string heightText = "Tower height: " + std::to_string(numCubes) + " cubes, " +
-            std::to_string(m_currentTowerHeight) + " m";
-
-        m_fontRenderer->renderText(heightText, 20, getWindowHeight() - 20, nameTextScale, glm::vec3(0.2f, 0.8f, 1.0f));
-
-        float controlTextScale = 0.3f;
-        float controlPaddingX = 10.0f;
-        float controlPaddingY = 10.0f;
-        float lineHeight = 48.0f * controlTextScale * 1.2f; 
-
-        float currentY = 10; 
-        glm::vec3 controlsColor = glm::vec3(0.0f, 1.0f, 1.0f);
-
-        m_fontRenderer->renderText("Rotate tower -> Q/E", controlPaddingX, currentY, controlTextScale, controlsColor);
+void TowerGameScene::FixedUpdate(float fixedDeltaTime) {
+    Scene::FixedUpdate(fixedDeltaTime);
 
+    if (m_towerGameObject && m_towerGameObject->getTransform()) {
+        TransformComponent* towerTransform = m_towerGameObject->getTransform();
+        float rotationSpeed = glm::radians(90.0f) * fixedDeltaTime;
 
-        currentY += lineHeight;
-        m_fontRenderer->renderText("Remove layer -> S", controlPaddingX, currentY, controlTextScale, controlsColor);
-
-
-        currentY += lineHeight;
-
-        m_fontRenderer->renderText("Add layer -> W", controlPaddingX, currentY, controlTextScale, controlsColor);
-
-        currentY += lineHeight;
-        m_fontRenderer->renderText("Keyboard controls", controlPaddingX, currentY, controlTextScale, controlsColor);
+        if (InputManager::getInstance().isActionHeld(m_rotateLeftAction)) {
+            towerTransform->rotate(glm::vec3(0.0f, rotationSpeed, 0.0f));
+        }
+        if (InputManager::getInstance().isActionHeld(m_rotateRightAction)) {
+            towerTransform->rotate(glm::vec3(0.0f, -rotationSpeed, 0.0f));
+        }
+    }
+}
 
+void TowerGameScene::Render() {
+    Scene::Render();
 
+    if (m_fontRenderer) {
+        m_labels.clear();
+        addLabels(m_labels);
+        Renderer::SubmitText(m_labels, *m_fontRenderer);
+    }
+}
 
+void TowerGameScene::BuildRenderSnapshot(RenderSnapshot& outSnapshot) {
+    Scene::BuildRenderSnapshot(outSnapshot);
+    addLabels(outSnapshot);
+}
 
-    }
+void TowerGameScene::addLabels(RenderSnapshot& outSnapshot) const {
+    std::string_view nameText = "Milan Arežina, SV55/2021";
+    float nameTextScale = 0.3f;
+    float estimatedCharWidth = 48.0f * 0.6f; 
+    float textPixelWidth = nameText.length() * estimatedCharWidth * nameTextScale;
+    float padding = 10.0f;
+    float nameX = 800.0f - textPixelWidth - padding; 
+    float nameY = padding; 
+    outSnapshot.addText(nameText, nameX, nameY, nameTextScale, glm::vec3(1.0f, 0.5f, 0.2f));
+    size_t numCubes = m_towerGameObject ? m_towerGameObject->getChildren().size() : 0;
+    FrameString heightText = formatFrameString("Tower height: %zu cubes, %f m", numCubes, m_currentTowerHeight);
+
+    outSnapshot.addText(heightText, 20, getWindowHeight() - 20, nameTextScale, glm::vec3(0.2f, 0.8f, 1.0f));
+
+    float controlTextScale = 0.3f;
+    float controlPaddingX = 10.0f;
+    float lineHeight = 48.0f * controlTextScale * 1.2f; 
+
+    float currentY = 10; 
+    glm::vec3 controlsColor = glm::vec3(0.0f, 1.0f, 1.0f);
+
+    outSnapshot.addText("Rotate tower -> Q/E", controlPaddingX, currentY, controlTextScale, controlsColor);
+    currentY += lineHeight;
+    outSnapshot.addText("Remove layer -> S", controlPaddingX, currentY, controlTextScale, controlsColor);
+    currentY += lineHeight;
+    outSnapshot.addText("Add layer -> W", controlPaddingX, currentY, controlTextScale, controlsColor);
+    currentY += lineHeight;
+    outSnapshot.addText("Keyboard controls", controlPaddingX, currentY, controlTextScale, controlsColor);
 }
 
 void TowerGameScene::Shutdown() {
     std::cout << "Shutting down TowerGameScene '" << m_name << "'..." << std::endl;
     m_towerGameObject = nullptr;
     Scene::Shutdown();
+    m_cubeMesh = nullptr;
+    m_cubeShader = nullptr;
+    m_cubeTexture = nullptr;
     std::cout << "TowerGameScene '" << m_name << "' shutdown complete." << std::endl;
 }
 
@@ -198,6 +225,7 @@ void TowerGameScene::SetupTowerGameObjects() {
 
     auto towerObject = std::make_unique<GameObject>("Tower");
     towerObject->getTransform()->setLocalPosition(glm::vec3(0.0f, 0.0f, 0.0f));
+    towerObject->getTransform()->setInterpolationEnabled(true);
     m_towerGameObject = AddGameObject(std::move(towerObject));
 
     auto groundPlane = std::make_unique<GameObject>("GroundPlane");
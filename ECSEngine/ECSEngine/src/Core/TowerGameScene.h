@@ -1,11 +1,15 @@
 #pragma once
 
 #include "Core/Scene.h"
+#include "Input/InputManager.h"
 #include <string>
 #include <memory>
 
 class GameObject;
 class CameraComponent;
+class Mesh;
+class Shader;
+class Texture;
 
 class TowerGameScene : public Scene {
 public:
@@ -14,12 +18,28 @@ public:
 
     void Init() override;
     void Update(float deltaTime) override;
+    void FixedUpdate(float fixedDeltaTime) override;
     void Render() override;
+    void BuildRenderSnapshot(RenderSnapshot& outSnapshot) override;
+    // Update and FixedUpdate make no GL calls: the cube assets are loaded in
+    // Init and the labels go through the render snapshot.
+    bool supportsPipelinedSimulation() const override { return true; }
     void Shutdown() override;
 
 private:
     void SetupTowerGameObjects();
+    void addLabels(RenderSnapshot& outSnapshot) const;
 
     GameObject* m_towerGameObject;
     float m_currentTowerHeight;
+    RenderSnapshot m_labels;
+
+    std::shared_ptr<Mesh> m_cubeMesh;
+    std::shared_ptr<Shader> m_cubeShader;
+    std::shared_ptr<Texture> m_cubeTexture;
+
+    InputActionId m_addCubeAction;
+    InputActionId m_removeCubeAction;
+    InputActionId m_rotateLeftAction;
+    InputActionId m_rotateRightAction;
 };
\ No newline at end of file
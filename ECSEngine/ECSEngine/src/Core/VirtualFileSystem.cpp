@@ -0,0 +1,102 @@
+#include "Core/VirtualFileSystem.h"
+#include "Core/MappedFile.h"
+#include "Core/Lz4.h"
+#include <filesystem>
+#include <iostream>
+
+std::string VirtualFileSystem::normalizePath(const std::string& path) {
+    return std::filesystem::path(path).lexically_normal().generic_string();
+}
+
+bool VirtualFileSystem::mountArchive(const std::string& archivePath) {
+    MountedArchive archive;
+    archive.file = std::make_shared<MappedFile>();
+    if (!archive.file->open(archivePath) || !archive.view.parse(archive.file->data(), archive.file->size())) {
+        std::cerr << "ERROR::VFS: Could not mount archive " << archivePath << std::endl;
+        return false;
+    }
+
+    std::cout << "VFS: mounted " << archivePath << " (" << archive.view.header->entryCount << " files)" << std::endl;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_archives.push_back(std::move(archive));
+    return true;
+}
+
+void VirtualFileSystem::unmountAll() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_archives.clear();
+}
+
+bool VirtualFileSystem::exists(const std::string& path) const {
+    std::string normalizedPath = normalizePath(path);
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto it = m_archives.rbegin(); it != m_archives.rend(); ++it) {
+            if (it->view.find(normalizedPath)) {
+                return true;
+            }
+        }
+    }
+    std::error_code error;
+    return std::filesystem::is_regular_file(normalizedPath, error);
+}
+
+FileView VirtualFileSystem::open(const std::string& path) const {
+    std::string normalizedPath = normalizePath(path);
+    FileView view;
+
+    // The mount list may grow while the entry is decoded, so copy out what is
+    // needed while holding the lock.
+    std::shared_ptr<MappedFile> archiveFile;
+    AssetArchiveEntry entry = {};
+    const unsigned char* stored = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for (auto it = m_archives.rbegin(); it != m_archives.rend(); ++it) {
+            if (const AssetArchiveEntry* found = it->view.find(normalizedPath)) {
+                archiveFile = it->file;
+                entry = *found;
+                stored = it->view.getData(*found);
+                break;
+            }
+        }
+    }
+
+    if (archiveFile) {
+        if (entry.compression == static_cast<uint32_t>(AssetArchiveCompression::None)) {
+            // Shares ownership of the mapping without copying anything.
+            view.data = stored;
+            view.size = static_cast<size_t>(entry.size);
+            view.storage = std::shared_ptr<const void>(archiveFile, stored);
+            return view;
+        }
+
+        auto buffer = std::make_shared<std::vector<unsigned char>>(static_cast<size_t>(entry.size));
+        if (!lz4Decompress(stored, static_cast<size_t>(entry.storedSize), buffer->data(), buffer->size())) {
+            std::cerr << "ERROR::VFS: Corrupt archive entry " << normalizedPath << std::endl;
+            return view;
+        }
+        view.data = buffer->data();
+        view.size = buffer->size();
+        view.storage = buffer;
+        return view;
+    }
+
+    std::error_code error;
+    if (!std::filesystem::is_regular_file(normalizedPath, error)) {
+        return view;
+    }
+    if (std::filesystem::file_size(normalizedPath, error) == 0) {
+        view.storage = std::make_shared<std::vector<unsigned char>>();
+        return view;
+    }
+
+    auto file = std::make_shared<MappedFile>();
+    if (!file->open(normalizedPath)) {
+        return view;
+    }
+    view.data = file->data();
+    view.size = file->size();
+    view.storage = file;
+    return view;
+}
\ No newline at end of file
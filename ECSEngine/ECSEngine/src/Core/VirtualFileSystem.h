@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+#include "Core/AssetArchive.h"
+
+class MappedFile;
+
+// Read-only bytes of one file. Uncompressed archive entries and loose files
+// point straight into a memory mapping; compressed entries own a decoded
+// copy. The view keeps its backing storage alive, so it stays valid after
+// the archive is unmounted.
+struct FileView {
+    const unsigned char* data = nullptr;
+    size_t size = 0;
+    std::shared_ptr<const void> storage;
+
+    bool isValid() const { return storage != nullptr; }
+    std::string_view text() const { return std::string_view(reinterpret_cast<const char*>(data), size); }
+};
+
+// Resolves asset paths like "res/shaders/basic.vert" against the mounted
+// .epak archives first (most recently mounted wins) and then the loose files
+// on disk. A lookup that hits an archive never touches the file system.
+class VirtualFileSystem {
+private:
+    VirtualFileSystem() {}
+
+    VirtualFileSystem(const VirtualFileSystem&) = delete;
+    VirtualFileSystem& operator=(const VirtualFileSystem&) = delete;
+
+    struct MountedArchive {
+        std::shared_ptr<MappedFile> file;
+        AssetArchiveView view;
+    };
+
+    std::vector<MountedArchive> m_archives;
+    mutable std::mutex m_mutex;
+
+public:
+    static VirtualFileSystem& getInstance() {
+        static VirtualFileSystem instance;
+        return instance;
+    }
+
+    bool mountArchive(const std::string& archivePath);
+    void unmountAll();
+
+    bool exists(const std::string& path) const;
+    // Returns an invalid view if the file is in no archive and not on disk.
+    FileView open(const std::string& path) const;
+
+    static std::string normalizePath(const std::string& path);
+};
\ No newline at end of file
@@ -1,12 +1,73 @@
 #include "Input/InputManager.h"
+#include "Core/Json.h"
+#include "Core/VirtualFileSystem.h"
 #include <iostream>
 
+namespace {
+    struct InputName {
+        const char* name;
+        int code;
+    };
+
+    const InputName kNamedKeys[] = {
+        { "SPACE", GLFW_KEY_SPACE }, { "APOSTROPHE", GLFW_KEY_APOSTROPHE }, { "COMMA", GLFW_KEY_COMMA },
+        { "MINUS", GLFW_KEY_MINUS }, { "PERIOD", GLFW_KEY_PERIOD }, { "SLASH", GLFW_KEY_SLASH },
+        { "SEMICOLON", GLFW_KEY_SEMICOLON }, { "EQUAL", GLFW_KEY_EQUAL }, { "LEFT_BRACKET", GLFW_KEY_LEFT_BRACKET },
+        { "BACKSLASH", GLFW_KEY_BACKSLASH }, { "RIGHT_BRACKET", GLFW_KEY_RIGHT_BRACKET }, { "GRAVE_ACCENT", GLFW_KEY_GRAVE_ACCENT },
+        { "ESCAPE", GLFW_KEY_ESCAPE }, { "ENTER", GLFW_KEY_ENTER }, { "TAB", GLFW_KEY_TAB },
+        { "BACKSPACE", GLFW_KEY_BACKSPACE }, { "INSERT", GLFW_KEY_INSERT }, { "DELETE", GLFW_KEY_DELETE },
+        { "RIGHT", GLFW_KEY_RIGHT }, { "LEFT", GLFW_KEY_LEFT }, { "DOWN", GLFW_KEY_DOWN }, { "UP", GLFW_KEY_UP },
+        { "PAGE_UP", GLFW_KEY_PAGE_UP }, { "PAGE_DOWN", GLFW_KEY_PAGE_DOWN }, { "HOME", GLFW_KEY_HOME }, { "END", GLFW_KEY_END },
+        { "KP_DECIMAL", GLFW_KEY_KP_DECIMAL }, { "KP_DIVIDE", GLFW_KEY_KP_DIVIDE }, { "KP_MULTIPLY", GLFW_KEY_KP_MULTIPLY },
+        { "KP_SUBTRACT", GLFW_KEY_KP_SUBTRACT }, { "KP_ADD", GLFW_KEY_KP_ADD }, { "KP_ENTER", GLFW_KEY_KP_ENTER },
+        { "LEFT_SHIFT", GLFW_KEY_LEFT_SHIFT }, { "LEFT_CONTROL", GLFW_KEY_LEFT_CONTROL }, { "LEFT_ALT", GLFW_KEY_LEFT_ALT },
+        { "RIGHT_SHIFT", GLFW_KEY_RIGHT_SHIFT }, { "RIGHT_CONTROL", GLFW_KEY_RIGHT_CONTROL }, { "RIGHT_ALT", GLFW_KEY_RIGHT_ALT }
+    };
+
+    const InputName kNamedMouseButtons[] = {
+        { "MOUSE_LEFT", GLFW_MOUSE_BUTTON_LEFT }, { "MOUSE_RIGHT", GLFW_MOUSE_BUTTON_RIGHT }, { "MOUSE_MIDDLE", GLFW_MOUSE_BUTTON_MIDDLE }
+    };
+
+    // Letters, digits, F1-F25 and KP_0-KP_9 are matched by pattern; everything
+    // else by the tables above. Returns -1 if the name is unknown.
+    int keyFromName(const std::string& name) {
+        if (name.size() == 1 && name[0] >= 'A' && name[0] <= 'Z') {
+            return GLFW_KEY_A + (name[0] - 'A');
+        }
+        if (name.size() == 1 && name[0] >= '0' && name[0] <= '9') {
+            return GLFW_KEY_0 + (name[0] - '0');
+        }
+        if (name.size() == 4 && name.compare(0, 3, "KP_") == 0 && name[3] >= '0' && name[3] <= '9') {
+            return GLFW_KEY_KP_0 + (name[3] - '0');
+        }
+        if (name.size() >= 2 && name.size() <= 3 && name[0] == 'F' && name.find_first_not_of("0123456789", 1) == std::string::npos) {
+            int number = std::stoi(name.substr(1));
+            if (number >= 1 && number <= 25) {
+                return GLFW_KEY_F1 + (number - 1);
+            }
+        }
+        for (const InputName& key : kNamedKeys) {
+            if (name == key.name) {
+                return key.code;
+            }
+        }
+        return -1;
+    }
+
+    int mouseButtonFromName(const std::string& name) {
+        for (const InputName& button : kNamedMouseButtons) {
+            if (name == button.name) {
+                return button.code;
+            }
+        }
+        return -1;
+    }
+}
+
 InputManager::InputManager()
-    : m_mouseX(0.0), m_mouseY(0.0),
-    m_lastMouseX(0.0), m_lastMouseY(0.0),
-    m_mouseDeltaX(0.0), m_mouseDeltaY(0.0),
-    m_scrollYOffset(0.0f),
-    m_firstMouseMove(true) 
+    : m_front(0),
+    m_keyActions(KeyCount),
+    m_mouseButtonActions(MouseButtonCount)
 {
 
 }
@@ -29,11 +90,11 @@ void InputManager::initialize(GLFWwindow* window) {
 
     double x, y;
     glfwGetCursorPos(m_window, &x, &y);
-    m_mouseX = x;
-    m_mouseY = y;
-    m_lastMouseX = x;
-    m_lastMouseY = y;
-    m_firstMouseMove = false;
+    for (FrameState& state : m_states) {
+        state.mouseX = x;
+        state.mouseY = y;
+        state.events.reserve(64);
+    }
 
     glfwSetKeyCallback(m_window, InputManager::glfw_key_callback);
     glfwSetMouseButtonCallback(m_window, InputManager::glfw_mouse_button_callback);
@@ -43,101 +104,284 @@ void InputManager::initialize(GLFWwindow* window) {
     std::cout << "InputManager initialized with GLFW callbacks." << std::endl;
 }
 
-void InputManager::update() {
-    m_justPressedKeys.clear();
-    m_justReleasedKeys.clear();
-    m_justPressedMouseButtons.clear();
-    m_justReleasedMouseButtons.clear();
+void InputManager::update(float frameTime) {
+    const unsigned int front = m_front.load(std::memory_order_relaxed);
+    const FrameState& previous = m_states[front];
+    FrameState& next = m_states[front ^ 1u];
 
-    m_scrollYOffset = 0.0f;
-
- 
-    m_mouseDeltaX = m_mouseX - m_lastMouseX;
-    m_mouseDeltaY = m_lastMouseY - m_mouseY;
+    next.keys = previous.keys;
+    next.keysPressed.reset();
+    next.keysReleased.reset();
+    next.buttons = previous.buttons;
+    next.buttonsPressed.reset();
+    next.buttonsReleased.reset();
+    next.mouseX = previous.mouseX;
+    next.mouseY = previous.mouseY;
+    next.scrollYOffset = 0.0f;
+    next.events.clear();
+    next.actions.clear();
 
+    InputEvent event;
+    if (m_mode == Mode::Replaying) {
+        while (m_events.pop(event)) {
+        }
+        if (!isReplayFinished()) {
+            m_recording.getFrameEvents(m_replayFrame++, m_recordingStartTime, next.events);
+        }
+        for (const InputEvent& replayed : next.events) {
+            applyEvent(next, replayed);
+        }
+    }
+    else {
+        while (m_events.pop(event)) {
+            applyEvent(next, event);
+            next.events.push_back(event);
+        }
+        if (m_mode == Mode::Recording) {
+            m_recording.addFrame(frameTime, next.events, m_recordingStartTime);
+        }
+    }
 
-    m_lastMouseX = m_mouseX;
-    m_lastMouseY = m_mouseY;
+    next.mouseDeltaX = next.mouseX - previous.mouseX;
+    next.mouseDeltaY = previous.mouseY - next.mouseY;
 
+    m_front.store(front ^ 1u, std::memory_order_release);
 }
 
-bool InputManager::isKeyPressed(int key) const {
-    auto it = m_keys.find(key);
-    return (it != m_keys.end() && it->second);
+bool InputManager::startRecording(const std::string& path) {
+    if (m_mode != Mode::Live) {
+        std::cerr << "ERROR: InputManager::startRecording - Already recording or replaying." << std::endl;
+        return false;
+    }
+    const FrameState& state = current();
+    m_recording.clear();
+    m_recording.setStartMouse(state.mouseX, state.mouseY);
+    m_recordingPath = path;
+    m_recordingStartTime = glfwGetTime();
+    m_mode = Mode::Recording;
+    std::cout << "InputManager: recording input to " << path << std::endl;
+    return true;
 }
 
-bool InputManager::isKeyJustPressed(int key) const {
-    return m_justPressedKeys.count(key) > 0;
+bool InputManager::stopRecording() {
+    if (m_mode != Mode::Recording) {
+        return false;
+    }
+    m_mode = Mode::Live;
+    if (!m_recording.save(m_recordingPath)) {
+        return false;
+    }
+    std::cout << "InputManager: saved " << m_recording.getFrameCount() << " frames of input to " << m_recordingPath << std::endl;
+    return true;
 }
 
-bool InputManager::isKeyReleased(int key) const {
-    return m_justReleasedKeys.count(key) > 0;
+// Starts from a clean state: no keys held and the cursor where it was when
+// the recording began.
+bool InputManager::startReplay(const std::string& path) {
+    if (m_mode != Mode::Live) {
+        std::cerr << "ERROR: InputManager::startReplay - Already recording or replaying." << std::endl;
+        return false;
+    }
+    if (!m_recording.load(path)) {
+        return false;
+    }
+    const unsigned int front = m_front.load(std::memory_order_relaxed);
+    FrameState& state = m_states[front];
+    state = FrameState();
+    state.mouseX = m_recording.getStartMouseX();
+    state.mouseY = m_recording.getStartMouseY();
+    state.events.reserve(64);
+    m_replayFrame = 0;
+    m_recordingStartTime = glfwGetTime();
+    m_mode = Mode::Replaying;
+    std::cout << "InputManager: replaying " << m_recording.getFrameCount() << " frames of input from " << path << std::endl;
+    return true;
 }
 
-bool InputManager::isMouseButtonPressed(int button) const {
-    auto it = m_mouseButtons.find(button);
-    return (it != m_mouseButtons.end() && it->second);
+// A press and release inside one frame sets both edges, so quick taps are not lost.
+void InputManager::applyEvent(FrameState& state, const InputEvent& event) {
+    switch (event.type) {
+    case InputEventType::Key:
+        if (!isKeyIndex(event.code)) {
+            break;
+        }
+        if (event.action == GLFW_PRESS && !state.keys[event.code]) {
+            state.keysPressed[event.code] = true;
+            state.keys[event.code] = true;
+            addActionEvents(state, m_keyActions[event.code], true, event.time);
+        }
+        else if (event.action == GLFW_RELEASE && state.keys[event.code]) {
+            state.keysReleased[event.code] = true;
+            state.keys[event.code] = false;
+            addActionEvents(state, m_keyActions[event.code], false, event.time);
+        }
+        break;
+    case InputEventType::MouseButton:
+        if (!isMouseButtonIndex(event.code)) {
+            break;
+        }
+        if (event.action == GLFW_PRESS && !state.buttons[event.code]) {
+            state.buttonsPressed[event.code] = true;
+            state.buttons[event.code] = true;
+            addActionEvents(state, m_mouseButtonActions[event.code], true, event.time);
+        }
+        else if (event.action == GLFW_RELEASE && state.buttons[event.code]) {
+            state.buttonsReleased[event.code] = true;
+            state.buttons[event.code] = false;
+            addActionEvents(state, m_mouseButtonActions[event.code], false, event.time);
+        }
+        break;
+    case InputEventType::MouseMove:
+        state.mouseX = event.x;
+        state.mouseY = event.y;
+        break;
+    case InputEventType::Scroll:
+        state.scrollYOffset += static_cast<float>(event.y);
+        break;
+    }
 }
 
-bool InputManager::isMouseButtonJustPressed(int button) const {
-    return m_justPressedMouseButtons.count(button) > 0;
+void InputManager::addActionEvents(FrameState& state, const std::vector<InputActionId>& actions, bool pressed, double time) {
+    for (InputActionId action : actions) {
+        state.actions.push_back({ action, pressed, time });
+    }
 }
 
-bool InputManager::isMouseButtonReleased(int button) const {
-    return m_justReleasedMouseButtons.count(button) > 0;
+InputActionId InputManager::getActionId(const std::string& name) {
+    auto it = m_actionIds.find(name);
+    if (it != m_actionIds.end()) {
+        return it->second;
+    }
+    if (m_actionNames.size() >= kInvalidInputAction) {
+        std::cerr << "ERROR: InputManager - Too many input actions, ignoring '" << name << "'." << std::endl;
+        return kInvalidInputAction;
+    }
+    InputActionId action = static_cast<InputActionId>(m_actionNames.size());
+    m_actionIds.emplace(name, action);
+    m_actionNames.push_back(name);
+    m_actionBindings.emplace_back();
+    return action;
 }
 
-float InputManager::getScrollYOffset() {
-    return m_scrollYOffset;
+void InputManager::bind(InputActionId action, const InputBinding& binding) {
+    m_actionBindings[action].push_back(binding);
+    if (binding.mouseButton) {
+        m_mouseButtonActions[binding.code].push_back(action);
+    }
+    else {
+        m_keyActions[binding.code].push_back(action);
+    }
 }
 
+// Replaces all bindings. Action ids handed out earlier stay valid.
+bool InputManager::loadBindings(const std::string& path) {
+    FileView file = VirtualFileSystem::getInstance().open(path);
+    if (!file.isValid()) {
+        std::cerr << "ERROR: InputManager::loadBindings - Could not read " << path << std::endl;
+        return false;
+    }
 
-void InputManager::glfw_key_callback(GLFWwindow* window, int key, int scancode, int action, int mods) {
-    InputManager& instance = InputManager::getInstance();
+    JsonValue settings;
+    std::string error;
+    if (!JsonValue::parse(file.text(), settings, &error)) {
+        std::cerr << "ERROR: InputManager::loadBindings - " << path << ": " << error << std::endl;
+        return false;
+    }
+    const JsonValue* input = settings.find("input");
+    const JsonValue* bindings = input ? input->find("bindings") : nullptr;
+    if (!bindings || !bindings->isObject()) {
+        std::cerr << "ERROR: InputManager::loadBindings - " << path << " has no input.bindings object." << std::endl;
+        return false;
+    }
 
-    if (action == GLFW_PRESS) {
-        if (!instance.m_keys.count(key) || !instance.m_keys[key]) {
-            instance.m_justPressedKeys.insert(key);
-        }
-        instance.m_keys[key] = true;
-        instance.m_justReleasedKeys.erase(key);
+    for (auto& actionBindings : m_actionBindings) {
+        actionBindings.clear();
+    }
+    for (auto& actions : m_keyActions) {
+        actions.clear();
+    }
+    for (auto& actions : m_mouseButtonActions) {
+        actions.clear();
     }
-    else if (action == GLFW_RELEASE) {
-        if (instance.m_keys.count(key) && instance.m_keys[key]) {
-            instance.m_justReleasedKeys.insert(key);
+
+    size_t bindingCount = 0;
+    for (const auto& member : bindings->getObject()) {
+        InputActionId action = getActionId(member.first);
+        if (action == kInvalidInputAction) {
+            continue;
+        }
+        std::vector<JsonValue> single;
+        const std::vector<JsonValue>* names = &member.second.getArray();
+        if (member.second.isString()) {
+            single.push_back(member.second);
+            names = &single;
+        }
+        for (const JsonValue& name : *names) {
+            int key = keyFromName(name.getString());
+            int button = key < 0 ? mouseButtonFromName(name.getString()) : -1;
+            if (key >= 0) {
+                bind(action, { false, key });
+            }
+            else if (button >= 0) {
+                bind(action, { true, button });
+            }
+            else {
+                std::cerr << "WARNING: InputManager::loadBindings - Unknown input '" << name.getString() << "' for action '" << member.first << "'." << std::endl;
+                continue;
+            }
+            ++bindingCount;
         }
-        instance.m_keys[key] = false;
-        instance.m_justPressedKeys.erase(key);
     }
-}
 
-void InputManager::glfw_mouse_button_callback(GLFWwindow* window, int button, int action, int mods) {
-    InputManager& instance = InputManager::getInstance();
+    std::cout << "InputManager: loaded " << bindingCount << " bindings for " << bindings->getObject().size() << " actions from " << path << std::endl;
+    return true;
+}
 
-    if (action == GLFW_PRESS) {
-        if (!instance.m_mouseButtons.count(button) || !instance.m_mouseButtons[button]) {
-            instance.m_justPressedMouseButtons.insert(button);
+bool InputManager::isActionJustPressed(InputActionId action) const {
+    for (const InputActionEvent& event : current().actions) {
+        if (event.action == action && event.pressed) {
+            return true;
         }
-        instance.m_mouseButtons[button] = true;
-        instance.m_justReleasedMouseButtons.erase(button);
     }
-    else if (action == GLFW_RELEASE) {
-        if (instance.m_mouseButtons.count(button) && instance.m_mouseButtons[button]) {
-            instance.m_justReleasedMouseButtons.insert(button);
+    return false;
+}
+
+bool InputManager::isActionHeld(InputActionId action) const {
+    if (action >= m_actionBindings.size()) {
+        return false;
+    }
+    const FrameState& state = current();
+    for (const InputBinding& binding : m_actionBindings[action]) {
+        if (binding.mouseButton ? state.buttons[binding.code] : state.keys[binding.code]) {
+            return true;
         }
-        instance.m_mouseButtons[button] = false;
-        instance.m_justPressedMouseButtons.erase(button);
     }
+    return false;
 }
 
-void InputManager::glfw_mouse_position_callback(GLFWwindow* window, double xpos, double ypos) {
-    InputManager& instance = InputManager::getInstance();
+void InputManager::injectEvent(const InputEvent& event) {
+    if (!m_events.push(event) && !m_reportedOverflow) {
+        std::cerr << "WARNING: InputManager event queue is full, dropping input events." << std::endl;
+        m_reportedOverflow = true;
+    }
+}
 
-    instance.m_mouseX = xpos;
-    instance.m_mouseY = ypos;
+void InputManager::pushEvent(InputEventType type, int code, int action, double x, double y) {
+    injectEvent({ glfwGetTime(), type, code, action, x, y });
+}
+
+void InputManager::glfw_key_callback(GLFWwindow* window, int key, int scancode, int action, int mods) {
+    InputManager::getInstance().pushEvent(InputEventType::Key, key, action, 0.0, 0.0);
+}
+
+void InputManager::glfw_mouse_button_callback(GLFWwindow* window, int button, int action, int mods) {
+    InputManager::getInstance().pushEvent(InputEventType::MouseButton, button, action, 0.0, 0.0);
+}
+
+void InputManager::glfw_mouse_position_callback(GLFWwindow* window, double xpos, double ypos) {
+    InputManager::getInstance().pushEvent(InputEventType::MouseMove, 0, 0, xpos, ypos);
 }
 
 void InputManager::glfw_mouse_scroll_callback(GLFWwindow* window, double xoffset, double yoffset) {
-    InputManager& instance = InputManager::getInstance();
-    instance.m_scrollYOffset += static_cast<float>(yoffset); 
+    InputManager::getInstance().pushEvent(InputEventType::Scroll, 0, 0, xoffset, yoffset);
 }
\ No newline at end of file
@@ -2,51 +2,172 @@
 
 #include <GL/glew.h>
 #include <GLFW/glfw3.h>
-#include <map>
-#include <set>
+#include <atomic>
+#include <bitset>
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "Core/SpscQueue.h"
+#include "Input/InputRecording.h"
 
+enum class InputEventType : unsigned char {
+    Key,
+    MouseButton,
+    MouseMove,
+    Scroll
+};
+
+// One GLFW callback, stamped with glfwGetTime(). code is the key or mouse
+// button and action the GLFW action; x/y hold the cursor position or the
+// scroll offset.
+struct InputEvent {
+    double time;
+    InputEventType type;
+    int code;
+    int action;
+    double x;
+    double y;
+};
+
+using InputActionId = uint16_t;
+constexpr InputActionId kInvalidInputAction = 0xFFFF;
+
+// A bound key or mouse button changing state this frame.
+struct InputActionEvent {
+    InputActionId action;
+    bool pressed;
+    double time;
+};
+
+// GLFW callbacks only push events into a lock-free queue. update() drains it
+// into the back buffer of two frame states and then publishes that buffer, so
+// queries are plain bit tests on an immutable state. The published state stays
+// valid until the next update(), which lets the simulation thread read it while
+// the main thread is rendering.
 class InputManager {
 public:
+    static constexpr size_t KeyCount = GLFW_KEY_LAST + 1;
+    static constexpr size_t MouseButtonCount = GLFW_MOUSE_BUTTON_LAST + 1;
+
     static InputManager& getInstance();
     InputManager(const InputManager&) = delete;
     InputManager& operator=(const InputManager&) = delete;
 
     void initialize(GLFWwindow* window);
-    void update();
+    // Call once per frame after glfwPollEvents(). frameTime is what the frame
+    // runs with; it is stored with the frame while recording.
+    void update(float frameTime);
+
+    // Queues a synthetic event as if GLFW had delivered it. Must be called on
+    // the thread that polls GLFW events.
+    void injectEvent(const InputEvent& event);
+
+    // Captures every frame's events and frame time until stopRecording(),
+    // which writes them to path.
+    bool startRecording(const std::string& path);
+    bool stopRecording();
+    bool isRecording() const { return m_mode == Mode::Recording; }
+
+    // Replaces live input with a recording. Live events are discarded until
+    // the recording runs out; the frame loop should run each frame with
+    // getReplayFrameTime() so fixed steps line up with the capture.
+    bool startReplay(const std::string& path);
+    bool isReplaying() const { return m_mode == Mode::Replaying; }
+    bool isReplayFinished() const { return m_replayFrame >= m_recording.getFrameCount(); }
+    float getReplayFrameTime() const { return isReplayFinished() ? 0.0f : m_recording.getFrameDeltaTime(m_replayFrame); }
+    size_t getReplayFrameCount() const { return m_recording.getFrameCount(); }
 
-    bool isKeyPressed(int key) const;
-    bool isKeyJustPressed(int key) const;
-    bool isKeyReleased(int key) const;
+    bool isKeyPressed(int key) const { return isKeyIndex(key) && current().keys[key]; }
+    bool isKeyJustPressed(int key) const { return isKeyIndex(key) && current().keysPressed[key]; }
+    bool isKeyReleased(int key) const { return isKeyIndex(key) && current().keysReleased[key]; }
 
-    bool isMouseButtonPressed(int button) const;
-    bool isMouseButtonJustPressed(int button) const;
-    bool isMouseButtonReleased(int button) const;
-    double getMouseX() const { return m_mouseX; }
-    double getMouseY() const { return m_mouseY; }
-    double getMouseDeltaX() const { return m_mouseDeltaX; }
-    double getMouseDeltaY() const { return m_mouseDeltaY; }
-    float getScrollYOffset();
+    bool isMouseButtonPressed(int button) const { return isMouseButtonIndex(button) && current().buttons[button]; }
+    bool isMouseButtonJustPressed(int button) const { return isMouseButtonIndex(button) && current().buttonsPressed[button]; }
+    bool isMouseButtonReleased(int button) const { return isMouseButtonIndex(button) && current().buttonsReleased[button]; }
+    double getMouseX() const { return current().mouseX; }
+    double getMouseY() const { return current().mouseY; }
+    double getMouseDeltaX() const { return current().mouseDeltaX; }
+    double getMouseDeltaY() const { return current().mouseDeltaY; }
+    float getScrollYOffset() const { return current().scrollYOffset; }
+
+    // Events applied by the last update(), oldest first.
+    const std::vector<InputEvent>& getFrameEvents() const { return current().events; }
+
+    // Named actions bound to keys and mouse buttons. Ids are handed out on
+    // first use of a name, so resolve them once (e.g. in Scene::Init) on the
+    // main thread. Bindings come from the "input.bindings" object of the
+    // settings file: { "action": ["KEY", ...] }, see config/settings.json.
+    bool loadBindings(const std::string& path);
+    InputActionId getActionId(const std::string& name);
+    const std::string& getActionName(InputActionId action) const { return m_actionNames[action]; }
+
+    // Presses and releases of bound inputs in the last update(), in event
+    // order. Built only from the frame's events, so its cost does not depend
+    // on how many bindings exist.
+    const std::vector<InputActionEvent>& getActionEvents() const { return current().actions; }
+    bool isActionJustPressed(InputActionId action) const;
+    bool isActionHeld(InputActionId action) const;
 
 private:
     InputManager();
     ~InputManager();
 
+    struct FrameState {
+        std::bitset<KeyCount> keys;
+        std::bitset<KeyCount> keysPressed;
+        std::bitset<KeyCount> keysReleased;
+        std::bitset<MouseButtonCount> buttons;
+        std::bitset<MouseButtonCount> buttonsPressed;
+        std::bitset<MouseButtonCount> buttonsReleased;
+        double mouseX = 0.0;
+        double mouseY = 0.0;
+        double mouseDeltaX = 0.0;
+        double mouseDeltaY = 0.0;
+        float scrollYOffset = 0.0f;
+        std::vector<InputEvent> events;
+        std::vector<InputActionEvent> actions;
+    };
+
+    struct InputBinding {
+        bool mouseButton;
+        int code;
+    };
+
+    static bool isKeyIndex(int key) { return static_cast<unsigned int>(key) < KeyCount; }
+    static bool isMouseButtonIndex(int button) { return static_cast<unsigned int>(button) < MouseButtonCount; }
+    const FrameState& current() const { return m_states[m_front.load(std::memory_order_acquire)]; }
+
+    void pushEvent(InputEventType type, int code, int action, double x, double y);
+    void applyEvent(FrameState& state, const InputEvent& event);
+    void addActionEvents(FrameState& state, const std::vector<InputActionId>& actions, bool pressed, double time);
+    void bind(InputActionId action, const InputBinding& binding);
+
     GLFWwindow* m_window = nullptr;
 
-    std::map<int, bool> m_keys;
-    std::map<int, bool> m_mouseButtons;
+    enum class Mode {
+        Live,
+        Recording,
+        Replaying
+    };
 
+    FrameState m_states[2];
+    std::atomic<unsigned int> m_front;
+    SpscQueue<InputEvent, 1024> m_events;
+    bool m_reportedOverflow = false;
 
-    std::set<int> m_justPressedKeys;
-    std::set<int> m_justReleasedKeys; 
-    std::set<int> m_justPressedMouseButtons;
-    std::set<int> m_justReleasedMouseButtons;
+    Mode m_mode = Mode::Live;
+    InputRecording m_recording;
+    std::string m_recordingPath;
+    double m_recordingStartTime = 0.0;
+    size_t m_replayFrame = 0;
 
-    double m_mouseX, m_mouseY;
-    double m_lastMouseX, m_lastMouseY;
-    double m_mouseDeltaX, m_mouseDeltaY;
-    float m_scrollYOffset;
-    bool m_firstMouseMove = true;
+    std::unordered_map<std::string, InputActionId> m_actionIds;
+    std::vector<std::string> m_actionNames;
+    std::vector<std::vector<InputBinding>> m_actionBindings;
+    // Reverse lookup from a key or button to the actions it triggers.
+    std::vector<std::vector<InputActionId>> m_keyActions;
+    std::vector<std::vector<InputActionId>> m_mouseButtonActions;
 
     static void glfw_key_callback(GLFWwindow* window, int key, int scancode, int action, int mods);
     static void glfw_mouse_button_callback(GLFWwindow* window, int button, int action, int mods);
@@ -0,0 +1,112 @@
+#include "Input/InputRecording.h"
+#include "Input/InputManager.h"
+#include "Core/VirtualFileSystem.h"
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+void InputRecording::clear() {
+    m_frames.clear();
+    m_frameFirstEvent.clear();
+    m_events.clear();
+    m_startMouseX = 0.0;
+    m_startMouseY = 0.0;
+}
+
+void InputRecording::setStartMouse(double x, double y) {
+    m_startMouseX = x;
+    m_startMouseY = y;
+}
+
+void InputRecording::addFrame(float deltaTime, const std::vector<InputEvent>& events, double startTime) {
+    m_frameFirstEvent.push_back(static_cast<uint32_t>(m_events.size()));
+    m_frames.push_back({ deltaTime, static_cast<uint32_t>(events.size()) });
+    for (const InputEvent& event : events) {
+        InputRecordingEvent record = {};
+        record.time = static_cast<float>(event.time - startTime);
+        record.type = static_cast<uint8_t>(event.type);
+        record.action = static_cast<int16_t>(event.action);
+        record.code = event.code;
+        record.x = static_cast<float>(event.x);
+        record.y = static_cast<float>(event.y);
+        m_events.push_back(record);
+    }
+}
+
+bool InputRecording::save(const std::string& path) const {
+    InputRecordingHeader header = {};
+    std::memcpy(header.magic, kInputRecordingMagic, sizeof(kInputRecordingMagic));
+    header.version = kInputRecordingVersion;
+    header.frameCount = static_cast<uint32_t>(m_frames.size());
+    header.eventCount = static_cast<uint32_t>(m_events.size());
+    header.startMouseX = m_startMouseX;
+    header.startMouseY = m_startMouseY;
+
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        std::cerr << "ERROR::INPUTRECORDING: Could not open " << path << " for writing." << std::endl;
+        return false;
+    }
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(m_frames.data()), static_cast<std::streamsize>(sizeof(InputRecordingFrame) * m_frames.size()));
+    file.write(reinterpret_cast<const char*>(m_events.data()), static_cast<std::streamsize>(sizeof(InputRecordingEvent) * m_events.size()));
+    if (!file) {
+        std::cerr << "ERROR::INPUTRECORDING: Failed writing " << path << std::endl;
+        return false;
+    }
+    return true;
+}
+
+bool InputRecording::load(const std::string& path) {
+    clear();
+    FileView file = VirtualFileSystem::getInstance().open(path);
+    if (!file.isValid() || file.size < sizeof(InputRecordingHeader)) {
+        std::cerr << "ERROR::INPUTRECORDING: Could not read " << path << std::endl;
+        return false;
+    }
+
+    InputRecordingHeader header;
+    std::memcpy(&header, file.data, sizeof(header));
+    if (std::memcmp(header.magic, kInputRecordingMagic, sizeof(kInputRecordingMagic)) != 0 || header.version != kInputRecordingVersion) {
+        std::cerr << "ERROR::INPUTRECORDING: " << path << " is not a version " << kInputRecordingVersion << " input recording." << std::endl;
+        return false;
+    }
+    const size_t expectedSize = sizeof(InputRecordingHeader)
+        + sizeof(InputRecordingFrame) * static_cast<size_t>(header.frameCount)
+        + sizeof(InputRecordingEvent) * static_cast<size_t>(header.eventCount);
+    if (file.size != expectedSize) {
+        std::cerr << "ERROR::INPUTRECORDING: " << path << " is truncated or corrupt." << std::endl;
+        return false;
+    }
+
+    const unsigned char* cursor = static_cast<const unsigned char*>(file.data) + sizeof(InputRecordingHeader);
+    m_frames.resize(header.frameCount);
+    std::memcpy(m_frames.data(), cursor, sizeof(InputRecordingFrame) * m_frames.size());
+    cursor += sizeof(InputRecordingFrame) * m_frames.size();
+    m_events.resize(header.eventCount);
+    std::memcpy(m_events.data(), cursor, sizeof(InputRecordingEvent) * m_events.size());
+
+    uint32_t firstEvent = 0;
+    m_frameFirstEvent.reserve(m_frames.size());
+    for (const InputRecordingFrame& frame : m_frames) {
+        if (frame.eventCount > header.eventCount - firstEvent) {
+            std::cerr << "ERROR::INPUTRECORDING: " << path << " has inconsistent frame event counts." << std::endl;
+            clear();
+            return false;
+        }
+        m_frameFirstEvent.push_back(firstEvent);
+        firstEvent += frame.eventCount;
+    }
+
+    m_startMouseX = header.startMouseX;
+    m_startMouseY = header.startMouseY;
+    return true;
+}
+
+void InputRecording::getFrameEvents(size_t frame, double startTime, std::vector<InputEvent>& outEvents) const {
+    const uint32_t first = m_frameFirstEvent[frame];
+    for (uint32_t i = 0; i < m_frames[frame].eventCount; ++i) {
+        const InputRecordingEvent& record = m_events[first + i];
+        outEvents.push_back({ startTime + record.time, static_cast<InputEventType>(record.type), record.code, record.action, record.x, record.y });
+    }
+}
\ No newline at end of file
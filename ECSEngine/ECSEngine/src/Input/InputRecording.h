@@ -0,0 +1,66 @@
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+struct InputEvent;
+
+// Binary capture of the input a session received, frame by frame, with the
+// frame time each frame ran with (.einp):
+//
+//   InputRecordingHeader
+//   InputRecordingFrame[frameCount]
+//   InputRecordingEvent[eventCount]   (in frame order)
+
+constexpr char kInputRecordingMagic[4] = { 'E', 'I', 'N', 'P' };
+constexpr uint32_t kInputRecordingVersion = 1;
+
+struct InputRecordingHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t frameCount;
+    uint32_t eventCount;
+    double startMouseX;
+    double startMouseY;
+};
+
+struct InputRecordingFrame {
+    float deltaTime;
+    uint32_t eventCount;
+};
+
+struct InputRecordingEvent {
+    // Seconds since the recording started.
+    float time;
+    uint8_t type;
+    uint8_t reserved;
+    int16_t action;
+    int32_t code;
+    float x;
+    float y;
+};
+
+class InputRecording {
+public:
+    void clear();
+    void setStartMouse(double x, double y);
+    void addFrame(float deltaTime, const std::vector<InputEvent>& events, double startTime);
+
+    bool save(const std::string& path) const;
+    bool load(const std::string& path);
+
+    size_t getFrameCount() const { return m_frames.size(); }
+    float getFrameDeltaTime(size_t frame) const { return m_frames[frame].deltaTime; }
+    // Appends the events of one frame, with times relative to startTime.
+    void getFrameEvents(size_t frame, double startTime, std::vector<InputEvent>& outEvents) const;
+    double getStartMouseX() const { return m_startMouseX; }
+    double getStartMouseY() const { return m_startMouseY; }
+
+private:
+    std::vector<InputRecordingFrame> m_frames;
+    std::vector<uint32_t> m_frameFirstEvent;
+    std::vector<InputRecordingEvent> m_events;
+    double m_startMouseX = 0.0;
+    double m_startMouseY = 0.0;
+};
\ No newline at end of file
@@ -0,0 +1,166 @@
+#include "BlockCompressor.h"
+#include <algorithm>
+#include <cstdlib>
+
+static uint16_t packRGB565(int r, int g, int b) {
+    return static_cast<uint16_t>(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3));
+}
+
+static void unpackRGB565(uint16_t color, int out[3]) {
+    int r = (color >> 11) & 31;
+    int g = (color >> 5) & 63;
+    int b = color & 31;
+    out[0] = (r << 3) | (r >> 2);
+    out[1] = (g << 2) | (g >> 4);
+    out[2] = (b << 3) | (b >> 2);
+}
+
+// Edge blocks repeat the last row/column so partially covered blocks don't
+// pull their endpoints towards black.
+void BlockCompressor::fetchBlock(const uint8_t* rgba, uint32_t width, uint32_t height, uint32_t blockX, uint32_t blockY, uint8_t outBlock[64]) {
+    for (uint32_t y = 0; y < 4; ++y) {
+        uint32_t sourceY = std::min(blockY * 4 + y, height - 1);
+        for (uint32_t x = 0; x < 4; ++x) {
+            uint32_t sourceX = std::min(blockX * 4 + x, width - 1);
+            const uint8_t* pixel = rgba + (static_cast<size_t>(sourceY) * width + sourceX) * 4;
+            std::copy(pixel, pixel + 4, outBlock + (y * 4 + x) * 4);
+        }
+    }
+}
+
+void BlockCompressor::compressColorBlock(const uint8_t block[64], uint8_t* out) {
+    int minColor[3] = { 255, 255, 255 };
+    int maxColor[3] = { 0, 0, 0 };
+    for (int i = 0; i < 16; ++i) {
+        for (int c = 0; c < 3; ++c) {
+            minColor[c] = std::min(minColor[c], static_cast<int>(block[i * 4 + c]));
+            maxColor[c] = std::max(maxColor[c], static_cast<int>(block[i * 4 + c]));
+        }
+    }
+
+    // Pull the endpoints in slightly; the interpolated colours then cover the
+    // block's range better than the raw extremes.
+    for (int c = 0; c < 3; ++c) {
+        int inset = (maxColor[c] - minColor[c]) / 16;
+        minColor[c] = std::min(255, minColor[c] + inset);
+        maxColor[c] = std::max(0, maxColor[c] - inset);
+    }
+
+    uint16_t color0 = packRGB565(maxColor[0], maxColor[1], maxColor[2]);
+    uint16_t color1 = packRGB565(minColor[0], minColor[1], minColor[2]);
+    if (color0 < color1) {
+        std::swap(color0, color1);
+    }
+
+    uint32_t indices = 0;
+    if (color0 != color1) {
+        int palette[4][3];
+        unpackRGB565(color0, palette[0]);
+        unpackRGB565(color1, palette[1]);
+        for (int c = 0; c < 3; ++c) {
+            palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+            palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+        }
+
+        for (int i = 0; i < 16; ++i) {
+            int bestIndex = 0;
+            int bestDistance = 1 << 30;
+            for (int p = 0; p < 4; ++p) {
+                int distance = 0;
+                for (int c = 0; c < 3; ++c) {
+                    int delta = block[i * 4 + c] - palette[p][c];
+                    distance += delta * delta;
+                }
+                if (distance < bestDistance) {
+                    bestDistance = distance;
+                    bestIndex = p;
+                }
+            }
+            indices |= static_cast<uint32_t>(bestIndex) << (i * 2);
+        }
+    }
+
+    out[0] = static_cast<uint8_t>(color0 & 0xFF);
+    out[1] = static_cast<uint8_t>(color0 >> 8);
+    out[2] = static_cast<uint8_t>(color1 & 0xFF);
+    out[3] = static_cast<uint8_t>(color1 >> 8);
+    for (int i = 0; i < 4; ++i) {
+        out[4 + i] = static_cast<uint8_t>((indices >> (i * 8)) & 0xFF);
+    }
+}
+
+void BlockCompressor::compressAlphaBlock(const uint8_t block[64], uint8_t* out) {
+    int minAlpha = 255;
+    int maxAlpha = 0;
+    for (int i = 0; i < 16; ++i) {
+        minAlpha = std::min(minAlpha, static_cast<int>(block[i * 4 + 3]));
+        maxAlpha = std::max(maxAlpha, static_cast<int>(block[i * 4 + 3]));
+    }
+
+    out[0] = static_cast<uint8_t>(maxAlpha);
+    out[1] = static_cast<uint8_t>(minAlpha);
+
+    uint64_t indices = 0;
+    if (maxAlpha != minAlpha) {
+        // alpha0 > alpha1 selects the eight-value interpolation mode.
+        int palette[8];
+        palette[0] = maxAlpha;
+        palette[1] = minAlpha;
+        for (int p = 1; p < 7; ++p) {
+            palette[p + 1] = ((7 - p) * maxAlpha + p * minAlpha) / 7;
+        }
+
+        for (int i = 0; i < 16; ++i) {
+            int alpha = block[i * 4 + 3];
+            int bestIndex = 0;
+            int bestDistance = 256;
+            for (int p = 0; p < 8; ++p) {
+                int distance = std::abs(alpha - palette[p]);
+                if (distance < bestDistance) {
+                    bestDistance = distance;
+                    bestIndex = p;
+                }
+            }
+            indices |= static_cast<uint64_t>(bestIndex) << (i * 3);
+        }
+    }
+
+    for (int i = 0; i < 6; ++i) {
+        out[2 + i] = static_cast<uint8_t>((indices >> (i * 8)) & 0xFF);
+    }
+}
+
+std::vector<uint8_t> BlockCompressor::compressBC1(const uint8_t* rgba, uint32_t width, uint32_t height) {
+    uint32_t blocksX = (width + 3) / 4;
+    uint32_t blocksY = (height + 3) / 4;
+    std::vector<uint8_t> result(static_cast<size_t>(blocksX) * blocksY * 8);
+
+    uint8_t block[64];
+    uint8_t* out = result.data();
+    for (uint32_t by = 0; by < blocksY; ++by) {
+        for (uint32_t bx = 0; bx < blocksX; ++bx) {
+            fetchBlock(rgba, width, height, bx, by, block);
+            compressColorBlock(block, out);
+            out += 8;
+        }
+    }
+    return result;
+}
+
+std::vector<uint8_t> BlockCompressor::compressBC3(const uint8_t* rgba, uint32_t width, uint32_t height) {
+    uint32_t blocksX = (width + 3) / 4;
+    uint32_t blocksY = (height + 3) / 4;
+    std::vector<uint8_t> result(static_cast<size_t>(blocksX) * blocksY * 16);
+
+    uint8_t block[64];
+    uint8_t* out = result.data();
+    for (uint32_t by = 0; by < blocksY; ++by) {
+        for (uint32_t bx = 0; bx < blocksX; ++bx) {
+            fetchBlock(rgba, width, height, bx, by, block);
+            compressAlphaBlock(block, out);
+            compressColorBlock(block, out + 8);
+            out += 16;
+        }
+    }
+    return result;
+}
\ No newline at end of file
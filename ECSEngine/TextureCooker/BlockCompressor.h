@@ -0,0 +1,19 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+// Minimal BC1/BC3 (DXT1/DXT5) encoder. Endpoints come from the block's colour
+// bounding box, which is fast and good enough for diffuse textures; it is not
+// meant to compete with offline encoders on quality.
+class BlockCompressor {
+public:
+    // rgba must hold width * height * 4 bytes. Returns the compressed level.
+    static std::vector<uint8_t> compressBC1(const uint8_t* rgba, uint32_t width, uint32_t height);
+    static std::vector<uint8_t> compressBC3(const uint8_t* rgba, uint32_t width, uint32_t height);
+
+private:
+    static void fetchBlock(const uint8_t* rgba, uint32_t width, uint32_t height, uint32_t blockX, uint32_t blockY, uint8_t outBlock[64]);
+    static void compressColorBlock(const uint8_t block[64], uint8_t* out);
+    static void compressAlphaBlock(const uint8_t block[64], uint8_t* out);
+};
\ No newline at end of file
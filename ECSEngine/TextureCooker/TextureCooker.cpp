@@ -0,0 +1,214 @@
+#include "BlockCompressor.h"
+#include "Core/TextureContainer.h"
+#include "stb_image.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// Offline converter from PNG/JPG/TGA/BMP to the engine's .etex container.
+//
+//   TextureCooker [--format raw|bc1|bc3] [--no-mips] <input> [output]
+//
+// <input> may be a directory, in which case every image in it is cooked to a
+// .etex file next to the source.
+
+struct CookOptions {
+    std::string format = "raw";
+    bool generateMips = true;
+};
+
+struct MipLevel {
+    uint32_t width;
+    uint32_t height;
+    std::vector<uint8_t> pixels;
+};
+
+static MipLevel downsample(const MipLevel& source, int channels) {
+    MipLevel result;
+    result.width = std::max(1u, source.width / 2);
+    result.height = std::max(1u, source.height / 2);
+    result.pixels.resize(static_cast<size_t>(result.width) * result.height * channels);
+
+    for (uint32_t y = 0; y < result.height; ++y) {
+        uint32_t y0 = std::min(y * 2, source.height - 1);
+        uint32_t y1 = std::min(y * 2 + 1, source.height - 1);
+        for (uint32_t x = 0; x < result.width; ++x) {
+            uint32_t x0 = std::min(x * 2, source.width - 1);
+            uint32_t x1 = std::min(x * 2 + 1, source.width - 1);
+            for (int c = 0; c < channels; ++c) {
+                int sum = source.pixels[(static_cast<size_t>(y0) * source.width + x0) * channels + c]
+                    + source.pixels[(static_cast<size_t>(y0) * source.width + x1) * channels + c]
+                    + source.pixels[(static_cast<size_t>(y1) * source.width + x0) * channels + c]
+                    + source.pixels[(static_cast<size_t>(y1) * source.width + x1) * channels + c];
+                result.pixels[(static_cast<size_t>(y) * result.width + x) * channels + c] = static_cast<uint8_t>((sum + 2) / 4);
+            }
+        }
+    }
+    return result;
+}
+
+static bool writeContainer(const std::string& outputPath, TextureContainerFormat format, const std::vector<MipLevel>& levels) {
+    TextureContainerHeader header = {};
+    std::memcpy(header.magic, kTextureContainerMagic, sizeof(header.magic));
+    header.version = kTextureContainerVersion;
+    header.format = static_cast<uint32_t>(format);
+    header.width = levels.front().width;
+    header.height = levels.front().height;
+    header.mipCount = static_cast<uint32_t>(levels.size());
+
+    std::vector<TextureContainerMip> table(levels.size());
+    uint64_t offset = sizeof(TextureContainerHeader) + sizeof(TextureContainerMip) * table.size();
+    for (size_t i = 0; i < levels.size(); ++i) {
+        offset = (offset + kTextureContainerAlignment - 1) & ~static_cast<uint64_t>(kTextureContainerAlignment - 1);
+        table[i].width = levels[i].width;
+        table[i].height = levels[i].height;
+        table[i].offset = offset;
+        table[i].size = levels[i].pixels.size();
+        offset += table[i].size;
+    }
+
+    std::ofstream file(outputPath, std::ios::binary | std::ios::trunc);
+    if (!file) {
+        std::cerr << "ERROR: Could not open " << outputPath << " for writing." << std::endl;
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(table.data()), sizeof(TextureContainerMip) * table.size());
+    const char padding[kTextureContainerAlignment] = {};
+    for (size_t i = 0; i < levels.size(); ++i) {
+        uint64_t position = static_cast<uint64_t>(file.tellp());
+        file.write(padding, static_cast<std::streamsize>(table[i].offset - position));
+        file.write(reinterpret_cast<const char*>(levels[i].pixels.data()), static_cast<std::streamsize>(levels[i].pixels.size()));
+    }
+    return static_cast<bool>(file);
+}
+
+static bool cookTexture(const std::string& inputPath, const std::string& outputPath, const CookOptions& options) {
+    bool compress = options.format == "bc1" || options.format == "bc3";
+
+    int width, height, channels;
+    // Block compression always works on RGBA; raw keeps the source channel count.
+    stbi_uc* data = stbi_load(inputPath.c_str(), &width, &height, &channels, compress ? 4 : 0);
+    if (!data) {
+        std::cerr << "ERROR: Failed to decode " << inputPath << " - " << stbi_failure_reason() << std::endl;
+        return false;
+    }
+    if (compress) {
+        channels = 4;
+    }
+
+    std::vector<MipLevel> levels;
+    levels.push_back({ static_cast<uint32_t>(width), static_cast<uint32_t>(height),
+        std::vector<uint8_t>(data, data + static_cast<size_t>(width) * height * channels) });
+    stbi_image_free(data);
+
+    if (options.generateMips) {
+        while (levels.back().width > 1 || levels.back().height > 1) {
+            levels.push_back(downsample(levels.back(), channels));
+        }
+    }
+
+    TextureContainerFormat format;
+    if (options.format == "bc1") {
+        format = TextureContainerFormat::BC1;
+    }
+    else if (options.format == "bc3") {
+        format = TextureContainerFormat::BC3;
+    }
+    else {
+        format = channels == 1 ? TextureContainerFormat::R8
+            : channels == 4 ? TextureContainerFormat::RGBA8
+            : TextureContainerFormat::RGB8;
+        if (channels == 2) {
+            std::cerr << "ERROR: Two-channel images are not supported: " << inputPath << std::endl;
+            return false;
+        }
+    }
+
+    if (compress) {
+        for (MipLevel& level : levels) {
+            level.pixels = format == TextureContainerFormat::BC1
+                ? BlockCompressor::compressBC1(level.pixels.data(), level.width, level.height)
+                : BlockCompressor::compressBC3(level.pixels.data(), level.width, level.height);
+        }
+    }
+
+    if (!writeContainer(outputPath, format, levels)) {
+        return false;
+    }
+
+    std::cout << "Cooked " << inputPath << " -> " << outputPath << " (" << width << "x" << height
+        << ", " << options.format << ", " << levels.size() << " mip level(s))" << std::endl;
+    return true;
+}
+
+static bool isSourceImage(const std::filesystem::path& path) {
+    std::string extension = path.extension().string();
+    std::transform(extension.begin(), extension.end(), extension.begin(), [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+    return extension == ".png" || extension == ".jpg" || extension == ".jpeg" || extension == ".tga" || extension == ".bmp";
+}
+
+static void printUsage() {
+    std::cout << "Usage: TextureCooker [--format raw|bc1|bc3] [--no-mips] <input> [output]" << std::endl;
+}
+
+int main(int argc, char** argv) {
+    CookOptions options;
+    std::vector<std::string> paths;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string argument = argv[i];
+        if (argument == "--format" && i + 1 < argc) {
+            options.format = argv[++i];
+        }
+        else if (argument == "--no-mips") {
+            options.generateMips = false;
+        }
+        else if (argument == "--help" || argument == "-h") {
+            printUsage();
+            return 0;
+        }
+        else {
+            paths.push_back(argument);
+        }
+    }
+
+    if (paths.empty() || paths.size() > 2 || (options.format != "raw" && options.format != "bc1" && options.format != "bc3")) {
+        printUsage();
+        return 1;
+    }
+
+    std::filesystem::path input(paths[0]);
+    int failures = 0;
+
+    if (std::filesystem::is_directory(input)) {
+        for (const auto& entry : std::filesystem::directory_iterator(input)) {
+            if (!entry.is_regular_file() || !isSourceImage(entry.path())) {
+                continue;
+            }
+            std::filesystem::path output = entry.path();
+            output.replace_extension(kTextureContainerExtension);
+            if (!cookTexture(entry.path().string(), output.string(), options)) {
+                ++failures;
+            }
+        }
+    }
+    else {
+        std::filesystem::path output = paths.size() > 1 ? std::filesystem::path(paths[1]) : input;
+        if (paths.size() == 1) {
+            output.replace_extension(kTextureContainerExtension);
+        }
+        if (!cookTexture(input.string(), output.string(), options)) {
+            ++failures;
+        }
+    }
+
+    return failures == 0 ? 0 : 1;
+}
\ No newline at end of file
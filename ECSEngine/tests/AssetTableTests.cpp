@@ -0,0 +1,70 @@
+#include "Core/AssetTable.h"
+#include "TestCheck.h"
+#include <string>
+
+static void testHashing() {
+    constexpr AssetRef wall("res/textures/wall.png");
+    static_assert(wall.id == hashAssetName("res/textures/wall.png"), "AssetRef must hash at compile time");
+    CHECK_EQ(appendAssetName(hashAssetName("res/a.png"), "diffuse"), hashAssetName("res/a.png|diffuse"));
+    CHECK(hashAssetName("a") != hashAssetName("b"));
+}
+
+static void testInsertFindErase() {
+    AssetTable<int> table;
+    CHECK(table.find(hashAssetName("missing")) == nullptr);
+    CHECK(!table.erase(hashAssetName("missing")));
+
+    table.insert(hashAssetName("one"), 1);
+    table.insert(hashAssetName("two"), 2);
+    table.insert(hashAssetName("one"), 11);
+    CHECK_EQ(table.size(), size_t(2));
+    CHECK_EQ(*table.find(hashAssetName("one")), 11);
+    CHECK_EQ(*table.find(hashAssetName("two")), 2);
+
+    CHECK(table.erase(hashAssetName("one")));
+    CHECK(table.find(hashAssetName("one")) == nullptr);
+    CHECK_EQ(*table.find(hashAssetName("two")), 2);
+    CHECK_EQ(table.size(), size_t(1));
+
+    // Reinserting lands in the tombstone and is found again.
+    table.insert(hashAssetName("one"), 111);
+    CHECK_EQ(*table.find(hashAssetName("one")), 111);
+}
+
+static void testGrowthAndChurn() {
+    AssetTable<std::string> table;
+    const int count = 5000;
+    for (int i = 0; i < count; ++i) {
+        std::string name = "res/asset" + std::to_string(i);
+        table.insert(hashAssetName(name), name);
+    }
+    CHECK_EQ(table.size(), size_t(count));
+
+    for (int i = 0; i < count; i += 2) {
+        CHECK(table.erase(hashAssetName("res/asset" + std::to_string(i))));
+    }
+    for (int i = 0; i < count; ++i) {
+        std::string name = "res/asset" + std::to_string(i);
+        const std::string* found = table.find(hashAssetName(name));
+        if (i % 2 == 0) {
+            CHECK(found == nullptr);
+        }
+        else {
+            CHECK(found && *found == name);
+        }
+    }
+
+    size_t visited = 0;
+    table.forEach([&visited](AssetId id, std::string& name) {
+        CHECK_EQ(id, hashAssetName(name));
+        ++visited;
+    });
+    CHECK_EQ(visited, table.size());
+}
+
+int main() {
+    testHashing();
+    testInsertFindErase();
+    testGrowthAndChurn();
+    return testExitCode();
+}
\ No newline at end of file
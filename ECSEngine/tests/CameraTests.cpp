@@ -0,0 +1,74 @@
+#include "Components/Camera2DComponent.h"
+#include "Components/Camera3DComponent.h"
+#include "TestCheck.h"
+#include <glm/glm.hpp>
+
+// The picking cache is keyed on the camera version, so re-applying the same
+// parameters every frame must not bump it.
+
+static void updateTowerCamera(Camera3DComponent& camera, float towerHeight, float scrollY) {
+    camera.setLookAtTarget(glm::vec3(0.0f, towerHeight + 1.0f, 0.0f));
+    camera.applyFovZoom(scrollY);
+}
+
+static void test3DIdenticalUpdates() {
+    Camera3DComponent camera(nullptr);
+    updateTowerCamera(camera, 2.0f, 0.0f);
+    unsigned int version = camera.getVersion();
+
+    updateTowerCamera(camera, 2.0f, 0.0f);
+    updateTowerCamera(camera, 2.0f, 0.0f);
+    CHECK_EQ(camera.getVersion(), version);
+
+    camera.setFov(camera.getFov());
+    camera.setAspectRatio(camera.getAspectRatio());
+    camera.setNearPlane(camera.getNearPlane());
+    camera.setFarPlane(camera.getFarPlane());
+    CHECK_EQ(camera.getVersion(), version);
+}
+
+static void test3DChangesBumpVersion() {
+    Camera3DComponent camera(nullptr);
+    unsigned int version = camera.getVersion();
+
+    updateTowerCamera(camera, 3.0f, 0.0f);
+    CHECK(camera.getVersion() != version);
+
+    version = camera.getVersion();
+    float fov = camera.getFov();
+    updateTowerCamera(camera, 3.0f, 1.0f);
+    CHECK(camera.getVersion() != version);
+    CHECK(camera.getFov() < fov);
+
+    version = camera.getVersion();
+    camera.setAspectRatio(2.0f);
+    CHECK(camera.getVersion() != version);
+}
+
+static void test3DZoomAtLimit() {
+    Camera3DComponent camera(nullptr);
+    camera.applyFovZoom(100.0f);
+    unsigned int version = camera.getVersion();
+    // Already clamped to the minimum FOV; zooming further changes nothing.
+    camera.applyFovZoom(1.0f);
+    CHECK_EQ(camera.getVersion(), version);
+}
+
+static void test2DIdenticalUpdates() {
+    Camera2DComponent camera(nullptr, 800.0f, 600.0f);
+    unsigned int version = camera.getVersion();
+    camera.setScreenDimensions(800.0f, 600.0f);
+    camera.setZoom(1.0f);
+    CHECK_EQ(camera.getVersion(), version);
+
+    camera.setZoom(2.0f);
+    CHECK(camera.getVersion() != version);
+}
+
+int main() {
+    test3DIdenticalUpdates();
+    test3DChangesBumpVersion();
+    test3DZoomAtLimit();
+    test2DIdenticalUpdates();
+    return testExitCode();
+}
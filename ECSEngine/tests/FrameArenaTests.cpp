@@ -0,0 +1,83 @@
+#include "Core/FrameArena.h"
+#include "TestCheck.h"
+#include <cstdint>
+#include <string>
+
+static bool isAligned(const void* pointer, size_t alignment) {
+    return reinterpret_cast<uintptr_t>(pointer) % alignment == 0;
+}
+
+static void testAlignmentAndAccounting() {
+    FrameArena arena(1024);
+    void* a = arena.allocate(3, 1);
+    void* b = arena.allocate(8, 8);
+    void* c = arena.allocate(16, 16);
+    CHECK(isAligned(b, 8));
+    CHECK(isAligned(c, 16));
+    CHECK(a != b && b != c);
+    CHECK(arena.getBytesUsed() >= 27);
+    CHECK_EQ(arena.getCapacity(), size_t(1024));
+
+    arena.reset();
+    CHECK_EQ(arena.getBytesUsed(), size_t(0));
+    CHECK(arena.getPeakBytesUsed() >= 27);
+}
+
+static void testBlocksAreKeptAcrossResets() {
+    FrameArena arena(256);
+    for (int frame = 0; frame < 4; ++frame) {
+        for (int i = 0; i < 10; ++i) {
+            (void)arena.allocate(64, 8);
+        }
+        arena.reset();
+    }
+    // The first frame grows the arena; later frames reuse its blocks.
+    CHECK_EQ(arena.getCapacity(), size_t(256 * 3));
+}
+
+static void testOversizedRequestGetsItsOwnBlock() {
+    FrameArena arena(128);
+    void* large = arena.allocate(1000, 16);
+    CHECK(isAligned(large, 16));
+    CHECK(arena.getCapacity() >= 1000);
+}
+
+static void testLastAllocationCanBeReturned() {
+    FrameArena arena(1024);
+    (void)arena.allocate(32, 8);
+    size_t used = arena.getBytesUsed();
+    void* temporary = arena.allocate(64, 8);
+    arena.deallocate(temporary, 64, 8);
+    CHECK_EQ(arena.getBytesUsed(), used);
+}
+
+static void testContainersAndFormatting() {
+    FrameArena& arena = FrameArena::getThreadInstance();
+    arena.reset();
+    {
+        FrameVector<int> values(&arena);
+        for (int i = 0; i < 100; ++i) {
+            values.push_back(i);
+        }
+        CHECK_EQ(values[99], 99);
+        CHECK(arena.getBytesUsed() >= 100 * sizeof(int));
+    }
+
+    FrameString shortText = formatFrameString("%d-%s", 42, "ok");
+    CHECK_EQ(std::string(shortText), std::string("42-ok"));
+
+    std::string longArgument(400, 'x');
+    FrameString longText = formatFrameString("<%s>", longArgument.c_str());
+    CHECK_EQ(longText.size(), size_t(402));
+    CHECK(longText.front() == '<' && longText.back() == '>');
+    arena.reset();
+}
+
+int main() {
+    testAlignmentAndAccounting();
+    testBlocksAreKeptAcrossResets();
+    testOversizedRequestGetsItsOwnBlock();
+    testLastAllocationCanBeReturned();
+    testContainersAndFormatting();
+    return testExitCode();
+}
\ No newline at end of file
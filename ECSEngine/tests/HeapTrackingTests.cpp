@@ -0,0 +1,72 @@
+#include "Core/MemoryTracker.h"
+#include "TestCheck.h"
+#include <cstdint>
+#include <memory>
+#include <new>
+
+// Over-aligned types go through the std::align_val_t overloads of operator
+// new and delete, which must be counted like every other allocation and
+// still honour the alignment.
+
+struct alignas(64) CacheLine {
+    unsigned char bytes[64];
+};
+
+struct alignas(256) Page {
+    unsigned char bytes[512];
+};
+
+static bool isAligned(const void* pointer, size_t alignment) {
+    return reinterpret_cast<uintptr_t>(pointer) % alignment == 0;
+}
+
+static void testAlignedNewIsTracked() {
+    MemoryTracker& memory = MemoryTracker::getInstance();
+    MemoryStats before = memory.getTotals(MemoryDomain::Cpu);
+
+    CacheLine* line = new CacheLine();
+    Page* pages = new Page[3];
+    CHECK(isAligned(line, alignof(CacheLine)));
+    CHECK(isAligned(pages, alignof(Page)));
+    MemoryStats during = memory.getTotals(MemoryDomain::Cpu);
+    CHECK_EQ(during.totalAllocations - before.totalAllocations, uint64_t(2));
+    CHECK(during.liveBytes - before.liveBytes >= static_cast<int64_t>(sizeof(CacheLine) + 3 * sizeof(Page)));
+
+    delete line;
+    delete[] pages;
+    MemoryStats after = memory.getTotals(MemoryDomain::Cpu);
+    CHECK_EQ(after.liveBytes, before.liveBytes);
+    CHECK_EQ(after.liveAllocations, before.liveAllocations);
+}
+
+static void testAlignedNothrowNewIsTracked() {
+    MemoryTracker& memory = MemoryTracker::getInstance();
+    MemoryStats before = memory.getTotals(MemoryDomain::Cpu);
+
+    CacheLine* line = new (std::nothrow) CacheLine();
+    CHECK(line != nullptr);
+    CHECK(isAligned(line, alignof(CacheLine)));
+    CHECK_EQ(memory.getTotals(MemoryDomain::Cpu).totalAllocations - before.totalAllocations, uint64_t(1));
+    delete line;
+    CHECK_EQ(memory.getTotals(MemoryDomain::Cpu).liveBytes, before.liveBytes);
+}
+
+static void testAlignedFreeKeepsItsTag() {
+    MemoryTracker& memory = MemoryTracker::getInstance();
+    int64_t before = memory.getStats(MemoryDomain::Cpu, MemoryTag::Renderer).liveBytes;
+    std::unique_ptr<CacheLine> line;
+    {
+        MemoryTagScope scope(MemoryTag::Renderer);
+        line = std::make_unique<CacheLine>();
+    }
+    CHECK_EQ(memory.getStats(MemoryDomain::Cpu, MemoryTag::Renderer).liveBytes - before, static_cast<int64_t>(sizeof(CacheLine)));
+    line.reset();
+    CHECK_EQ(memory.getStats(MemoryDomain::Cpu, MemoryTag::Renderer).liveBytes, before);
+}
+
+int main() {
+    testAlignedNewIsTracked();
+    testAlignedNothrowNewIsTracked();
+    testAlignedFreeKeepsItsTag();
+    return testExitCode();
+}
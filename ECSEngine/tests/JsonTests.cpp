@@ -0,0 +1,67 @@
+#include "Core/Json.h"
+#include "TestCheck.h"
+#include <string>
+
+static void testDocument() {
+    const char* text = R"({
+        "name": "tower",
+        "count": 3,
+        "scale": -1.5e2,
+        "enabled": true,
+        "parent": null,
+        "keys": ["W", "S"],
+        "nested": { "escaped": "a\"b\\c\n\u00e9" }
+    })";
+
+    JsonValue root;
+    std::string error;
+    CHECK(JsonValue::parse(text, root, &error));
+    CHECK(error.empty());
+    CHECK(root.isObject());
+
+    // Members keep their file order.
+    const auto& members = root.getObject();
+    CHECK_EQ(members.size(), size_t(7));
+    CHECK_EQ(members.front().first, std::string("name"));
+    CHECK_EQ(members.back().first, std::string("nested"));
+
+    CHECK_EQ(root.find("name")->getString(), std::string("tower"));
+    CHECK_EQ(root.find("count")->getNumber(), 3.0);
+    CHECK_EQ(root.find("scale")->getNumber(), -150.0);
+    CHECK(root.find("enabled")->getBool());
+    CHECK(root.find("parent")->isNull());
+    CHECK(root.find("missing") == nullptr);
+
+    const JsonValue* keys = root.find("keys");
+    CHECK(keys && keys->isArray());
+    CHECK_EQ(keys->getArray().size(), size_t(2));
+    CHECK_EQ(keys->getArray()[1].getString(), std::string("S"));
+
+    const JsonValue* nested = root.find("nested");
+    CHECK(nested && nested->isObject());
+    CHECK_EQ(nested->find("escaped")->getString(), std::string("a\"b\\c\n\xC3\xA9"));
+}
+
+static void testFallbacks() {
+    JsonValue value;
+    CHECK(JsonValue::parse("\"text\"", value));
+    CHECK_EQ(value.getNumber(7.0), 7.0);
+    CHECK(value.getBool(true));
+}
+
+static void testErrors() {
+    const char* invalid[] = { "", "{", "[1, 2", "{\"a\" 1}", "tru", "\"\\q\"", "{} trailing" };
+    for (const char* text : invalid) {
+        JsonValue value;
+        std::string error;
+        CHECK(!JsonValue::parse(text, value, &error));
+        CHECK(!error.empty());
+    }
+}
+
+int main() {
+    testDocument();
+    testFallbacks();
+    testErrors();
+    return testExitCode();
+}
\ No newline at end of file
@@ -0,0 +1,95 @@
+#include "Core/MicrowaveSystem.h"
+#include "TestCheck.h"
+#include <cstdint>
+#include <vector>
+
+// MicrowaveSystem must behave exactly like a Microwave per appliance. Random
+// inputs are fed to both, and every appliance is compared after every tick.
+
+static uint32_t s_random = 12345u;
+
+static uint32_t nextRandom() {
+    s_random = s_random * 1664525u + 1013904223u;
+    return s_random >> 8;
+}
+
+static void applyReferenceInput(Microwave& microwave, MicrowaveSystem::Input input, int digit) {
+    switch (input) {
+    case MicrowaveSystem::Input::Digit: microwave.inputNumber(digit); break;
+    case MicrowaveSystem::Input::Start: microwave.startCooking(); break;
+    case MicrowaveSystem::Input::Stop: microwave.stopCooking(); break;
+    case MicrowaveSystem::Input::Clear: microwave.clearInput(); break;
+    case MicrowaveSystem::Input::OpenDoor: microwave.openDoor(); break;
+    case MicrowaveSystem::Input::CloseDoor: microwave.closeDoor(); break;
+    case MicrowaveSystem::Input::Break: microwave.breakMicrowave(); break;
+    case MicrowaveSystem::Input::Repair: microwave.repairMicrowave(); break;
+    }
+}
+
+static bool matches(const MicrowaveSystem& system, size_t index, const Microwave& microwave) {
+    Microwave::Time expected = microwave.getRemainingTime();
+    Microwave::Time actual = system.getRemainingTime(index);
+    return system.getState(index) == microwave.getCurrentState()
+        && system.getDoorState(index) == microwave.getDoorState()
+        && system.isLightOn(index) == microwave.isLightOn()
+        && actual.minutes == expected.minutes && actual.seconds == expected.seconds;
+}
+
+static void testInitialState() {
+    MicrowaveSystem system;
+    Microwave microwave;
+    size_t index = system.add();
+    CHECK_EQ(index, size_t(0));
+    CHECK(matches(system, index, microwave));
+}
+
+static void testMatchesReference() {
+    static const MicrowaveSystem::Input kInputs[] = {
+        MicrowaveSystem::Input::Digit, MicrowaveSystem::Input::Digit, MicrowaveSystem::Input::Digit,
+        MicrowaveSystem::Input::Digit, MicrowaveSystem::Input::Start, MicrowaveSystem::Input::Start,
+        MicrowaveSystem::Input::Stop, MicrowaveSystem::Input::Clear, MicrowaveSystem::Input::OpenDoor,
+        MicrowaveSystem::Input::CloseDoor, MicrowaveSystem::Input::CloseDoor, MicrowaveSystem::Input::Repair,
+        MicrowaveSystem::Input::Break
+    };
+    const size_t count = 256;
+    const int ticks = 2000;
+
+    MicrowaveSystem system;
+    system.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        system.add();
+    }
+    std::vector<Microwave> reference(count);
+
+    int mismatches = 0;
+    for (int tick = 0; tick < ticks; ++tick) {
+        // Half an input per appliance and tick on average; some appliances
+        // get several, so the order queued inputs are applied in matters.
+        for (size_t i = 0; i < count / 2; ++i) {
+            size_t index = nextRandom() % count;
+            MicrowaveSystem::Input input = kInputs[nextRandom() % (sizeof(kInputs) / sizeof(kInputs[0]))];
+            if (input == MicrowaveSystem::Input::Break && nextRandom() % 8 != 0) {
+                input = MicrowaveSystem::Input::CloseDoor;
+            }
+            int digit = static_cast<int>(nextRandom() % 10);
+            system.queueInput(index, input, digit);
+            applyReferenceInput(reference[index], input, digit);
+        }
+        system.applyInputs();
+        system.tick();
+
+        for (size_t i = 0; i < count; ++i) {
+            reference[i].tick();
+            if (!matches(system, i, reference[i])) {
+                ++mismatches;
+            }
+        }
+    }
+    CHECK_EQ(mismatches, 0);
+}
+
+int main() {
+    testInitialState();
+    testMatchesReference();
+    return testExitCode();
+}
\ No newline at end of file
@@ -0,0 +1,84 @@
+#include "Core/ShelfPacker.h"
+#include "TestCheck.h"
+#include <vector>
+
+static std::vector<ShelfRect*> pointers(std::vector<ShelfRect>& rects) {
+    std::vector<ShelfRect*> result;
+    for (ShelfRect& rect : rects) {
+        result.push_back(&rect);
+    }
+    return result;
+}
+
+static bool overlaps(const ShelfRect& a, const ShelfRect& b) {
+    return a.x < b.x + b.width && b.x < a.x + a.width && a.y < b.y + b.height && b.y < a.y + a.height;
+}
+
+static void testFitsExactly() {
+    std::vector<ShelfRect> rects(4);
+    for (ShelfRect& rect : rects) {
+        rect.width = 128;
+        rect.height = 128;
+    }
+    std::vector<ShelfRect*> order = pointers(rects);
+    unsigned int width = 0;
+    unsigned int height = 0;
+    CHECK(ShelfPacker::pack(order, 256, 0, width, height));
+    CHECK_EQ(width, 256u);
+    CHECK_EQ(height, 256u);
+    for (size_t i = 0; i < rects.size(); ++i) {
+        CHECK(rects[i].x + rects[i].width <= width);
+        CHECK(rects[i].y + rects[i].height <= height);
+        for (size_t j = i + 1; j < rects.size(); ++j) {
+            CHECK(!overlaps(rects[i], rects[j]));
+        }
+    }
+}
+
+// The sizing loop used to stop once the width passed maxSize, so this came
+// back as a 512x256 atlas.
+static void testAreaLargerThanMaxSize() {
+    std::vector<ShelfRect> rects(5);
+    for (ShelfRect& rect : rects) {
+        rect.width = 128;
+        rect.height = 128;
+    }
+    std::vector<ShelfRect*> order = pointers(rects);
+    unsigned int width = 0;
+    unsigned int height = 0;
+    CHECK(!ShelfPacker::pack(order, 256, 0, width, height));
+    CHECK_EQ(width, 0u);
+    CHECK_EQ(height, 0u);
+}
+
+static void testRectWiderThanMaxSize() {
+    std::vector<ShelfRect> rects(1);
+    rects[0].width = 300;
+    rects[0].height = 8;
+    std::vector<ShelfRect*> order = pointers(rects);
+    unsigned int width = 0;
+    unsigned int height = 0;
+    CHECK(!ShelfPacker::pack(order, 256, 0, width, height));
+}
+
+static void testPaddingCountsTowardsSize() {
+    std::vector<ShelfRect> rects(1);
+    rects[0].width = 60;
+    rects[0].height = 60;
+    std::vector<ShelfRect*> order = pointers(rects);
+    unsigned int width = 0;
+    unsigned int height = 0;
+    CHECK(ShelfPacker::pack(order, 4096, 4, width, height));
+    CHECK_EQ(width, 128u);
+    CHECK_EQ(height, 128u);
+    CHECK_EQ(rects[0].x, 4u);
+    CHECK_EQ(rects[0].y, 4u);
+}
+
+int main() {
+    testFitsExactly();
+    testAreaLargerThanMaxSize();
+    testRectWiderThanMaxSize();
+    testPaddingCountsTowardsSize();
+    return testExitCode();
+}
@@ -0,0 +1,106 @@
+#include "Core/StateMachine.h"
+#include "TestCheck.h"
+#include <cstdint>
+#include <string>
+
+enum class Door : uint8_t { Closed, Open, Locked, Count };
+enum class DoorEvent : uint8_t { Toggle, Lock, Unlock, Count };
+
+struct DoorLog {
+    std::string entries;
+};
+
+static void logCreak(DoorLog& log) { log.entries += "creak;"; }
+static void logEnterOpen(DoorLog& log) { log.entries += "enter-open;"; }
+static void logExitOpen(DoorLog& log) { log.entries += "exit-open;"; }
+static void logEnterLocked(DoorLog& log) { log.entries += "enter-locked;"; }
+
+using DoorTable = StateTable<Door, DoorEvent, DoorLog>;
+
+static constexpr DoorTable kDoorTable = [] {
+    DoorTable table;
+    table.on(Door::Closed, DoorEvent::Toggle, Door::Open, &logCreak)
+        .on(Door::Open, DoorEvent::Toggle, Door::Closed, &logCreak)
+        .on(Door::Closed, DoorEvent::Lock, Door::Locked)
+        .on(Door::Locked, DoorEvent::Unlock, Door::Closed)
+        .onEnter(Door::Open, &logEnterOpen)
+        .onExit(Door::Open, &logExitOpen)
+        .onEnter(Door::Locked, &logEnterLocked);
+    return table;
+}();
+
+// The table is built at compile time.
+static_assert(kDoorTable.find(Door::Closed, DoorEvent::Toggle).next == Door::Open, "Closed + Toggle opens");
+static_assert(kDoorTable.find(Door::Open, DoorEvent::Lock).next == Door::Open, "unset pairs keep the state");
+
+static void testDispatchRunsHooksInOrder() {
+    DoorLog log;
+    Door door = Door::Closed;
+    CHECK(kDoorTable.dispatch(door, DoorEvent::Toggle, log));
+    CHECK(door == Door::Open);
+    CHECK_EQ(log.entries, std::string("creak;enter-open;"));
+
+    log.entries.clear();
+    CHECK(kDoorTable.dispatch(door, DoorEvent::Toggle, log));
+    CHECK(door == Door::Closed);
+    CHECK_EQ(log.entries, std::string("exit-open;creak;"));
+}
+
+static void testUnsetTransitionsAreIgnored() {
+    DoorLog log;
+    Door door = Door::Open;
+    CHECK(!kDoorTable.dispatch(door, DoorEvent::Lock, log));
+    CHECK(door == Door::Open);
+    CHECK(log.entries.empty());
+}
+
+static void testAnyStateAndSelfTransitions() {
+    DoorTable table;
+    table.onAnyState(DoorEvent::Unlock, Door::Closed, &logCreak);
+
+    // Every state reacts; staying in Closed runs the action but no hooks.
+    for (Door from : { Door::Closed, Door::Open, Door::Locked }) {
+        DoorLog log;
+        Door door = from;
+        CHECK_EQ(table.dispatch(door, DoorEvent::Unlock, log), from != Door::Closed);
+        CHECK(door == Door::Closed);
+        CHECK_EQ(log.entries, std::string("creak;"));
+    }
+}
+
+static void testMachineEntersInitialState() {
+    DoorLog log;
+    StateMachine<Door, DoorEvent, DoorLog> machine(kDoorTable, Door::Locked);
+    machine.enter(log);
+    CHECK_EQ(log.entries, std::string("enter-locked;"));
+    CHECK(machine.dispatch(DoorEvent::Unlock, log));
+    CHECK(machine.getState() == Door::Closed);
+}
+
+static void testStepAllMatchesDispatch() {
+    const DoorEvent events[] = { DoorEvent::Toggle, DoorEvent::Lock, DoorEvent::Unlock, DoorEvent::Toggle, DoorEvent::Lock, DoorEvent::Toggle };
+    const size_t count = sizeof(events) / sizeof(events[0]);
+
+    Door batched[count];
+    Door expected[count];
+    for (size_t i = 0; i < count; ++i) {
+        batched[i] = static_cast<Door>(i % static_cast<size_t>(Door::Count));
+        expected[i] = batched[i];
+    }
+
+    kDoorTable.stepAll(batched, events, count);
+    DoorLog log;
+    for (size_t i = 0; i < count; ++i) {
+        kDoorTable.dispatch(expected[i], events[i], log);
+        CHECK(batched[i] == expected[i]);
+    }
+}
+
+int main() {
+    testDispatchRunsHooksInOrder();
+    testUnsetTransitionsAreIgnored();
+    testAnyStateAndSelfTransitions();
+    testMachineEntersInitialState();
+    testStepAllMatchesDispatch();
+    return testExitCode();
+}
\ No newline at end of file
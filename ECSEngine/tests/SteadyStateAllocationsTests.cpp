@@ -0,0 +1,80 @@
+#include "Components/Camera3DComponent.h"
+#include "Core/FrameArena.h"
+#include "Core/MemoryTracker.h"
+#include "Core/MicrowaveSystem.h"
+#include "Core/RenderSnapshot.h"
+#include "TestCheck.h"
+#include <cstdint>
+
+// Once the arenas and containers have grown to a frame's working set, a
+// steady frame must not touch the heap. Counts come from the operator new
+// that MemoryTracker installs. The full scene and submission path needs a GL
+// context, so the Benchmark's BenchmarkSteadyStateAllocations tests cover it.
+
+static const size_t kApplianceCount = 64;
+static const size_t kPacketCount = 500;
+
+static void runFrame(int frame, MicrowaveSystem& microwaves, Camera3DComponent& camera, RenderSnapshot& snapshot) {
+    FrameArena& arena = FrameArena::getThreadInstance();
+    arena.reset();
+
+    for (size_t i = 0; i < microwaves.size(); ++i) {
+        microwaves.queueInput(i, MicrowaveSystem::Input::Digit, (frame + static_cast<int>(i)) % 10);
+        if ((frame + i) % 7 == 0) {
+            microwaves.queueInput(i, MicrowaveSystem::Input::Start);
+        }
+    }
+    microwaves.applyInputs();
+    microwaves.tick();
+
+    camera.setLookAtTarget(glm::vec3(0.0f, static_cast<float>(frame / 10), 0.0f));
+    camera.applyFovZoom(frame % 5 == 0 ? 1.0f : 0.0f);
+    glm::mat4 viewProjection = camera.getProjectionMatrix() * camera.getViewMatrix();
+
+    snapshot.clear();
+    for (size_t i = 0; i < kPacketCount; ++i) {
+        DrawPacket packet = {};
+        packet.model = viewProjection * glm::mat4(static_cast<float>(i));
+        snapshot.packets.push_back(packet);
+    }
+    FrameVector<size_t> visible(&arena);
+    for (size_t i = 0; i < snapshot.packets.size(); i += 3) {
+        visible.push_back(i);
+    }
+    for (size_t i = 0; i < microwaves.size(); i += 8) {
+        Microwave::Time time = microwaves.getRemainingTime(i);
+        FrameString label = formatFrameString("Microwave %zu  %02d:%02d  visible %zu", i, time.minutes, time.seconds, visible.size());
+        snapshot.addText(label, 10.0f, 20.0f * static_cast<float>(i), 0.3f, glm::vec3(1.0f));
+    }
+}
+
+int main() {
+    MicrowaveSystem microwaves;
+    for (size_t i = 0; i < kApplianceCount; ++i) {
+        microwaves.add();
+    }
+    Camera3DComponent camera(nullptr);
+    RenderSnapshot snapshot;
+    MemoryTracker& memory = MemoryTracker::getInstance();
+
+    uint64_t warmupStart = memory.getTotals(MemoryDomain::Cpu).totalAllocations;
+    const int kWarmupFrames = 4;
+    for (int frame = 0; frame < kWarmupFrames; ++frame) {
+        runFrame(frame, microwaves, camera, snapshot);
+    }
+    // Guards against the tracker being compiled out, which would make the
+    // steady-state check below pass vacuously.
+    CHECK(memory.getTotals(MemoryDomain::Cpu).totalAllocations > warmupStart);
+
+    for (int frame = kWarmupFrames; frame < kWarmupFrames + 200; ++frame) {
+        uint64_t before = memory.getTotals(MemoryDomain::Cpu).totalAllocations;
+        runFrame(frame, microwaves, camera, snapshot);
+        uint64_t allocations = memory.getTotals(MemoryDomain::Cpu).totalAllocations - before;
+        CHECK_EQ(allocations, uint64_t(0));
+        if (allocations != 0) {
+            std::cerr << "frame " << frame << " made " << allocations << " heap allocation(s)" << std::endl;
+            break;
+        }
+    }
+    return testExitCode();
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <iostream>
+
+// Minimal assertions for the headless tests. A failed CHECK is reported and
+// counted; main returns testExitCode() so CTest sees the failure.
+inline int& testFailureCount() {
+    static int count = 0;
+    return count;
+}
+
+inline int testExitCode() {
+    if (testFailureCount() > 0) {
+        std::cerr << testFailureCount() << " check(s) failed." << std::endl;
+        return 1;
+    }
+    return 0;
+}
+
+#define CHECK(condition)                                                                        \
+    do {                                                                                        \
+        if (!(condition)) {                                                                     \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK(" #condition ") failed" << std::endl; \
+            ++testFailureCount();                                                               \
+        }                                                                                       \
+    } while (false)
+
+#define CHECK_EQ(actual, expected)                                                              \
+    do {                                                                                        \
+        const auto& checkActual = (actual);                                                     \
+        const auto& checkExpected = (expected);                                                 \
+        if (!(checkActual == checkExpected)) {                                                  \
+            std::cerr << __FILE__ << ":" << __LINE__ << ": CHECK_EQ(" #actual ", " #expected ") failed: " \
+                << checkActual << " != " << checkExpected << std::endl;                          \
+            ++testFailureCount();                                                               \
+        }                                                                                       \
+    } while (false)